@@ -4,12 +4,14 @@ SET EMSDKPATH=C:\bin\emsdk
 
 CALL %EMSDKPATH%\emsdk_env.bat 
 
-SET SOURCE=Emulator.cpp ^
- emubase\Disasm.cpp emubase\Board.cpp emubase\Processor.cpp emubase\Floppy.cpp emubase\Hard.cpp emubase\pit8253.cpp ^
+SET SOURCE=Emulator.cpp EmulatorScreen.cpp ^
+ emubase\Disasm.cpp emubase\Board.cpp emubase\Processor.cpp emubase\Floppy.cpp emubase\Hard.cpp emubase\pit8253.cpp emubase\StateImage.cpp emubase\Rewind.cpp emubase\DiskOverlay.cpp emubase\RunAhead.cpp emubase\SerialLink.cpp ^
  util\lz4.cpp miniz\zip.c
 
 @echo on
 
 @rem emcc %SOURCE% -s WASM=1  2>emcc.log
 @rem emcc %SOURCE% -s WASM=1 -s SAFE_HEAP=1 -o emul.html --shell-file shell_minimal.html
-emcc %SOURCE% -s WASM=1 -O2 -s "EXPORTED_RUNTIME_METHODS=['ccall', 'cwrap']" -s FORCE_FILESYSTEM=1 -s NO_EXIT_RUNTIME=1 -fno-exceptions -fno-rtti -o emul.html --shell-file shell_minimal.html
+@rem Threaded build, for parallel state image compression: add -pthread -s PTHREAD_POOL_SIZE=4, then the threads=4 URL parameter
+@rem turns it on, see Emulator_SetStateThreads()
+emcc %SOURCE% -s WASM=1 -O2 -s "EXPORTED_RUNTIME_METHODS=['ccall', 'cwrap']" -s "EXPORTED_FUNCTIONS=['_main', '_malloc', '_free']" -s FORCE_FILESYSTEM=1 -s NO_EXIT_RUNTIME=1 -fno-exceptions -fno-rtti -o emul.html --shell-file shell_minimal.html
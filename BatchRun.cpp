@@ -0,0 +1,927 @@
+/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// BatchRun.cpp
+// Native headless batch runner: runs the jobs of the manifest on a work-stealing thread pool,
+// one machine per job, checks the screen hashes and reports the results as JSON.
+//
+// Build:
+//   g++ -O2 -pthread BatchRun.cpp EmulatorScreen.cpp emubase/Board.cpp emubase/Processor.cpp emubase/Floppy.cpp
+//       emubase/Hard.cpp emubase/pit8253.cpp emubase/Disasm.cpp emubase/StateImage.cpp emubase/Rewind.cpp
+//       emubase/DiskOverlay.cpp emubase/RunAhead.cpp util/lz4.cpp -o batchrun
+// Usage:
+//   batchrun [-j threads] [-T threads] manifest.txt > results.json
+//   batchrun -daemon SOCKET [-j machines] [-T threads] [-state golden.neonst]
+//   -T sets the threads compressing and decompressing the state image RAM chunks, see StateImage_SetThreadCount(),
+//   shared by all the jobs; 1 by default, then every job does its state images on its own thread.
+//
+// Manifest: one job per line, "key=value" fields separated by spaces; empty lines and lines starting with '#' skipped.
+//   name=NAME           Job name for the report; the line number by default
+//   disk0=FILE          Floppy image for drive 0; disk1 for drive 1, the machine has no more drives
+//   hdd=FILE            Hard disk image
+//   state=FILE          Start from the .neonst state image instead of the cold boot
+//   frames=N            Frames to run, 25 frames per second
+//   keys=FILE           Input script: lines "FRAME SCAN 1|0", press or release the key before the frame;
+//                       SCAN is hex, (row << 8) | mask, the same as for Emulator_KeyEvent()
+//   hash=FRAME:HEX      Expected screen hash after the frame, FNV-1a 64-bit of the RGB32 screen; repeatable.
+//                       Use "?" instead of HEX to just report the hash.
+//   until=pc:OCT        Stop when the CPU comes to the address, the frames are the time limit then;
+//   until=hash:HEX      or stop after the frame with the screen hash
+//   screenshot=FILE     Save the screen at the end as .ppm
+//   savestate=FILE      Save the state image at the end, .neonst
+//   fastdisk=1          Run the guest loops reading the disk buffer at once, see CMotherboard::SetFastDiskMode();
+//                       the screen hashes could differ from the ones of the usual run
+// The disk writes go to the overlays, the image files are not changed, so the jobs could share the images.
+// The floppy images are mapped to memory copy-on-write, so the jobs on the same image share its pages.
+//
+// Daemon mode: keeps the machines booted from the golden state image, the built-in boot image by default,
+// and runs the requests coming to the Unix socket: one manifest line per request, one JSON line per response.
+// Every machine serves one connection at a time; every request runs on a copy-on-write clone of the booted machine,
+// the clone is dropped after the request, so the next one starts from the golden state again in no time.
+// The "state", "disk" and "hdd" fields work the same way, the machine is not reset after attaching the disks.
+
+#include "stdafx.h"
+#include "emubase/Emubase.h"
+#include "EmulatorScreen.h"
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <errno.h>
+
+// DebugPrint and DebugLog
+void DebugPrint(LPCTSTR) {}
+void DebugPrintFormat(LPCTSTR, ...) {}
+void DebugLogClear() {}
+void DebugLogCloseFile() {}
+void DebugLog(LPCTSTR) {}
+void DebugLogFormat(LPCTSTR, ...) {}
+
+#include "pk11_rom.h"
+#include "boot_image.h"
+
+#define BATCH_MAX_THREADS    256
+#define BATCH_MAX_CHECKS     16
+#define BATCH_MAX_LINE       4096
+#define BATCH_RTC_TIME       946684800  // 2000-01-01, for the screen hashes not to depend on the host clock
+#define BATCH_FLOPPY_DRIVES  2  // Drives the machine has, disk0 and disk1
+
+//////////////////////////////////////////////////////////////////////
+
+
+struct BatchCheck
+{
+    int frame;
+    bool okExpected;  // false for "?"
+    uint64_t expected;
+    uint64_t actual;
+    bool okDone;
+};
+
+enum BatchUntil { BATCH_UNTIL_NONE = 0, BATCH_UNTIL_PC = 1, BATCH_UNTIL_HASH = 2 };
+
+struct BatchKey
+{
+    int frame;
+    uint16_t scan;
+    bool pressed;
+};
+
+struct BatchJob
+{
+    char* sName;
+    char* sDisks[BATCH_FLOPPY_DRIVES];
+    int baddisk;  // N + 1 for the diskN field of a drive the machine has not, the job fails; 0 if none
+    char* sHardImage;
+    char* sStateImage;
+    char* sKeysFile;
+    int frames;
+    BatchCheck checks[BATCH_MAX_CHECKS];
+    int checkcount;
+    BatchUntil until;
+    uint16_t untilpc[2];  // Breakpoint list for until=pc
+    uint64_t untilhash;
+    char* sScreenshotFile;
+    char* sSaveStateFile;
+    bool okFastDisk;
+    // Results
+    const char* sStatus;  // "pass", "fail" or "error"
+    char sError[256];
+    int framesdone;
+    bool okUntil;  // The until condition met
+    double startseconds;  // Time to get the machine ready
+    double seconds;
+};
+
+// Work-stealing queue of the job indices, one per worker: the owner takes from the back, others steal from the front
+struct BatchQueue
+{
+    pthread_mutex_t mutex;
+    int* items;
+    int head, tail;  // Items [head, tail)
+};
+
+static BatchJob* g_pJobs = nullptr;
+static int g_nJobCount = 0;
+static BatchQueue g_Queues[BATCH_MAX_THREADS];
+static int g_nQueueCount = 0;
+
+static const uint8_t* g_pGoldenImage = boot_image;  // Daemon mode: the state image the machines start from
+static uint32_t g_nGoldenImageSize = boot_image_length;
+static int g_nListenSocket = -1;
+static CMotherboard* g_pWarmBoards[BATCH_MAX_THREADS];  // Daemon mode: the booted machine of every worker
+static uint32_t g_nWarmUptime = 0;
+
+
+//////////////////////////////////////////////////////////////////////
+
+
+static double BatchRun_GetTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static char* BatchRun_StrDup(const char* s, size_t len)
+{
+    char* result = (char*) ::malloc(len + 1);
+    memcpy(result, s, len);
+    result[len] = 0;
+    return result;
+}
+
+// FNV-1a 64-bit
+static uint64_t BatchRun_Hash(const uint8_t* pData, size_t size)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= pData[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static uint8_t* BatchRun_ReadFile(const char* sFileName, uint32_t* pSize)
+{
+    FILE* fpFile = ::fopen(sFileName, "rb");
+    if (fpFile == nullptr)
+        return nullptr;
+    ::fseek(fpFile, 0, SEEK_END);
+    uint32_t fileSize = (uint32_t)::ftell(fpFile);
+    ::fseek(fpFile, 0, SEEK_SET);
+    uint8_t* pData = (uint8_t*) ::malloc(fileSize);
+    if (pData != nullptr && ::fread(pData, 1, fileSize, fpFile) != fileSize)
+    {
+        ::free(pData);  pData = nullptr;
+    }
+    ::fclose(fpFile);
+    *pSize = fileSize;
+    return pData;
+}
+
+// Read the input script, sorted by frame as in the file; returns false if the file is bad
+static bool BatchRun_ReadKeys(const char* sFileName, BatchKey** ppKeys, int* pCount)
+{
+    *ppKeys = nullptr;  *pCount = 0;
+    FILE* fpFile = ::fopen(sFileName, "rt");
+    if (fpFile == nullptr)
+        return false;
+
+    int capacity = 0;
+    char line[BATCH_MAX_LINE];
+    bool okResult = true;
+    while (::fgets(line, sizeof(line), fpFile) != nullptr)
+    {
+        const char* p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '#' || *p == '\r' || *p == '\n' || *p == 0)
+            continue;
+        int frame = 0, pressed = 0;
+        unsigned int scan = 0;
+        if (sscanf(p, "%d %x %d", &frame, &scan, &pressed) != 3 || frame < 0 ||
+            (*pCount > 0 && frame < (*ppKeys)[*pCount - 1].frame))
+        {
+            okResult = false;
+            break;
+        }
+        if (*pCount == capacity)
+        {
+            capacity = (capacity == 0) ? 64 : capacity * 2;
+            *ppKeys = (BatchKey*) ::realloc(*ppKeys, capacity * sizeof(BatchKey));
+        }
+        BatchKey* pKey = *ppKeys + (*pCount)++;
+        pKey->frame = frame;
+        pKey->scan = (uint16_t)scan;
+        pKey->pressed = (pressed != 0);
+    }
+    ::fclose(fpFile);
+    return okResult;
+}
+
+// Parse the manifest line to the job; returns false with the message in sError on bad line
+static bool BatchRun_ParseJob(char* line, int lineno, BatchJob* pJob, char* sError, size_t errorSize)
+{
+    memset(pJob, 0, sizeof(BatchJob));
+    char* p = line;
+    for (;;)
+    {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+        if (*p == 0)
+            break;
+        char* field = p;
+        while (*p != 0 && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') p++;
+        size_t fieldlen = p - field;
+        char* eq = (char*)memchr(field, '=', fieldlen);
+        if (eq == nullptr)
+        {
+            snprintf(sError, errorSize, "line %d: no '=' in the field", lineno);
+            return false;
+        }
+        size_t keylen = eq - field;
+        char* value = BatchRun_StrDup(eq + 1, fieldlen - keylen - 1);
+
+        if (keylen == 4 && strncmp(field, "name", 4) == 0)
+            pJob->sName = value;
+        else if (keylen == 5 && strncmp(field, "disk", 4) == 0 && field[4] >= '0' && field[4] <= '9')
+        {
+            int slot = field[4] - '0';
+            if (slot < BATCH_FLOPPY_DRIVES)
+            {
+                ::free(pJob->sDisks[slot]);
+                pJob->sDisks[slot] = value;
+            }
+            else
+            {
+                ::free(value);
+                pJob->baddisk = slot + 1;
+            }
+        }
+        else if (keylen == 3 && strncmp(field, "hdd", 3) == 0)
+            pJob->sHardImage = value;
+        else if (keylen == 5 && strncmp(field, "state", 5) == 0)
+            pJob->sStateImage = value;
+        else if (keylen == 4 && strncmp(field, "keys", 4) == 0)
+            pJob->sKeysFile = value;
+        else if (keylen == 6 && strncmp(field, "frames", 6) == 0)
+        {
+            pJob->frames = atoi(value);
+            ::free(value);
+        }
+        else if (keylen == 4 && strncmp(field, "hash", 4) == 0)
+        {
+            char* colon = strchr(value, ':');
+            if (colon == nullptr || pJob->checkcount >= BATCH_MAX_CHECKS)
+            {
+                ::free(value);
+                snprintf(sError, errorSize, "line %d: bad hash field, or more than %d hashes", lineno, BATCH_MAX_CHECKS);
+                return false;
+            }
+            BatchCheck* pCheck = pJob->checks + pJob->checkcount++;
+            pCheck->frame = atoi(value);
+            pCheck->okExpected = (strcmp(colon + 1, "?") != 0);
+            pCheck->expected = strtoull(colon + 1, nullptr, 16);
+            ::free(value);
+        }
+        else if (keylen == 5 && strncmp(field, "until", 5) == 0)
+        {
+            if (strncmp(value, "pc:", 3) == 0)
+            {
+                pJob->until = BATCH_UNTIL_PC;
+                pJob->untilpc[0] = (uint16_t)strtoul(value + 3, nullptr, 8);
+                pJob->untilpc[1] = 0177777;
+            }
+            else if (strncmp(value, "hash:", 5) == 0)
+            {
+                pJob->until = BATCH_UNTIL_HASH;
+                pJob->untilhash = strtoull(value + 5, nullptr, 16);
+            }
+            ::free(value);
+            if (pJob->until == BATCH_UNTIL_NONE)
+            {
+                snprintf(sError, errorSize, "line %d: bad until field", lineno);
+                return false;
+            }
+        }
+        else if (keylen == 10 && strncmp(field, "screenshot", 10) == 0)
+            pJob->sScreenshotFile = value;
+        else if (keylen == 9 && strncmp(field, "savestate", 9) == 0)
+            pJob->sSaveStateFile = value;
+        else if (keylen == 8 && strncmp(field, "fastdisk", 8) == 0)
+        {
+            pJob->okFastDisk = (atoi(value) != 0);
+            ::free(value);
+        }
+        else
+        {
+            ::free(value);
+            snprintf(sError, errorSize, "line %d: unknown field '%.*s'", lineno, (int)keylen, field);
+            return false;
+        }
+    }
+
+    if (pJob->sName == nullptr)
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "line%d", lineno);
+        pJob->sName = BatchRun_StrDup(buffer, strlen(buffer));
+    }
+    for (int i = 0; i < pJob->checkcount; i++)
+    {
+        if (pJob->checks[i].frame > pJob->frames)
+            pJob->frames = pJob->checks[i].frame;
+    }
+    if (pJob->frames <= 0)
+    {
+        snprintf(sError, errorSize, "line %d: no frames to run", lineno);
+        return false;
+    }
+    return true;
+}
+
+static void BatchRun_FreeJob(BatchJob* pJob)
+{
+    ::free(pJob->sName);
+    for (int slot = 0; slot < BATCH_FLOPPY_DRIVES; slot++)
+        ::free(pJob->sDisks[slot]);
+    ::free(pJob->sHardImage);
+    ::free(pJob->sStateImage);
+    ::free(pJob->sKeysFile);
+    ::free(pJob->sScreenshotFile);
+    ::free(pJob->sSaveStateFile);
+    memset(pJob, 0, sizeof(BatchJob));
+}
+
+static bool BatchRun_ReadManifest(const char* sFileName)
+{
+    FILE* fpFile = ::fopen(sFileName, "rt");
+    if (fpFile == nullptr)
+    {
+        fprintf(stderr, "Failed to open the manifest %s\n", sFileName);
+        return false;
+    }
+
+    int capacity = 0;
+    int lineno = 0;
+    char line[BATCH_MAX_LINE];
+    bool okResult = true;
+    while (::fgets(line, sizeof(line), fpFile) != nullptr)
+    {
+        lineno++;
+        const char* p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '#' || *p == '\r' || *p == '\n' || *p == 0)
+            continue;
+        if (g_nJobCount == capacity)
+        {
+            capacity = (capacity == 0) ? 64 : capacity * 2;
+            g_pJobs = (BatchJob*) ::realloc(g_pJobs, capacity * sizeof(BatchJob));
+        }
+        char sError[256];
+        if (!BatchRun_ParseJob(line, lineno, g_pJobs + g_nJobCount, sError, sizeof(sError)))
+        {
+            fprintf(stderr, "Manifest %s, %s\n", sFileName, sError);
+            okResult = false;
+            break;
+        }
+        g_nJobCount++;
+    }
+    ::fclose(fpFile);
+    return okResult;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+
+
+// Save the RGB32 screen as binary .ppm
+static bool BatchRun_SaveScreenshot(const char* sFileName, const uint32_t* pScreen)
+{
+    FILE* fpFile = ::fopen(sFileName, "wb");
+    if (fpFile == nullptr)
+        return false;
+    fprintf(fpFile, "P6\n%d %d\n255\n", NEON_SCREEN_WIDTH, NEON_SCREEN_HEIGHT);
+    uint8_t line[NEON_SCREEN_WIDTH * 3];
+    bool okResult = true;
+    for (int y = 0; y < NEON_SCREEN_HEIGHT && okResult; y++)
+    {
+        const uint32_t* pLine = pScreen + y * NEON_SCREEN_WIDTH;
+        for (int x = 0; x < NEON_SCREEN_WIDTH; x++)
+        {
+            line[x * 3] = (uint8_t)(pLine[x] >> 16);
+            line[x * 3 + 1] = (uint8_t)(pLine[x] >> 8);
+            line[x * 3 + 2] = (uint8_t)pLine[x];
+        }
+        okResult = (::fwrite(line, 1, sizeof(line), fpFile) == sizeof(line));
+    }
+    ::fclose(fpFile);
+    return okResult;
+}
+
+static bool BatchRun_SaveState(const char* sFileName, CMotherboard* pBoard, uint32_t uptime)
+{
+    uint32_t bufferSize = StateImage_GetMaxSize(pBoard);
+    uint8_t* pBuffer = (uint8_t*) ::malloc(bufferSize);
+    if (pBuffer == nullptr)
+        return false;
+    uint32_t imageSize = StateImage_Save(pBoard, uptime, pBuffer, bufferSize);
+    bool okResult = false;
+    FILE* fpFile = (imageSize == 0) ? nullptr : ::fopen(sFileName, "wb");
+    if (fpFile != nullptr)
+    {
+        okResult = (::fwrite(pBuffer, 1, imageSize, fpFile) == imageSize);
+        ::fclose(fpFile);
+    }
+    ::free(pBuffer);
+    return okResult;
+}
+
+// Run the job on the machine of its own: the cold booted one, or the clone of the warm machine in daemon mode;
+// the results go to the job
+static void BatchRun_RunJob(BatchJob* pJob, uint32_t* pScreen, CMotherboard* pWarmBoard, uint32_t warmUptime)
+{
+    double startTime = BatchRun_GetTime();
+    pJob->sStatus = "error";
+    if (pJob->baddisk != 0)
+    {
+        snprintf(pJob->sError, sizeof(pJob->sError),
+                "no floppy drive %d, the machine has drives 0 and 1 only (disk0, disk1)", pJob->baddisk - 1);
+        return;
+    }
+    BatchKey* pKeys = nullptr;
+    int keycount = 0;
+    if (pJob->sKeysFile != nullptr && !BatchRun_ReadKeys(pJob->sKeysFile, &pKeys, &keycount))
+    {
+        ::free(pKeys);
+        snprintf(pJob->sError, sizeof(pJob->sError), "failed to read the input script");
+        return;
+    }
+
+    CMotherboard* pBoard = (pWarmBoard != nullptr) ? pWarmBoard->Clone() : new CMotherboard();
+    if (pBoard == nullptr)
+    {
+        ::free(pKeys);
+        snprintf(pJob->sError, sizeof(pJob->sError), "failed to clone the machine");
+        return;
+    }
+    uint32_t uptime = warmUptime;
+    if (pWarmBoard == nullptr)
+    {
+        pBoard->SetConfiguration((uint16_t)1024);
+        pBoard->SetSharedROM((const uint8_t*)pk11_rom);
+        pBoard->SetRtcFixedTime(BATCH_RTC_TIME);
+    }
+    bool okReady = true;
+    for (int slot = 0; slot < BATCH_FLOPPY_DRIVES && okReady; slot++)
+    {
+        if (pJob->sDisks[slot] != nullptr && !pBoard->AttachFloppyImageMapped(slot, pJob->sDisks[slot], false))
+        {
+            snprintf(pJob->sError, sizeof(pJob->sError), "failed to attach the floppy image %d", slot);
+            okReady = false;
+        }
+    }
+    if (okReady && pJob->sHardImage != nullptr && !pBoard->AttachHardImage(pJob->sHardImage))
+    {
+        snprintf(pJob->sError, sizeof(pJob->sError), "failed to attach the hard disk image");
+        okReady = false;
+    }
+    if (pWarmBoard == nullptr)
+        pBoard->Reset();
+    if (okReady && pJob->sStateImage != nullptr)
+    {
+        uint32_t imageSize = 0;
+        uint8_t* pImage = BatchRun_ReadFile(pJob->sStateImage, &imageSize);
+        if (pImage == nullptr || !StateImage_Load(pBoard, pImage, imageSize, &uptime, true, true))  // Frees the data
+        {
+            snprintf(pJob->sError, sizeof(pJob->sError), "failed to load the state image");
+            okReady = false;
+        }
+    }
+    pBoard->SetScratchMode(true);  // Keep the image files intact
+    pBoard->SetFastDiskMode(pJob->okFastDisk);
+    if (pJob->until == BATCH_UNTIL_PC)
+        pBoard->SetCPUBreakpoints(pJob->untilpc);
+
+    uint8_t keymatrix[8];
+    memset(keymatrix, 0, sizeof(keymatrix));
+    int keyindex = 0;
+    bool okRendered = false;  // The screen is rendered after the last frame
+    pJob->startseconds = BatchRun_GetTime() - startTime;
+    for (int frame = 1; okReady && frame <= pJob->frames && !pJob->okUntil; frame++)
+    {
+        bool okKeys = false;
+        while (keyindex < keycount && pKeys[keyindex].frame <= frame)
+        {
+            const BatchKey* pKey = pKeys + keyindex++;
+            if (pKey->pressed)
+                keymatrix[(pKey->scan >> 8) & 7] |= (pKey->scan & 0xff);
+            else
+                keymatrix[(pKey->scan >> 8) & 7] &= ~(pKey->scan & 0xff);
+            okKeys = true;
+        }
+        if (okKeys)
+            pBoard->UpdateKeyboardMatrix(keymatrix);
+
+        if (!pBoard->SystemFrame())
+        {
+            if (pBoard->IsRAMLoadFailed())
+            {
+                snprintf(pJob->sError, sizeof(pJob->sError), "the state image RAM failed to load");
+                okReady = false;
+                break;
+            }
+            pJob->okUntil = true;  // Stopped on the until=pc breakpoint
+        }
+        pJob->framesdone = frame;
+
+        okRendered = false;
+        for (int i = 0; i < pJob->checkcount; i++)
+        {
+            BatchCheck* pCheck = pJob->checks + i;
+            if (pCheck->frame != frame)
+                continue;
+            if (!okRendered)
+                Emulator_PrepareScreenRGB32(pBoard, pScreen);
+            okRendered = true;
+            pCheck->actual = BatchRun_Hash((const uint8_t*)pScreen, NEON_SCREEN_WIDTH * NEON_SCREEN_HEIGHT * sizeof(uint32_t));
+            pCheck->okDone = true;
+        }
+        if (pJob->until == BATCH_UNTIL_HASH)
+        {
+            if (!okRendered)
+                Emulator_PrepareScreenRGB32(pBoard, pScreen);
+            okRendered = true;
+            if (BatchRun_Hash((const uint8_t*)pScreen, NEON_SCREEN_WIDTH * NEON_SCREEN_HEIGHT * sizeof(uint32_t)) == pJob->untilhash)
+                pJob->okUntil = true;
+        }
+    }
+    pJob->seconds = BatchRun_GetTime() - startTime - pJob->startseconds;
+
+    if (okReady && pJob->sScreenshotFile != nullptr)
+    {
+        if (!okRendered)
+            Emulator_PrepareScreenRGB32(pBoard, pScreen);
+        if (!BatchRun_SaveScreenshot(pJob->sScreenshotFile, pScreen))
+        {
+            snprintf(pJob->sError, sizeof(pJob->sError), "failed to save the screenshot");
+            okReady = false;
+        }
+    }
+    if (okReady && pJob->sSaveStateFile != nullptr &&
+        !BatchRun_SaveState(pJob->sSaveStateFile, pBoard, uptime + pJob->framesdone / 25))
+    {
+        snprintf(pJob->sError, sizeof(pJob->sError), "failed to save the state image");
+        okReady = false;
+    }
+
+    delete pBoard;
+    ::free(pKeys);
+    if (!okReady)
+        return;
+
+    pJob->sStatus = "pass";
+    for (int i = 0; i < pJob->checkcount; i++)
+    {
+        const BatchCheck* pCheck = pJob->checks + i;
+        if (pCheck->okExpected && (!pCheck->okDone || pCheck->actual != pCheck->expected))
+            pJob->sStatus = "fail";
+    }
+    if (pJob->until != BATCH_UNTIL_NONE && !pJob->okUntil)
+        pJob->sStatus = "fail";
+}
+
+// Take the job from the own queue, or steal one from the other queues; returns -1 when no jobs left
+static int BatchRun_TakeJob(int worker)
+{
+    BatchQueue* pQueue = g_Queues + worker;
+    int job = -1;
+    pthread_mutex_lock(&pQueue->mutex);
+    if (pQueue->head < pQueue->tail)
+        job = pQueue->items[--pQueue->tail];
+    pthread_mutex_unlock(&pQueue->mutex);
+    for (int i = 1; job < 0 && i < g_nQueueCount; i++)
+    {
+        BatchQueue* pVictim = g_Queues + (worker + i) % g_nQueueCount;
+        pthread_mutex_lock(&pVictim->mutex);
+        if (pVictim->head < pVictim->tail)
+            job = pVictim->items[pVictim->head++];
+        pthread_mutex_unlock(&pVictim->mutex);
+    }
+    return job;
+}
+
+static void* BatchRun_WorkerThread(void* param)
+{
+    int worker = (int)(intptr_t)param;
+    uint32_t* pScreen = (uint32_t*) ::malloc(NEON_SCREEN_WIDTH * NEON_SCREEN_HEIGHT * sizeof(uint32_t));
+    for (;;)
+    {
+        int job = BatchRun_TakeJob(worker);
+        if (job < 0)
+            break;
+        BatchRun_RunJob(g_pJobs + job, pScreen, nullptr, 0);
+    }
+    ::free(pScreen);
+    return nullptr;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+
+
+static void BatchRun_PrintString(FILE* fpOut, const char* s)
+{
+    fputc('"', fpOut);
+    for (; *s != 0; s++)
+    {
+        if (*s == '"' || *s == '\\')
+            fprintf(fpOut, "\\%c", *s);
+        else if ((uint8_t)*s < 0x20)
+            fprintf(fpOut, "\\u%04x", (uint8_t)*s);
+        else
+            fputc(*s, fpOut);
+    }
+    fputc('"', fpOut);
+}
+
+// Print the job results as JSON object, on one line
+static void BatchRun_PrintJob(FILE* fpOut, const BatchJob* pJob)
+{
+    fprintf(fpOut, "{ \"name\": ");
+    BatchRun_PrintString(fpOut, pJob->sName);
+    fprintf(fpOut, ", \"status\": \"%s\"", pJob->sStatus);
+    if (pJob->sError[0] != 0)
+    {
+        fprintf(fpOut, ", \"error\": ");
+        BatchRun_PrintString(fpOut, pJob->sError);
+    }
+    fprintf(fpOut, ", \"frames\": %d, \"seconds\": %.3f, \"fps\": %.1f, \"start_ms\": %.2f", pJob->framesdone, pJob->seconds,
+            (pJob->seconds > 0.0) ? pJob->framesdone / pJob->seconds : 0.0, pJob->startseconds * 1000.0);
+    if (pJob->until != BATCH_UNTIL_NONE)
+        fprintf(fpOut, ", \"until\": %s", pJob->okUntil ? "true" : "false");
+    fprintf(fpOut, ", \"hashes\": [");
+    for (int j = 0; j < pJob->checkcount; j++)
+    {
+        const BatchCheck* pCheck = pJob->checks + j;
+        fprintf(fpOut, "%s{ \"frame\": %d", (j > 0) ? ", " : "", pCheck->frame);
+        if (pCheck->okDone)
+            fprintf(fpOut, ", \"actual\": \"%016llx\"", (unsigned long long)pCheck->actual);
+        if (pCheck->okExpected)
+            fprintf(fpOut, ", \"expected\": \"%016llx\", \"match\": %s", (unsigned long long)pCheck->expected,
+                    (pCheck->okDone && pCheck->actual == pCheck->expected) ? "true" : "false");
+        fprintf(fpOut, " }");
+    }
+    fprintf(fpOut, "] }");
+}
+
+static void BatchRun_PrintResults(int threads, double seconds)
+{
+    long totalFrames = 0;
+    int passed = 0, failed = 0, errors = 0;
+    printf("{\n  \"jobs\": [\n");
+    for (int i = 0; i < g_nJobCount; i++)
+    {
+        const BatchJob* pJob = g_pJobs + i;
+        totalFrames += pJob->framesdone;
+        if (strcmp(pJob->sStatus, "pass") == 0) passed++;
+        else if (strcmp(pJob->sStatus, "fail") == 0) failed++;
+        else errors++;
+
+        printf("    ");
+        BatchRun_PrintJob(stdout, pJob);
+        printf("%s\n", (i + 1 < g_nJobCount) ? "," : "");
+    }
+    printf("  ],\n");
+    printf("  \"summary\": { \"jobs\": %d, \"passed\": %d, \"failed\": %d, \"errors\": %d, \"threads\": %d,"
+            " \"seconds\": %.3f, \"frames\": %ld, \"fps\": %.1f }\n",
+            g_nJobCount, passed, failed, errors, threads, seconds, totalFrames,
+            (seconds > 0.0) ? totalFrames / seconds : 0.0);
+    printf("}\n");
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Daemon mode
+
+
+// Serve the connections one by one: run the requests on the clones of the worker's warm machine
+static void* BatchRun_DaemonThread(void* param)
+{
+    int worker = (int)(intptr_t)param;
+    uint32_t* pScreen = (uint32_t*) ::malloc(NEON_SCREEN_WIDTH * NEON_SCREEN_HEIGHT * sizeof(uint32_t));
+    for (;;)
+    {
+        int fd = accept(g_nListenSocket, nullptr, nullptr);
+        if (fd < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            break;
+        }
+        FILE* fpIn = fdopen(fd, "r");
+        FILE* fpOut = fdopen(dup(fd), "w");
+        if (fpIn == nullptr || fpOut == nullptr)
+        {
+            if (fpIn != nullptr) ::fclose(fpIn); else close(fd);
+            if (fpOut != nullptr) ::fclose(fpOut);
+            continue;
+        }
+
+        int requestno = 0;
+        char line[BATCH_MAX_LINE];
+        while (::fgets(line, sizeof(line), fpIn) != nullptr)
+        {
+            const char* p = line;
+            while (*p == ' ' || *p == '\t') p++;
+            if (*p == '#' || *p == '\r' || *p == '\n' || *p == 0)
+                continue;
+            requestno++;
+            BatchJob job;
+            char sError[256];
+            if (BatchRun_ParseJob(line, requestno, &job, sError, sizeof(sError)))
+            {
+                BatchRun_RunJob(&job, pScreen, g_pWarmBoards[worker], g_nWarmUptime);
+                BatchRun_PrintJob(fpOut, &job);
+            }
+            else
+            {
+                fprintf(fpOut, "{ \"status\": \"error\", \"error\": ");
+                BatchRun_PrintString(fpOut, sError);
+                fprintf(fpOut, " }");
+            }
+            fprintf(fpOut, "\n");
+            ::fflush(fpOut);
+            BatchRun_FreeJob(&job);
+        }
+        ::fclose(fpIn);
+        ::fclose(fpOut);
+    }
+    ::free(pScreen);
+    return nullptr;
+}
+
+static int BatchRun_Daemon(const char* sSocketPath, const char* sGoldenFile, int machines)
+{
+    uint8_t* pGoldenData = nullptr;
+    if (sGoldenFile != nullptr)
+    {
+        pGoldenData = BatchRun_ReadFile(sGoldenFile, &g_nGoldenImageSize);
+        if (pGoldenData == nullptr)
+        {
+            fprintf(stderr, "Failed to read the state image %s\n", sGoldenFile);
+            return 2;
+        }
+        g_pGoldenImage = pGoldenData;
+    }
+
+    // Boot the machines: every one has the golden state loaded, the requests run on its clones
+    for (int i = 0; i < machines; i++)
+    {
+        CMotherboard* pBoard = new CMotherboard();
+        pBoard->SetConfiguration((uint16_t)1024);
+        pBoard->SetSharedROM((const uint8_t*)pk11_rom);
+        pBoard->SetRtcFixedTime(BATCH_RTC_TIME);
+        if (!StateImage_Load(pBoard, g_pGoldenImage, g_nGoldenImageSize, &g_nWarmUptime, false, false))
+        {
+            fprintf(stderr, "Failed to load the golden state image\n");
+            return 2;
+        }
+        g_pWarmBoards[i] = pBoard;
+    }
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(sSocketPath) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "The socket path is too long\n");
+        return 2;
+    }
+    strcpy(addr.sun_path, sSocketPath);
+    struct stat st;
+    if (stat(sSocketPath, &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(sSocketPath);  // Left from the previous run
+    g_nListenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (g_nListenSocket < 0 || bind(g_nListenSocket, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(g_nListenSocket, 64) != 0)
+    {
+        fprintf(stderr, "Failed to listen on %s: %s\n", sSocketPath, strerror(errno));
+        return 2;
+    }
+    signal(SIGPIPE, SIG_IGN);  // The client could go away before the response
+    fprintf(stderr, "Listening on %s, %d machines\n", sSocketPath, machines);
+
+    pthread_t workers[BATCH_MAX_THREADS];
+    for (int i = 1; i < machines; i++)
+        pthread_create(workers + i, nullptr, BatchRun_DaemonThread, (void*)(intptr_t)i);
+    BatchRun_DaemonThread((void*)(intptr_t)0);
+    for (int i = 1; i < machines; i++)
+        pthread_join(workers[i], nullptr);
+
+    close(g_nListenSocket);
+    for (int i = 0; i < machines; i++)
+        delete g_pWarmBoards[i];
+    ::free(pGoldenData);
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int stateThreads = 1;
+    const char* sManifest = nullptr;
+    const char* sSocketPath = nullptr;
+    const char* sGoldenFile = nullptr;
+    bool okUsage = true;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-T") == 0 && i + 1 < argc)
+            stateThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-daemon") == 0 && i + 1 < argc)
+            sSocketPath = argv[++i];
+        else if (strcmp(argv[i], "-state") == 0 && i + 1 < argc)
+            sGoldenFile = argv[++i];
+        else if (sManifest == nullptr)
+            sManifest = argv[i];
+        else
+            okUsage = false;
+    }
+    if (!okUsage || (sManifest == nullptr) == (sSocketPath == nullptr) || (sGoldenFile != nullptr && sSocketPath == nullptr))
+    {
+        fprintf(stderr, "Usage: batchrun [-j threads] [-T threads] manifest.txt\n"
+                "       batchrun -daemon SOCKET [-j machines] [-T threads] [-state golden.neonst]\n");
+        return 2;
+    }
+    if (threads < 1) threads = 1;
+    if (threads > BATCH_MAX_THREADS) threads = BATCH_MAX_THREADS;
+
+    // Shared by all the machines: decode tables, the built-in ROM
+    CProcessor::Init();
+    StateImage_AddKnownRom((const uint8_t*)pk11_rom);
+    if (stateThreads > 1)
+        StateImage_SetThreadCount(stateThreads);
+
+    if (sSocketPath != nullptr)
+    {
+        int result = BatchRun_Daemon(sSocketPath, sGoldenFile, threads);
+        CProcessor::Done();
+        return result;
+    }
+
+    if (!BatchRun_ReadManifest(sManifest))
+        return 2;
+    if (threads > g_nJobCount) threads = (g_nJobCount > 0) ? g_nJobCount : 1;
+
+    // Deal the jobs round-robin; the workers steal from each other when their own queues run out
+    g_nQueueCount = threads;
+    for (int i = 0; i < threads; i++)
+    {
+        BatchQueue* pQueue = g_Queues + i;
+        pthread_mutex_init(&pQueue->mutex, nullptr);
+        pQueue->items = (int*) ::malloc((g_nJobCount / threads + 1) * sizeof(int));
+        pQueue->head = pQueue->tail = 0;
+    }
+    for (int i = 0; i < g_nJobCount; i++)
+    {
+        BatchQueue* pQueue = g_Queues + i % threads;
+        pQueue->items[pQueue->tail++] = i;
+    }
+
+    double startTime = BatchRun_GetTime();
+    pthread_t workers[BATCH_MAX_THREADS];
+    for (int i = 1; i < threads; i++)
+        pthread_create(workers + i, nullptr, BatchRun_WorkerThread, (void*)(intptr_t)i);
+    BatchRun_WorkerThread((void*)(intptr_t)0);
+    for (int i = 1; i < threads; i++)
+        pthread_join(workers[i], nullptr);
+    double seconds = BatchRun_GetTime() - startTime;
+
+    BatchRun_PrintResults(threads, seconds);
+
+    int result = 0;
+    for (int i = 0; i < g_nJobCount; i++)
+    {
+        if (strcmp(g_pJobs[i].sStatus, "pass") != 0)
+            result = 1;
+    }
+
+    CProcessor::Done();
+    return result;
+}
+
+
+//////////////////////////////////////////////////////////////////////
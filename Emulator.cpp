@@ -14,7 +14,9 @@ NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
 #include "emubase/Emubase.h"
 #include <emscripten/emscripten.h>
 #include "miniz/zip.h"
-#include "util/lz4.h"
+#define MINIZ_HEADER_FILE_ONLY  // The implementation is in zip.c
+#include "miniz/miniz.h"
+#include "EmulatorScreen.h"
 
 #define STRINGIZE(_x) STRINGIZE_(_x)
 #define STRINGIZE_(_x) #_x
@@ -27,99 +29,464 @@ void DebugLogCloseFile() {}
 void DebugLog(LPCTSTR) {}
 void DebugLogFormat(LPCTSTR, ...) {}
 
-const int NEON_SCREEN_WIDTH  = 832;
-const int NEON_SCREEN_HEIGHT = 300;
-
 #include "pk11_rom.h"
-
-void Emulator_PrepareScreenRGB32(uint32_t* pBits);
+#include "boot_image.h"
 
 //////////////////////////////////////////////////////////////////////
 
 
-CMotherboard* g_pBoard = nullptr;
-
 bool g_okEmulatorInitialized = false;
-bool g_okEmulatorRunning = false;
 
-bool m_okEmulatorSound = false;
-bool m_okEmulatorCovox = false;
+// Emulator_RunFrames() flags
+#define EMULATOR_RUNFRAMES_RENDER  1  // Render the screen after the frames
 
-uint32_t* g_pFrameBuffer = 0;
+// Frontend status filled by Emulator_RunFrames(); the frontend reads it from the WASM heap
+// as 32-bit words at the fixed offsets, so keep the layout in sync with index.html and emul-worker.js
+struct EmulatorStatus
+{
+    uint32_t frameBuffer;   // Screen buffer address, NEON_SCREEN_WIDTH x NEON_SCREEN_HEIGHT, 0xAARRGGBB
+    uint32_t frameCount;    // Frames run since the instance created
+    uint32_t uptime;        // Machine uptime, ms
+    uint32_t diskActivity;  // Bit 0: floppy engine is on
+    uint32_t rendered;      // 1 if the screen was rendered by the last call
+    int32_t  dirtyX;        // Screen area changed since the previous render; zero size if nothing changed
+    int32_t  dirtyY;
+    int32_t  dirtyWidth;
+    int32_t  dirtyHeight;
+    uint32_t audioFill;     // Sound samples waiting for output; always 0, the web version has no sound output yet
+};
+
+// Input event to apply at the given board tick, see Emulator_QueueKeyEvent()
+struct EmulatorInputEvent
+{
+    uint64_t tick;
+    bool isMouse;
+    uint16_t vscan;   // Key scan code
+    bool pressed;
+    short dx, dy;     // Mouse delta
+    uint8_t buttons;  // Mouse buttons: bit 0 left, bit 1 right
+};
 
-long m_nFrameCount = 0;
-uint32_t m_dwTickCount = 0;
-uint32_t m_dwEmulatorUptime = 0;  // Machine uptime, seconds, from turn on or reset, increments every 25 frames
-long m_nUptimeFrameCount = 0;
+#define EMULATOR_INPUT_QUEUE_SIZE  64
 
-uint8_t m_KeyboardMatrix[8];
+#define EMULATOR_STREAM_CHUNK_SIZE  65536
+
+// Floppy image streaming in, see Emulator_BeginFloppyStream()
+struct EmulatorFloppyStream
+{
+    uint8_t* pData;         // Drive data buffer to fill; nullptr if no stream
+    uint32_t dataSize;
+    uint32_t loaded;        // Image bytes written to the buffer so far
+    bool     okZip;         // Zip archive: the local file header, then the stored or deflated file
+    uint8_t  header[30];    // Zip local file header
+    uint32_t headerBytes;   // Header bytes got so far
+    uint32_t skipBytes;     // File name and extra field bytes to skip after the header
+    uint32_t storedBytes;   // Stored file bytes left; 0xffffffff if the size is not known
+    tinfl_decompressor* pInflator;  // Inflater for the deflated file; nullptr for the stored file
+    bool     okDone;        // All the image data is there
+    bool     okFailed;      // Bad data
+};
+
+// Emulator instance: the machine and the frontend state around it.
+// Decode tables of the processor and the built-in ROM are shared by all the instances.
+struct EmulatorContext
+{
+    CMotherboard* pBoard;
+    bool okRunning;
+    uint32_t* pFrameBuffer;
+    uint32_t* pShownFrameBuffer;  // Copy of the previous render, to find the changed area
+    EmulatorStatus Status;
+    uint32_t dwUptime;  // Machine uptime, seconds, from turn on or reset, increments every 25 frames
+    long nUptimeFrameCount;
+    uint8_t KeyboardMatrix[8];
+    EmulatorInputEvent InputQueue[EMULATOR_INPUT_QUEUE_SIZE];  // Ring buffer of the events in the tick order
+    int nInputQueueHead;
+    int nInputQueueCount;
+    EmulatorFloppyStream FloppyStream[2];
+    uint8_t* pStreamChunk;  // Buffer for the next chunk of the stream, EMULATOR_STREAM_CHUNK_SIZE bytes
+    CRewindBuffer Rewind;
+    double dRewindFrameTime;  // Time spent in frames while rewind is on, ms
+    double dRewindCaptureTime;  // Time spent in rewind capture, ms
+    CRunAhead RunAhead;
+};
 
 
 //////////////////////////////////////////////////////////////////////
 
 
+// Restore the machine booted up already, instead of the cold boot: from the side-loaded "/boot.neonst" file
+// if the frontend put it there, or from the built-in boot image. Returns false if nothing was restored.
+// The side-loaded file is used once, by the first instance created.
+static bool Emulator_RestoreBootImage(EmulatorContext* ctx)
+{
+    const char * bootFileName = "/boot.neonst";
+
+    uint8_t* pFileData = nullptr;
+    uint32_t fileSize = 0;
+    FILE* fpFile = ::fopen(bootFileName, "rb");
+    if (fpFile != nullptr)
+    {
+        ::fseek(fpFile, 0, SEEK_END);
+        fileSize = (uint32_t)::ftell(fpFile);
+        ::fseek(fpFile, 0, SEEK_SET);
+        pFileData = (uint8_t*) ::malloc(fileSize);
+        if (pFileData != nullptr && ::fread(pFileData, 1, fileSize, fpFile) != fileSize)
+        {
+            ::free(pFileData);  pFileData = nullptr;
+        }
+        ::fclose(fpFile);
+        remove(bootFileName);
+    }
+
+    uint32_t uptime = 0;
+    bool okRestored = false;
+    if (pFileData != nullptr)
+    {
+        okRestored = StateImage_Load(ctx->pBoard, pFileData, fileSize, &uptime, true, true);  // Frees the data
+        if (!okRestored)
+            printf("Emulator_Create(): failed to restore the side-loaded boot image\n");
+    }
+    if (!okRestored)
+        okRestored = StateImage_Load(ctx->pBoard, boot_image, boot_image_length, &uptime, true, false);
+    if (!okRestored)
+        return false;
+
+    ctx->dwUptime = uptime;
+    ctx->nUptimeFrameCount = 0;
+    return true;
+}
+
+static void Emulator_ApplyKey(EmulatorContext* ctx, uint16_t vscan, bool pressed)
+{
+    if (pressed)
+        ctx->KeyboardMatrix[(vscan >> 8) & 7] |= (vscan & 0xff);
+    else
+        ctx->KeyboardMatrix[(vscan >> 8) & 7] &= ~(vscan & 0xff);
+
+    ctx->pBoard->UpdateKeyboardMatrix(ctx->KeyboardMatrix);
+}
+
+// Apply the queued events due at the current board tick
+static void Emulator_ApplyInputEvents(EmulatorContext* ctx)
+{
+    uint64_t ticks = ctx->pBoard->GetTicks();
+    while (ctx->nInputQueueCount > 0)
+    {
+        const EmulatorInputEvent& event = ctx->InputQueue[ctx->nInputQueueHead];
+        if (event.tick > ticks)
+            break;
+
+        if (event.isMouse)
+            ctx->pBoard->MouseMove(event.dx, event.dy, (event.buttons & 1) != 0, (event.buttons & 2) != 0);
+        else
+            Emulator_ApplyKey(ctx, event.vscan, event.pressed);
+
+        ctx->nInputQueueHead = (ctx->nInputQueueHead + 1) % EMULATOR_INPUT_QUEUE_SIZE;
+        ctx->nInputQueueCount--;
+    }
+}
+
+// Queue the event to apply in tickOffset ticks from the current board tick.
+// The events never go before the ones queued already; when the queue is full, the oldest event is applied now.
+static void Emulator_QueueInputEvent(EmulatorContext* ctx, EmulatorInputEvent& event, uint32_t tickOffset)
+{
+    event.tick = ctx->pBoard->GetTicks() + tickOffset;
+    if (ctx->nInputQueueCount > 0)
+    {
+        int last = (ctx->nInputQueueHead + ctx->nInputQueueCount - 1) % EMULATOR_INPUT_QUEUE_SIZE;
+        if (event.tick < ctx->InputQueue[last].tick)
+            event.tick = ctx->InputQueue[last].tick;
+    }
+    if (ctx->nInputQueueCount == EMULATOR_INPUT_QUEUE_SIZE)
+    {
+        ctx->InputQueue[ctx->nInputQueueHead].tick = 0;
+        Emulator_ApplyInputEvents(ctx);  // The oldest event, and the ones due already
+    }
+
+    int tail = (ctx->nInputQueueHead + ctx->nInputQueueCount) % EMULATOR_INPUT_QUEUE_SIZE;
+    ctx->InputQueue[tail] = event;
+    ctx->nInputQueueCount++;
+}
+
+static void Emulator_EndStream(EmulatorFloppyStream* pStream)
+{
+    delete pStream->pInflator;
+    ::memset(pStream, 0, sizeof(EmulatorFloppyStream));
+}
+
+// Put the chunk of the stream to the drive buffer: the raw image as it is, or the first file of the zip archive
+static void Emulator_FeedStream(EmulatorFloppyStream* pStream, const uint8_t* pChunk, uint32_t chunkSize)
+{
+    while (chunkSize > 0 && !pStream->okDone && !pStream->okFailed)
+    {
+        uint32_t room = pStream->dataSize - pStream->loaded;
+        if (!pStream->okZip || (pStream->skipBytes == 0 && pStream->headerBytes == sizeof(pStream->header) &&
+                pStream->pInflator == nullptr))  // Raw image, or the stored file
+        {
+            uint32_t bytes = chunkSize < room ? chunkSize : room;
+            if (pStream->okZip && bytes > pStream->storedBytes)
+                bytes = pStream->storedBytes;
+            ::memcpy(pStream->pData + pStream->loaded, pChunk, bytes);
+            pStream->loaded += bytes;
+            pChunk += bytes;  chunkSize -= bytes;
+            if (pStream->okZip && pStream->storedBytes != 0xffffffff)
+                pStream->storedBytes -= bytes;
+            if (pStream->loaded == pStream->dataSize || (pStream->okZip && pStream->storedBytes == 0))
+                pStream->okDone = true;  // The rest is ignored, like the image file tail
+        }
+        else if (pStream->headerBytes < sizeof(pStream->header))
+        {
+            uint32_t bytes = sizeof(pStream->header) - pStream->headerBytes;
+            if (bytes > chunkSize) bytes = chunkSize;
+            ::memcpy(pStream->header + pStream->headerBytes, pChunk, bytes);
+            pStream->headerBytes += bytes;
+            pChunk += bytes;  chunkSize -= bytes;
+            if (pStream->headerBytes < sizeof(pStream->header))
+                break;
+
+            const uint8_t* h = pStream->header;
+            uint16_t flags = h[6] | (h[7] << 8);
+            uint16_t method = h[8] | (h[9] << 8);
+            if (h[0] != 'P' || h[1] != 'K' || h[2] != 3 || h[3] != 4 || (method != 0 && method != 8))
+            {
+                pStream->okFailed = true;
+                break;
+            }
+            pStream->skipBytes = (h[26] | (h[27] << 8)) + (h[28] | (h[29] << 8));
+            pStream->storedBytes = (flags & 8) ? 0xffffffff : h[18] | (h[19] << 8) | (h[20] << 16) | ((uint32_t)h[21] << 24);
+            if (method == 8)
+            {
+                pStream->pInflator = new tinfl_decompressor;
+                tinfl_init(pStream->pInflator);
+            }
+        }
+        else if (pStream->skipBytes > 0)
+        {
+            uint32_t bytes = pStream->skipBytes < chunkSize ? pStream->skipBytes : chunkSize;
+            pStream->skipBytes -= bytes;
+            pChunk += bytes;  chunkSize -= bytes;
+        }
+        else  // Inflate straight to the drive buffer, the data before is the dictionary
+        {
+            size_t inBytes = chunkSize, outBytes = room;
+            tinfl_status status = tinfl_decompress(pStream->pInflator, pChunk, &inBytes,
+                    pStream->pData, pStream->pData + pStream->loaded, &outBytes,
+                    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF | TINFL_FLAG_HAS_MORE_INPUT);
+            pChunk += inBytes;  chunkSize -= (uint32_t)inBytes;
+            pStream->loaded += (uint32_t)outBytes;
+            if (status == TINFL_STATUS_DONE || status == TINFL_STATUS_HAS_MORE_OUTPUT)
+                pStream->okDone = true;  // The file is bigger than the disk: cut, like the image file
+            else if (status < 0)
+                pStream->okFailed = true;
+            else if (inBytes == 0 && outBytes == 0)
+                break;
+        }
+    }
+}
+
+// Run one frame; returns false if the frame stopped on a breakpoint
+static bool Emulator_RunFrame(EmulatorContext* ctx)
+{
+    ctx->pBoard->SetCPUBreakpoints(nullptr);
+
+    double startTime = emscripten_get_now();
+
+    // Split the frame at the ticks of the queued input events
+    uint64_t frameEnd = ctx->pBoard->GetTicks() / NEON_FRAME_TICKS * NEON_FRAME_TICKS + NEON_FRAME_TICKS;
+    for (;;)
+    {
+        Emulator_ApplyInputEvents(ctx);
+
+        uint64_t ticks = ctx->pBoard->GetTicks();
+        if (ticks >= frameEnd)
+            break;
+        uint64_t until = frameEnd;
+        if (ctx->nInputQueueCount > 0 && ctx->InputQueue[ctx->nInputQueueHead].tick < until)
+            until = ctx->InputQueue[ctx->nInputQueueHead].tick;
+        if (!ctx->pBoard->SystemTicks((int)(until - ticks)))
+        {
+            if (ctx->pBoard->IsRAMLoadFailed())
+            {
+                printf("Emulator_RunFrame(): the state image RAM failed to load, stopped\n");
+                ctx->okRunning = false;
+            }
+            return false;
+        }
+    }
+
+    ctx->Status.frameCount++;
+
+    // Calculate emulator uptime (25 frames per second)
+    ctx->nUptimeFrameCount++;
+    if (ctx->nUptimeFrameCount >= 25)
+    {
+        ctx->dwUptime++;
+        ctx->nUptimeFrameCount = 0;
+    }
+
+    ctx->RunAhead.Sync(ctx->pBoard);
+
+    double captureTime = emscripten_get_now();
+    if (ctx->Rewind.Frame(ctx->pBoard, ctx->dwUptime))
+    {
+        double endTime = emscripten_get_now();
+        ctx->dRewindCaptureTime += endTime - captureTime;
+        captureTime = endTime;
+    }
+    ctx->dRewindFrameTime += captureTime - startTime;
+    return true;
+}
+
+// Render the screen, and find the area changed since the previous render
+static void Emulator_RenderScreen(EmulatorContext* ctx)
+{
+    // While running, show the frame ahead with the current input, then return to the real state
+    bool okAhead = ctx->okRunning && ctx->RunAhead.Start(ctx->pBoard);
+
+    Emulator_PrepareScreenRGB32(ctx->pBoard, ctx->pFrameBuffer);
+
+    if (okAhead)
+        ctx->RunAhead.Rollback(ctx->pBoard);
+
+    int left = NEON_SCREEN_WIDTH, right = 0, top = NEON_SCREEN_HEIGHT, bottom = 0;
+    for (int y = 0; y < NEON_SCREEN_HEIGHT; y++)
+    {
+        const uint32_t* pLine = ctx->pFrameBuffer + y * NEON_SCREEN_WIDTH;
+        uint32_t* pShownLine = ctx->pShownFrameBuffer + y * NEON_SCREEN_WIDTH;
+        if (::memcmp(pLine, pShownLine, NEON_SCREEN_WIDTH * sizeof(uint32_t)) == 0)
+            continue;
+
+        int x0 = 0, x1 = NEON_SCREEN_WIDTH;
+        while (pLine[x0] == pShownLine[x0]) x0++;
+        while (pLine[x1 - 1] == pShownLine[x1 - 1]) x1--;
+        ::memcpy(pShownLine + x0, pLine + x0, (x1 - x0) * sizeof(uint32_t));
+
+        if (x0 < left) left = x0;
+        if (x1 > right) right = x1;
+        if (y < top) top = y;
+        bottom = y + 1;
+    }
+
+    ctx->Status.rendered = 1;
+    if (bottom > 0)
+    {
+        ctx->Status.dirtyX = left;  ctx->Status.dirtyWidth = right - left;
+        ctx->Status.dirtyY = top;  ctx->Status.dirtyHeight = bottom - top;
+    }
+    else
+        ctx->Status.dirtyX = ctx->Status.dirtyY = ctx->Status.dirtyWidth = ctx->Status.dirtyHeight = 0;
+}
+
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+    // Initialize the data shared by all the instances; Emulator_Create() calls it if needed
     EMSCRIPTEN_KEEPALIVE void Emulator_Init()
     {
+        if (g_okEmulatorInitialized)
+            return;
+
         printf("NeonBTL WASM built with Emscripten "
                 STRINGIZE(__EMSCRIPTEN_major__) "." STRINGIZE(__EMSCRIPTEN_minor__) "." STRINGIZE(__EMSCRIPTEN_tiny__)
                 " at " __DATE__ "\n");
 
-        ::memset(m_KeyboardMatrix, 0, sizeof(m_KeyboardMatrix));
+        StateImage_AddKnownRom((const uint8_t*)pk11_rom);  // Built-in ROM is not saved in state images
 
-        g_pFrameBuffer = (uint32_t*)malloc(NEON_SCREEN_WIDTH * NEON_SCREEN_HEIGHT * sizeof(uint32_t));
+        g_okEmulatorInitialized = true;
+    }
+
+    // Set the number of threads compressing and decompressing the state image RAM chunks, for all the instances;
+    // 1 = the caller thread only, the default. The build without -pthread stays on the caller thread.
+    EMSCRIPTEN_KEEPALIVE void Emulator_SetStateThreads(int count)
+    {
+        printf("Emulator_SetStateThreads(%d)\n", count);
+        StateImage_SetThreadCount(count);
+    }
 
-        ASSERT(g_pBoard == NULL);
+    // Create the emulator instance, with the machine booted up already; returns nullptr on failure
+    EMSCRIPTEN_KEEPALIVE EmulatorContext* Emulator_Create()
+    {
+        Emulator_Init();
+
+        EmulatorContext* ctx = new EmulatorContext();
+        ctx->pFrameBuffer = (uint32_t*)malloc(NEON_SCREEN_WIDTH * NEON_SCREEN_HEIGHT * sizeof(uint32_t));
+        // Zeroes never match the opaque pixels, so the first render is dirty all over
+        ctx->pShownFrameBuffer = (uint32_t*)calloc(NEON_SCREEN_WIDTH * NEON_SCREEN_HEIGHT, sizeof(uint32_t));
+        if (ctx->pFrameBuffer == nullptr || ctx->pShownFrameBuffer == nullptr)
+        {
+            ::free(ctx->pFrameBuffer);
+            ::free(ctx->pShownFrameBuffer);
+            delete ctx;
+            printf("Emulator_Create(): malloc failed\n");
+            return nullptr;
+        }
 
         CProcessor::Init();
 
-        g_pBoard = new CMotherboard();
+        ctx->pBoard = new CMotherboard();
 
         NeonConfiguration configuration = (NeonConfiguration)1024;
-        g_pBoard->SetConfiguration((uint16_t)configuration);
+        ctx->pBoard->SetConfiguration((uint16_t)configuration);
 
-        g_pBoard->Reset();
+        ctx->pBoard->Reset();
 
-        g_pBoard->LoadROM((const uint8_t*)pk11_rom);
+        ctx->pBoard->SetSharedROM((const uint8_t*)pk11_rom);
 
-        g_pBoard->Reset();
+        if (Emulator_RestoreBootImage(ctx))
+            printf("Emulator_Create(): boot image restored\n");
+        else
+            ctx->pBoard->Reset();
 
-        g_okEmulatorInitialized = true;
+        return ctx;
     }
 
-    EMSCRIPTEN_KEEPALIVE float Emulator_GetUptime()
+    EMSCRIPTEN_KEEPALIVE void Emulator_Destroy(EmulatorContext* ctx)
     {
-        return m_dwEmulatorUptime + m_nUptimeFrameCount / 25.0;
+        if (ctx == nullptr)
+            return;
+
+        delete ctx->pBoard;
+        CProcessor::Done();
+        ::free(ctx->pFrameBuffer);
+        ::free(ctx->pShownFrameBuffer);
+        for (int slot = 0; slot < 2; slot++)
+            Emulator_EndStream(ctx->FloppyStream + slot);
+        ::free(ctx->pStreamChunk);
+        delete ctx;
     }
 
-    EMSCRIPTEN_KEEPALIVE uint16_t Emulator_GetReg()
+    EMSCRIPTEN_KEEPALIVE float Emulator_GetUptime(EmulatorContext* ctx)
     {
-        return g_pBoard->GetCPU()->GetPC();
+        return ctx->dwUptime + ctx->nUptimeFrameCount / 25.0;
     }
 
-    EMSCRIPTEN_KEEPALIVE void Emulator_Start()
+    EMSCRIPTEN_KEEPALIVE uint16_t Emulator_GetReg(EmulatorContext* ctx)
+    {
+        return ctx->pBoard->GetCPU()->GetPC();
+    }
+
+    EMSCRIPTEN_KEEPALIVE void Emulator_Start(EmulatorContext* ctx)
     {
         printf("Emulator_Start()\n");
 
-        g_okEmulatorRunning = true;
+        ctx->okRunning = true;
     }
-    EMSCRIPTEN_KEEPALIVE void Emulator_Stop()
+    EMSCRIPTEN_KEEPALIVE void Emulator_Stop(EmulatorContext* ctx)
     {
         printf("Emulator_Stop()\n");
 
-        g_okEmulatorRunning = false;
+        ctx->okRunning = false;
     }
 
-    EMSCRIPTEN_KEEPALIVE void Emulator_Reset()
+    EMSCRIPTEN_KEEPALIVE void Emulator_Reset(EmulatorContext* ctx)
     {
         printf("Emulator_Reset()\n");
 
-        ASSERT(g_pBoard != NULL);
+        ASSERT(ctx->pBoard != NULL);
 
-        g_pBoard->Reset();
+        ctx->pBoard->Reset();
     }
 
     EMSCRIPTEN_KEEPALIVE void Emulator_Unzip(const char* archivename, const char* filename)
@@ -137,9 +504,10 @@ extern "C" {
         remove(archivename);
     }
 
-    EMSCRIPTEN_KEEPALIVE void Emulator_DetachFloppyImage(int slot)
+    EMSCRIPTEN_KEEPALIVE void Emulator_DetachFloppyImage(EmulatorContext* ctx, int slot)
     {
-        g_pBoard->DetachFloppyImage(slot);
+        Emulator_EndStream(ctx->FloppyStream + slot);
+        ctx->pBoard->DetachFloppyImage(slot);
 
         char buffer[6];
         buffer[0] = '/';
@@ -151,7 +519,7 @@ extern "C" {
 
         remove(buffer);
     }
-    EMSCRIPTEN_KEEPALIVE void Emulator_AttachFloppyImage(int slot)
+    EMSCRIPTEN_KEEPALIVE void Emulator_AttachFloppyImage(EmulatorContext* ctx, int slot)
     {
         char buffer[6];
         buffer[0] = '/';
@@ -161,64 +529,281 @@ extern "C" {
         buffer[4] = slot + '0';
         buffer[5] = 0;
 
-        g_pBoard->AttachFloppyImage(slot, buffer);
+        ctx->pBoard->AttachFloppyImage(slot, buffer);
     }
 
-    EMSCRIPTEN_KEEPALIVE void Emulator_SystemFrame()
+    // Attach the floppy image coming in chunks, e.g. while downloaded; the chunks go straight to the drive
+    // buffer, with no files in between. The machine could boot before the whole image is there:
+    // the drive waits for the tracks not loaded yet. okZip: the stream is the zip archive,
+    // the image is the only file there, stored or deflated. Returns false on failure.
+    EMSCRIPTEN_KEEPALIVE bool Emulator_BeginFloppyStream(EmulatorContext* ctx, int slot, bool okZip)
     {
-        //printf("Emulator_SystemFrame()\n");
+        Emulator_DetachFloppyImage(ctx, slot);
 
-        g_pBoard->SetCPUBreakpoints(nullptr);
+        if (ctx->pStreamChunk == nullptr)
+            ctx->pStreamChunk = (uint8_t*)::malloc(EMULATOR_STREAM_CHUNK_SIZE);
+        EmulatorFloppyStream* pStream = ctx->FloppyStream + slot;
+        pStream->pData = ctx->pBoard->AttachFloppyStream(slot, &pStream->dataSize);
+        if (ctx->pStreamChunk == nullptr || pStream->pData == nullptr)
+        {
+            printf("Emulator_BeginFloppyStream(): failed to attach\n");
+            Emulator_DetachFloppyImage(ctx, slot);
+            return false;
+        }
+        pStream->okZip = okZip;
+        return true;
+    }
+
+    // Buffer to put the next chunk of the stream to, EMULATOR_STREAM_CHUNK_SIZE bytes
+    EMSCRIPTEN_KEEPALIVE uint8_t* Emulator_GetStreamChunkBuffer(EmulatorContext* ctx)
+    {
+        return ctx->pStreamChunk;
+    }
 
-        //TODO: Keyboard
-        //TODO: Mouse
+    EMSCRIPTEN_KEEPALIVE uint32_t Emulator_GetStreamChunkSize()
+    {
+        return EMULATOR_STREAM_CHUNK_SIZE;
+    }
 
-        if (!g_pBoard->SystemFrame())
-            return;
+    // Feed the next chunk of the stream, chunkSize bytes put to the chunk buffer; returns false on bad data
+    EMSCRIPTEN_KEEPALIVE bool Emulator_FeedFloppyStream(EmulatorContext* ctx, int slot, uint32_t chunkSize)
+    {
+        EmulatorFloppyStream* pStream = ctx->FloppyStream + slot;
+        if (pStream->pData == nullptr || chunkSize > EMULATOR_STREAM_CHUNK_SIZE)
+            return false;
+
+        Emulator_FeedStream(pStream, ctx->pStreamChunk, chunkSize);
+        ctx->pBoard->SetFloppyStreamLoaded(slot, pStream->loaded, pStream->okDone);
+        return !pStream->okFailed;
+    }
+
+    // The stream is over. Returns false if the image is bad or incomplete, then it is detached.
+    EMSCRIPTEN_KEEPALIVE bool Emulator_EndFloppyStream(EmulatorContext* ctx, int slot)
+    {
+        EmulatorFloppyStream* pStream = ctx->FloppyStream + slot;
+        if (pStream->pData == nullptr)
+            return false;
 
-        // Calculate emulator uptime (25 frames per second)
-        m_nUptimeFrameCount++;
-        if (m_nUptimeFrameCount >= 25)
+        bool okComplete = !pStream->okFailed && (pStream->okDone || !pStream->okZip);
+        Emulator_EndStream(pStream);
+        if (!okComplete)
         {
-            m_dwEmulatorUptime++;
-            m_nUptimeFrameCount = 0;
+            printf("Emulator_EndFloppyStream(): bad or incomplete image\n");
+            Emulator_DetachFloppyImage(ctx, slot);
+            return false;
         }
+
+        ctx->pBoard->SetFloppyStreamLoaded(slot, 0, true);
+        return true;
     }
 
-    EMSCRIPTEN_KEEPALIVE void* Emulator_PrepareScreen()
+    // Attach the floppy image from the buffer in the module memory, e.g. put there by _malloc() and HEAPU8.set(),
+    // with no MEMFS file in between; the drive reads and writes the buffer in place. okTakeOwnership: the buffer
+    // is malloc'ed and is given to the drive, freed on detach, or at once on failure; otherwise the buffer should
+    // cover the whole disk and should stay until detach. Returns false on failure.
+    EMSCRIPTEN_KEEPALIVE bool Emulator_AttachFloppyBuffer(EmulatorContext* ctx, int slot, uint8_t* pData, uint32_t dataSize, bool okTakeOwnership)
     {
-        //printf("Emulator_PrepareScreen()\n");
-        if (g_pFrameBuffer == 0)
+        Emulator_DetachFloppyImage(ctx, slot);
+
+        if (!ctx->pBoard->AttachFloppyBuffer(slot, pData, dataSize, okTakeOwnership))
+        {
+            printf("Emulator_AttachFloppyBuffer(): failed to attach\n");
+            if (okTakeOwnership)
+                ::free(pData);
+            return false;
+        }
+        return true;
+    }
+
+    // Attach the hard disk image from the buffer in the module memory, see Emulator_AttachFloppyBuffer()
+    EMSCRIPTEN_KEEPALIVE bool Emulator_AttachHardBuffer(EmulatorContext* ctx, uint8_t* pData, uint32_t dataSize, bool okTakeOwnership)
+    {
+        if (!ctx->pBoard->AttachHardBuffer(pData, dataSize, okTakeOwnership))
+        {
+            printf("Emulator_AttachHardBuffer(): failed to attach\n");
+            if (okTakeOwnership)
+                ::free(pData);
+            return false;
+        }
+        return true;
+    }
+
+    EMSCRIPTEN_KEEPALIVE void Emulator_DetachHardImage(EmulatorContext* ctx)
+    {
+        ctx->pBoard->DetachHardImage();
+    }
+
+    // Get the part of the buffer-backed disk image written since the previous call, to persist it, e.g. to IndexedDB.
+    // disk: 0..1 floppy, 2 hard disk. pRange gets the offset and the length of the written part;
+    // returns the pointer to the written data, valid till the next call, or nullptr if nothing written.
+    EMSCRIPTEN_KEEPALIVE const uint8_t* Emulator_TakeDiskDirtyRange(EmulatorContext* ctx, int disk, uint32_t* pRange)
+    {
+        uint32_t start, end;
+        const uint8_t* pData = (disk < 2) ?
+                ctx->pBoard->TakeFloppyDirtyRange(disk, &start, &end) :
+                ctx->pBoard->TakeHardDirtyRange(&start, &end);
+        if (pData == nullptr)
+            return nullptr;
+
+        pRange[0] = start;
+        pRange[1] = end - start;
+        return pData;
+    }
+
+    EMSCRIPTEN_KEEPALIVE void Emulator_SystemFrame(EmulatorContext* ctx)
+    {
+        //printf("Emulator_SystemFrame()\n");
+
+        Emulator_RunFrame(ctx);
+    }
+
+    // Run N frames, then render the screen if EMULATOR_RUNFRAMES_RENDER flag given, all in one call;
+    // stops early on a breakpoint. Returns the status, the same address every call, see EmulatorStatus.
+    EMSCRIPTEN_KEEPALIVE EmulatorStatus* Emulator_RunFrames(EmulatorContext* ctx, int frames, int flags)
+    {
+        for (int i = 0; i < frames; i++)
+        {
+            if (!Emulator_RunFrame(ctx))
+                break;
+        }
+
+        if (flags & EMULATOR_RUNFRAMES_RENDER)
+            Emulator_RenderScreen(ctx);
+        else
         {
-            printf("Emulator_PrepareScreen() null framebuffer\n");
-            return g_pFrameBuffer;
+            ctx->Status.rendered = 0;
+            ctx->Status.dirtyX = ctx->Status.dirtyY = ctx->Status.dirtyWidth = ctx->Status.dirtyHeight = 0;
         }
 
-        Emulator_PrepareScreenRGB32(g_pFrameBuffer);
+        ctx->Status.frameBuffer = (uint32_t)(uintptr_t)ctx->pFrameBuffer;
+        ctx->Status.uptime = ctx->dwUptime * 1000 + ctx->nUptimeFrameCount * 40;
+        ctx->Status.diskActivity = ctx->pBoard->IsFloppyEngineOn() ? 1 : 0;
+        ctx->Status.audioFill = 0;
+        return &ctx->Status;
+    }
+
+    // Turn rewind on/off: memory budget in MB, 0 = off; capture the state every N frames
+    EMSCRIPTEN_KEEPALIVE void Emulator_SetRewind(EmulatorContext* ctx, int budgetMB, int interval)
+    {
+        printf("Emulator_SetRewind(%d, %d)\n", budgetMB, interval);
+        ctx->Rewind.SetParams((uint32_t)budgetMB * 1024 * 1024, interval, 25);
+        ctx->dRewindFrameTime = ctx->dRewindCaptureTime = 0.0;
+    }
+
+    // Step backwards to the previous captured state; returns false if there is nothing to rewind to
+    EMSCRIPTEN_KEEPALIVE bool Emulator_RewindStep(EmulatorContext* ctx)
+    {
+        uint32_t uptime = 0;
+        if (!ctx->Rewind.StepBack(ctx->pBoard, &uptime))
+            return false;
+
+        ctx->dwUptime = uptime;
+        ctx->nUptimeFrameCount = 0;
+        ctx->RunAhead.Invalidate();
+        return true;
+    }
+
+    // Rewind capture time, percent of the frame time
+    EMSCRIPTEN_KEEPALIVE double Emulator_GetRewindOverhead(EmulatorContext* ctx)
+    {
+        if (ctx->dRewindFrameTime <= 0.0)
+            return 0.0;
+        return ctx->dRewindCaptureTime * 100.0 / ctx->dRewindFrameTime;
+    }
+
+    // Turn run-ahead on/off: present the frame emulated N frames ahead, to cut the input lag; 0 = off
+    EMSCRIPTEN_KEEPALIVE void Emulator_SetRunAhead(EmulatorContext* ctx, int frames)
+    {
+        printf("Emulator_SetRunAhead(%d)\n", frames);
+        ctx->RunAhead.SetFrames(frames);
+    }
+
+    // Turn fast disk mode on/off: the guest loops reading the disk buffer run at once, see CMotherboard::SetFastDiskMode()
+    EMSCRIPTEN_KEEPALIVE void Emulator_SetFastDisk(EmulatorContext* ctx, bool okFast)
+    {
+        ctx->pBoard->SetFastDiskMode(okFast);
+    }
+
+    EMSCRIPTEN_KEEPALIVE void* Emulator_PrepareScreen(EmulatorContext* ctx)
+    {
+        //printf("Emulator_PrepareScreen()\n");
+
+        Emulator_RenderScreen(ctx);
 
-        return (void*)g_pFrameBuffer;
+        return (void*)ctx->pFrameBuffer;
     }
 
-    EMSCRIPTEN_KEEPALIVE void Emulator_KeyEvent(uint16_t vscan, bool pressed)
+    EMSCRIPTEN_KEEPALIVE void Emulator_KeyEvent(EmulatorContext* ctx, uint16_t vscan, bool pressed)
     {
         if (pressed)
             printf("Emulator_KeyEvent(%03x, %d)\n", vscan, pressed);
         if (vscan == 0)
             return;
 
-        if (pressed)
-            m_KeyboardMatrix[(vscan >> 8) & 7] |= (vscan & 0xff);
-        else
-            m_KeyboardMatrix[(vscan >> 8) & 7] &= ~(vscan & 0xff);
+        Emulator_ApplyKey(ctx, vscan, pressed);
+    }
+
+    // Queue the key event to apply in tickOffset board ticks from now, NEON_FRAME_TICKS per frame.
+    // Between the frames "now" is the start of the next frame, so the key lands inside the frame
+    // at the time it came, and the scripted keys land at the same ticks every run.
+    EMSCRIPTEN_KEEPALIVE void Emulator_QueueKeyEvent(EmulatorContext* ctx, uint16_t vscan, bool pressed, uint32_t tickOffset)
+    {
+        if (vscan == 0)
+            return;
 
-        g_pBoard->UpdateKeyboardMatrix(m_KeyboardMatrix);
+        EmulatorInputEvent event = {};
+        event.vscan = vscan;
+        event.pressed = pressed;
+        Emulator_QueueInputEvent(ctx, event, tickOffset);
     }
 
-    EMSCRIPTEN_KEEPALIVE void Emulator_LoadImage()
+    // Queue the mouse move to apply in tickOffset board ticks from now, see Emulator_QueueKeyEvent();
+    // buttons: bit 0 left, bit 1 right
+    EMSCRIPTEN_KEEPALIVE void Emulator_QueueMouseEvent(EmulatorContext* ctx, int dx, int dy, int buttons, uint32_t tickOffset)
     {
-        const char * imageFileName = "/image";
+        EmulatorInputEvent event = {};
+        event.isMouse = true;
+        event.dx = (short)dx;
+        event.dy = (short)dy;
+        event.buttons = (uint8_t)buttons;
+        Emulator_QueueInputEvent(ctx, event, tickOffset);
+    }
+
+    // Set the whole keyboard matrix, 8 bytes, for the frontend keeping the matrix on its side
+    EMSCRIPTEN_KEEPALIVE void Emulator_SetKeyboardMatrix(EmulatorContext* ctx, const uint8_t* matrix)
+    {
+        ::memcpy(ctx->KeyboardMatrix, matrix, sizeof(ctx->KeyboardMatrix));
+
+        ctx->pBoard->UpdateKeyboardMatrix(ctx->KeyboardMatrix);
+    }
+
+    // Load emulator state from the .neonst image in memory. The buffer is malloc'ed, e.g. by _malloc(), and is given
+    // to the emulator: RAM of the version 2.0 image is decompressed lazily, chunk by chunk, on the first access,
+    // right from the buffer; the buffer is freed after that, or at once on failure.
+    EMSCRIPTEN_KEEPALIVE bool Emulator_LoadImageBuffer(EmulatorContext* ctx, uint8_t* pData, uint32_t dataSize)
+    {
+        Emulator_Stop(ctx);
 
-        Emulator_Stop();
+        uint32_t uptime = 0;
+        if (!StateImage_Load(ctx->pBoard, pData, dataSize, &uptime, true, true))
+        {
+            printf("Emulator_LoadImage(): failed to load the emulator state\n");
+            return false;
+        }
+
+        ctx->dwUptime = uptime;
+        ctx->nUptimeFrameCount = 0;
+        ctx->Rewind.Clear();  // The captured states are not related to the loaded one
+        ctx->RunAhead.Invalidate();
+
+        printf("Emulator_LoadImage() done\n");
+        return true;
+    }
+
+    // Load emulator state from the "/image" file
+    EMSCRIPTEN_KEEPALIVE void Emulator_LoadImage(EmulatorContext* ctx)
+    {
+        const char * imageFileName = "/image";
 
         // Open file
         FILE* fpFile = ::fopen(imageFileName, "rb");
@@ -229,68 +814,52 @@ extern "C" {
             return;
         }
 
-        // Read header
-        uint32_t bufHeader[32 / sizeof(uint32_t)];
-        uint32_t dwBytesRead = ::fread(bufHeader, 1, 32, fpFile);
-        if (dwBytesRead != 32)
-        {
-            ::fclose(fpFile);
-            remove(imageFileName);
-            printf("Emulator_LoadImage(): failed to read file\n");
-            return;
-        }
-
         // Allocate memory
-        int compressedSize = (int)bufHeader[5];
-        void* pCompressBuffer = ::calloc(compressedSize, 1);
-        if (pCompressBuffer == nullptr)
+        ::fseek(fpFile, 0, SEEK_END);
+        uint32_t fileSize = (uint32_t)::ftell(fpFile);
+        ::fseek(fpFile, 0, SEEK_SET);
+        uint8_t* pFileData = (uint8_t*) ::malloc(fileSize);
+        if (pFileData == nullptr)
         {
             ::fclose(fpFile);
             remove(imageFileName);
-            printf("Emulator_LoadImage(): calloc failed\n");
+            printf("Emulator_LoadImage(): malloc failed\n");
             return;
         }
 
         // Read image
-        dwBytesRead = ::fread(pCompressBuffer, 1, compressedSize, fpFile);
+        uint32_t dwBytesRead = ::fread(pFileData, 1, fileSize, fpFile);
         ::fclose(fpFile);
         remove(imageFileName);
-        if (dwBytesRead != compressedSize)
+        if (dwBytesRead != fileSize)
         {
-            ::free(pCompressBuffer);
+            ::free(pFileData);
             printf("Emulator_LoadImage(): failed to read file\n");
             return;
         }
 
-        uint32_t stateSize = bufHeader[3];
-        uint8_t* pImage = (uint8_t*) ::calloc(stateSize, 1);
-        if (pImage == nullptr)
-        {
-            printf("Emulator_LoadImage(): calloc failed\n");
-            return;
-        }
+        Emulator_LoadImageBuffer(ctx, pFileData, fileSize);  // Frees the data
+    }
 
-        // Decompress the state body
-        int decompressedSize = LZ4_decompress_safe(
-                (const char*)pCompressBuffer, (char*)(pImage + 32), compressedSize, (int)stateSize - 32);
-        if (decompressedSize <= 0)
+    // Get the buffer size enough for Emulator_SaveImage()
+    EMSCRIPTEN_KEEPALIVE uint32_t Emulator_GetImageMaxSize(EmulatorContext* ctx)
+    {
+        return StateImage_GetMaxSize(ctx->pBoard);
+    }
+
+    // Save emulator state to the buffer as the .neonst image, version 2.0.
+    // Returns the image size, or 0 on failure.
+    EMSCRIPTEN_KEEPALIVE uint32_t Emulator_SaveImage(EmulatorContext* ctx, uint8_t* pBuffer, uint32_t bufferSize)
+    {
+        uint32_t imageSize = StateImage_Save(ctx->pBoard, ctx->dwUptime, pBuffer, bufferSize);
+        if (imageSize == 0)
         {
-            printf("Failed to decompress the emulator state.");
-            ::free(pCompressBuffer);
-            ::free(pImage);
-            return;
+            printf("Emulator_SaveImage(): failed to save the emulator state\n");
+            return 0;
         }
-        memcpy(pImage, bufHeader, 32);
-
-        // Restore emulator state from the image
-        g_pBoard->LoadFromImage(pImage);
 
-        m_dwEmulatorUptime = bufHeader[4];
-
-        // Free memory
-        ::free(pCompressBuffer);
-        ::free(pImage);
-        printf("Emulator_LoadImage() done\n");
+        printf("Emulator_SaveImage() done, %u bytes\n", imageSize);
+        return imageSize;
     }
 
 #ifdef __cplusplus
@@ -303,456 +872,4 @@ int main()
 }
 
 
-uint32_t Color16Convert(uint16_t color)
-{
-    return (0xff000000 |
-            ((uint32_t)((color & 0x0300) >> 2 | (color & 0x0007) << 3 | (color & 0x0300) >> 7)) << 16 | // R
-            ((uint32_t)((color & 0xe000) >> 8 | (color & 0x00e0) >> 3 | (color & 0xC000) >> 14)) << 8 | // G
-            ((uint32_t)((color & 0x1C00) >> 5 | (color & 0x0018) | (color & 0x1C00) >> 10))             // B
-    );
-}
-
-#define FILL1PIXEL(color) { *plinebits++ = color; }
-#define FILL2PIXELS(color) { *plinebits++ = color; *plinebits++ = color; }
-#define FILL4PIXELS(color) { *plinebits++ = color; *plinebits++ = color; *plinebits++ = color; *plinebits++ = color; }
-#define FILL8PIXELS(color) { \
-    *plinebits++ = color; *plinebits++ = color; *plinebits++ = color; *plinebits++ = color; \
-    *plinebits++ = color; *plinebits++ = color; *plinebits++ = color; *plinebits++ = color; \
-}
-// Выражение для получения 16-разрядного цвета из палитры; pala = адрес старшего байта
-#define GETPALETTEHILO(pala) ((uint16_t)(pBoard->GetRAMByteView(pala) << 8) | pBoard->GetRAMByteView((pala) + 256))
-
-void Emulator_PrepareScreenRGB32(uint32_t* pImageBits)
-{
-    if (pImageBits == nullptr || g_pBoard == nullptr) return;
-
-    uint32_t linebits[NEON_SCREEN_WIDTH];  // буфер под строку
-
-    const CMotherboard* pBoard = g_pBoard;
-
-    uint16_t vdptaslo = pBoard->GetRAMWordView(0000010);  // VDPTAS
-    uint16_t vdptashi = pBoard->GetRAMWordView(0000012);  // VDPTAS
-    uint16_t vdptaplo = pBoard->GetRAMWordView(0000004);  // VDPTAP
-    uint16_t vdptaphi = pBoard->GetRAMWordView(0000006);  // VDPTAP
-
-    uint32_t tasaddr = (((uint32_t)vdptaslo) << 2) | (((uint32_t)(vdptashi & 0x000f)) << 18);
-    uint32_t tapaddr = (((uint32_t)vdptaplo) << 2) | (((uint32_t)(vdptaphi & 0x000f)) << 18);
-    uint16_t pal0 = GETPALETTEHILO(tapaddr);
-    uint32_t colorBorder = Color16Convert(pal0);  // Глобальный цвет бордюра
-
-    for (int line = 0; line < NEON_SCREEN_HEIGHT; line++)  // Цикл по строкам 0..299
-    {
-        uint16_t linelo = pBoard->GetRAMWordView(tasaddr);
-        uint16_t linehi = pBoard->GetRAMWordView(tasaddr + 2);
-        tasaddr += 4;
-
-        uint32_t* plinebits = linebits;
-        uint32_t lineaddr = (((uint32_t)linelo) << 2) | (((uint32_t)(linehi & 0x000f)) << 18);
-        bool firstOtr = true;  // Признак первого отрезка в строке
-        uint32_t colorbprev = 0;  // Цвет бордюра предыдущего отрезка
-        int bar = 52;  // Счётчик полосок от 52 к 0
-        for (;;)  // Цикл по видеоотрезкам строки, до полного заполнения строки
-        {
-            uint16_t otrlo = pBoard->GetRAMWordView(lineaddr);
-            uint16_t otrhi = pBoard->GetRAMWordView(lineaddr + 2);
-            lineaddr += 4;
-            // Получаем параметры отрезка
-            int otrcount = 32 - (otrhi >> 10) & 037;  // Длина отрезка в 32-разрядных словах
-            if (otrcount == 0) otrcount = 32;
-            uint32_t otraddr = (((uint32_t)otrlo) << 2) | (((uint32_t)otrhi & 0x000f) << 18);
-            uint16_t otrvn = (otrhi >> 6) & 3;  // VN1 VN0 - бит/точку
-            bool otrpb = (otrhi & 0x8000) != 0;
-            uint16_t vmode = (otrhi >> 6) & 0x0f;  // биты VD1 VD0 VN1 VN0
-            // Получить адрес палитры
-            uint32_t paladdr = tapaddr;
-            if (otrvn == 3 && otrpb)  // Многоцветный режим
-            {
-                paladdr += (otrhi & 0x10) ? 1024 + 512 : 1024;
-            }
-            else
-            {
-                paladdr += (otrpb ? 512 : 0) + (otrvn * 64);
-                uint32_t otrpn = (otrhi >> 4) & 3;  // PN1 PN0 - номер палитры
-                paladdr += otrpn * 16;
-            }
-            // Бордюр
-            uint16_t palbhi = pBoard->GetRAMWordView(paladdr);
-            uint16_t palblo = pBoard->GetRAMWordView(paladdr + 256);
-            uint32_t colorb = Color16Convert((uint16_t)((palbhi & 0xff) << 8 | (palblo & 0xff)));
-            if (!firstOtr)  // Это не первый отрезок - будет бордюр, цвета по пикселям: AAAAAAAAABBCCCCC
-            {
-                FILL8PIXELS(colorbprev)  FILL1PIXEL(colorbprev)
-                FILL2PIXELS(colorBorder)
-                FILL4PIXELS(colorb)  FILL1PIXEL(colorb)
-                bar--;  if (bar == 0) break;
-            }
-            colorbprev = colorb;  // Запоминаем цвет бордюра
-            // Определяем, сколько 16-пиксельных полосок нужно заполнить
-            int barcount = otrcount * 2;
-            if (!firstOtr) barcount--;
-            if (barcount > bar) barcount = bar;
-            bar -= barcount;
-            // Заполняем отрезок
-            if (vmode == 0)  // VM1, плотность видео-строки 52 байта, со сдвигом влево на 2 байта
-            {
-                uint16_t pal14hi = pBoard->GetRAMWordView(paladdr + 14);
-                uint16_t pal14lo = pBoard->GetRAMWordView(paladdr + 14 + 256);
-                uint32_t color0 = Color16Convert((uint16_t)((pal14hi & 0xff) << 8 | (pal14lo & 0xff)));
-                uint32_t color1 = Color16Convert((uint16_t)((pal14hi & 0xff00) | (pal14lo & 0xff00) >> 8));
-                while (barcount > 0)
-                {
-                    uint16_t bits = pBoard->GetRAMByteView(otraddr);
-                    otraddr++;
-                    for (uint16_t k = 0; k < 8; k++)
-                    {
-                        uint32_t color = (bits & 1) ? color1 : color0;
-                        FILL2PIXELS(color)
-                        bits = bits >> 1;
-                    }
-                    barcount--;
-                }
-            }
-            else if (vmode == 1)  // VM2, плотность видео-строки 52 байта
-            {
-                while (barcount > 0)
-                {
-                    uint8_t bits = pBoard->GetRAMByteView(otraddr);  // читаем байт - выводим 16 пикселей
-                    otraddr++;
-                    uint32_t palc = paladdr + (bits & 3);
-                    uint16_t c = GETPALETTEHILO(palc);
-                    uint32_t color = Color16Convert(c);
-                    FILL4PIXELS(color)
-                    palc = paladdr + ((bits >> 2) & 3);
-                    c = GETPALETTEHILO(palc);
-                    color = Color16Convert(c);
-                    FILL4PIXELS(color)
-                    palc = paladdr + ((bits >> 4) & 3);
-                    c = GETPALETTEHILO(palc);
-                    color = Color16Convert(c);
-                    FILL4PIXELS(color)
-                    palc = paladdr + (bits >> 6);
-                    c = GETPALETTEHILO(palc);
-                    color = Color16Convert(c);
-                    FILL4PIXELS(color)
-                    barcount--;
-                }
-            }
-            else if (vmode == 2 || vmode == 6 ||
-                    vmode == 3 && !otrpb ||
-                    vmode == 7 && !otrpb)  // VM4, плотность видео-строки 52 байта
-            {
-                while (barcount > 0)
-                {
-                    uint8_t bits = pBoard->GetRAMByteView(otraddr);  // читаем байт - выводим 16 пикселей
-                    otraddr++;
-                    uint32_t palc = paladdr + (bits & 15);
-                    uint16_t c = GETPALETTEHILO(palc);
-                    uint32_t color = Color16Convert(c);
-                    FILL8PIXELS(color)
-                    palc = paladdr + (bits >> 4);
-                    c = GETPALETTEHILO(palc);
-                    color = Color16Convert(c);
-                    FILL8PIXELS(color)
-                    barcount--;
-                }
-            }
-            else if (vmode == 3 && otrpb ||
-                    vmode == 7 && otrpb)  // VM8, плотность видео-строки 52 байта
-            {
-                while (barcount > 0)
-                {
-                    uint8_t bits = pBoard->GetRAMByteView(otraddr);  // читаем байт - выводим 16 пикселей
-                    otraddr++;
-                    uint32_t palc = paladdr + bits;
-                    uint16_t c = GETPALETTEHILO(palc);
-                    uint32_t color = Color16Convert(c);
-                    FILL8PIXELS(color)
-                    FILL8PIXELS(color)
-                    barcount--;
-                }
-            }
-            else if (vmode == 4)  // VM1, плотность видео-строки 52 байта
-            {
-                uint16_t pal14hi = pBoard->GetRAMWordView(paladdr + 14);
-                uint16_t pal14lo = pBoard->GetRAMWordView(paladdr + 14 + 256);
-                uint32_t color0 = Color16Convert((uint16_t)((pal14hi & 0xff) << 8 | (pal14lo & 0xff)));
-                uint32_t color1 = Color16Convert((uint16_t)((pal14hi & 0xff00) | (pal14lo & 0xff00) >> 8));
-                while (barcount > 0)
-                {
-                    uint16_t bits = pBoard->GetRAMWordView(otraddr & ~1);
-                    if (otraddr & 1) bits = bits >> 8;
-                    otraddr++;
-                    for (uint16_t k = 0; k < 8; k++)
-                    {
-                        uint32_t color = (bits & 1) ? color1 : color0;
-                        FILL2PIXELS(color)
-                        bits = bits >> 1;
-                    }
-                    barcount--;
-                }
-            }
-            else if (vmode == 5)  // VM2, плотность видео-строки 52 байта
-            {
-                while (barcount > 0)
-                {
-                    uint8_t bits = pBoard->GetRAMByteView(otraddr);  // читаем байт - выводим 16 пикселей
-                    otraddr++;
-                    uint32_t palc0 = (paladdr + 12 + (bits & 3));
-                    uint16_t c0 = GETPALETTEHILO(palc0);
-                    uint32_t color0 = Color16Convert(c0);
-                    FILL4PIXELS(color0)
-                    uint32_t palc1 = (paladdr + 12 + ((bits >> 2) & 3));
-                    uint16_t c1 = GETPALETTEHILO(palc1);
-                    uint32_t color1 = Color16Convert(c1);
-                    FILL4PIXELS(color1)
-                    uint32_t palc2 = (paladdr + 12 + ((bits >> 4) & 3));
-                    uint16_t c2 = GETPALETTEHILO(palc2);
-                    uint32_t color2 = Color16Convert(c2);
-                    FILL4PIXELS(color2)
-                    uint32_t palc3 = (paladdr + 12 + ((bits >> 6) & 3));
-                    uint16_t c3 = GETPALETTEHILO(palc3);
-                    uint32_t color3 = Color16Convert(c3);
-                    FILL4PIXELS(color3)
-                    barcount--;
-                }
-            }
-            else if (vmode == 8)  // VM1, плотность видео-строки 104 байта
-            {
-                uint16_t pal14hi = pBoard->GetRAMWordView(paladdr + 14);
-                uint16_t pal14lo = pBoard->GetRAMWordView(paladdr + 14 + 256);
-                uint32_t color0 = Color16Convert((uint16_t)((pal14hi & 0xff) << 8 | (pal14lo & 0xff)));
-                uint32_t color1 = Color16Convert((uint16_t)((pal14hi & 0xff00) | (pal14lo & 0xff00) >> 8));
-                while (barcount > 0)
-                {
-                    uint16_t bits = pBoard->GetRAMWordView(otraddr);
-                    otraddr += 2;
-                    for (uint16_t k = 0; k < 16; k++)
-                    {
-                        uint32_t color = (bits & 1) ? color1 : color0;
-                        FILL1PIXEL(color)
-                        bits = bits >> 1;
-                    }
-                    barcount--;
-                }
-            }
-            else if (vmode == 9)
-            {
-                while (barcount > 0)
-                {
-                    uint16_t bits = pBoard->GetRAMWordView(otraddr);  // читаем слово - выводим 16 пикселей
-                    otraddr += 2;
-                    uint32_t palc0 = (paladdr + 12 + (bits & 3));
-                    uint16_t c0 = GETPALETTEHILO(palc0);
-                    uint32_t color0 = Color16Convert(c0);
-                    FILL2PIXELS(color0)
-                    uint32_t palc1 = (paladdr + 12 + ((bits >> 2) & 3));
-                    uint16_t c1 = GETPALETTEHILO(palc1);
-                    uint32_t color1 = Color16Convert(c1);
-                    FILL2PIXELS(color1)
-                    uint32_t palc2 = (paladdr + 12 + ((bits >> 4) & 3));
-                    uint16_t c2 = GETPALETTEHILO(palc2);
-                    uint32_t color2 = Color16Convert(c2);
-                    FILL2PIXELS(color2)
-                    uint32_t palc3 = (paladdr + 12 + ((bits >> 6) & 3));
-                    uint16_t c3 = GETPALETTEHILO(palc3);
-                    uint32_t color3 = Color16Convert(c3);
-                    FILL2PIXELS(color3)
-                    uint32_t palc4 = (paladdr + 12 + ((bits >> 8) & 3));
-                    uint16_t c4 = GETPALETTEHILO(palc4);
-                    uint32_t color4 = Color16Convert(c4);
-                    FILL2PIXELS(color4)
-                    uint32_t palc5 = (paladdr + 12 + ((bits >> 10) & 3));
-                    uint16_t c5 = GETPALETTEHILO(palc5);
-                    uint32_t color5 = Color16Convert(c5);
-                    FILL2PIXELS(color5)
-                    uint32_t palc6 = (paladdr + 12 + ((bits >> 12) & 3));
-                    uint16_t c6 = GETPALETTEHILO(palc6);
-                    uint32_t color6 = Color16Convert(c6);
-                    FILL2PIXELS(color6)
-                    uint32_t palc7 = (paladdr + 12 + ((bits >> 14) & 3));
-                    uint16_t c7 = GETPALETTEHILO(palc7);
-                    uint32_t color7 = Color16Convert(c7);
-                    FILL2PIXELS(color7)
-                    barcount--;
-                }
-            }
-            else if (vmode == 10)  // VM4, плотность видео-строки 104 байта
-            {
-                while (barcount > 0)
-                {
-                    uint16_t bits = pBoard->GetRAMWordView(otraddr);  // читаем слово - выводим 16 пикселей
-                    otraddr += 2;
-                    uint32_t palc = paladdr + (bits & 15);
-                    uint16_t c = GETPALETTEHILO(palc);
-                    uint32_t color = Color16Convert(c);
-                    FILL4PIXELS(color)
-                    palc = paladdr + ((bits >> 4) & 15);
-                    c = GETPALETTEHILO(palc);
-                    color = Color16Convert(c);
-                    FILL4PIXELS(color)
-                    palc = paladdr + ((bits >> 8) & 15);
-                    c = GETPALETTEHILO(palc);
-                    color = Color16Convert(c);
-                    FILL4PIXELS(color)
-                    palc = paladdr + ((bits >> 12) & 15);
-                    c = GETPALETTEHILO(palc);
-                    color = Color16Convert(c);
-                    FILL4PIXELS(color)
-                    barcount--;
-                }
-            }
-            else if (vmode == 11 && !otrpb)  // VM41, плотность видео-строки 104 байта
-            {
-                while (barcount > 0)
-                {
-                    uint16_t bits = pBoard->GetRAMWordView(otraddr);  // читаем слово - выводим 16 пикселей
-                    otraddr += 2;
-                    uint32_t palc0 = (paladdr + (bits & 15));
-                    uint16_t c0 = GETPALETTEHILO(palc0);
-                    uint32_t color0 = Color16Convert(c0);
-                    FILL4PIXELS(color0)
-                    uint32_t palc1 = (paladdr + ((bits >> 4) & 15));
-                    uint16_t c1 = GETPALETTEHILO(palc1);
-                    uint32_t color1 = Color16Convert(c1);
-                    FILL4PIXELS(color1)
-                    uint32_t palc2 = (paladdr + ((bits >> 8) & 15));
-                    uint16_t c2 = GETPALETTEHILO(palc2);
-                    uint32_t color2 = Color16Convert(c2);
-                    FILL4PIXELS(color2)
-                    uint32_t palc3 = (paladdr + ((bits >> 12) & 15));
-                    uint16_t c3 = GETPALETTEHILO(palc3);
-                    uint32_t color3 = Color16Convert(c3);
-                    FILL4PIXELS(color3)
-                    barcount--;
-                }
-            }
-            else if (vmode == 11 && otrpb)  // VM8, плотность видео-строки 104 байта
-            {
-                while (barcount > 0)
-                {
-                    uint16_t bits = pBoard->GetRAMWordView(otraddr);  // читаем слово - выводим 16 пикселей
-                    otraddr += 2;
-                    uint32_t palc0 = (paladdr + (bits & 0xff));
-                    uint16_t c0 = GETPALETTEHILO(palc0);
-                    uint32_t color0 = Color16Convert(c0);
-                    FILL8PIXELS(color0)
-                    uint32_t palc1 = (paladdr + (bits >> 8));
-                    uint16_t c1 = GETPALETTEHILO(palc1);
-                    uint32_t color1 = Color16Convert(c1);
-                    FILL8PIXELS(color1)
-                    barcount--;
-                }
-            }
-            else if (vmode == 13)  // VM2, плотность видео-строки 208 байт
-            {
-                for (int j = 0; j < barcount * 2; j++)
-                {
-                    uint16_t bits = pBoard->GetRAMWordView(otraddr);  // читаем слово - выводим 8 пикселей
-                    otraddr += 2;
-                    uint32_t palc0 = (paladdr + 12 + (bits & 3));
-                    uint16_t c0 = GETPALETTEHILO(palc0);
-                    uint32_t color0 = Color16Convert(c0);
-                    FILL1PIXEL(color0)
-                    uint32_t palc1 = (paladdr + 12 + ((bits >> 2) & 3));
-                    uint16_t c1 = GETPALETTEHILO(palc1);
-                    uint32_t color1 = Color16Convert(c1);
-                    FILL1PIXEL(color1)
-                    uint32_t palc2 = (paladdr + 12 + ((bits >> 4) & 3));
-                    uint16_t c2 = GETPALETTEHILO(palc2);
-                    uint32_t color2 = Color16Convert(c2);
-                    FILL1PIXEL(color2)
-                    uint32_t palc3 = (paladdr + 12 + ((bits >> 6) & 3));
-                    uint16_t c3 = GETPALETTEHILO(palc3);
-                    uint32_t color3 = Color16Convert(c3);
-                    FILL1PIXEL(color3)
-                    uint32_t palc4 = (paladdr + 12 + ((bits >> 8) & 3));
-                    uint16_t c4 = GETPALETTEHILO(palc4);
-                    uint32_t color4 = Color16Convert(c4);
-                    FILL1PIXEL(color4)
-                    uint32_t palc5 = (paladdr + 12 + ((bits >> 10) & 3));
-                    uint16_t c5 = GETPALETTEHILO(palc5);
-                    uint32_t color5 = Color16Convert(c5);
-                    FILL1PIXEL(color5)
-                    uint32_t palc6 = (paladdr + 12 + ((bits >> 12) & 3));
-                    uint16_t c6 = GETPALETTEHILO(palc6);
-                    uint32_t color6 = Color16Convert(c6);
-                    FILL1PIXEL(color6)
-                    uint32_t palc7 = (paladdr + 12 + ((bits >> 14) & 3));
-                    uint16_t c7 = GETPALETTEHILO(palc7);
-                    uint32_t color7 = Color16Convert(c7);
-                    FILL1PIXEL(color7)
-                }
-            }
-            else if ((vmode == 14) ||  // VM4, плотность видео-строки 208 байт
-                    vmode == 15 && !otrpb)  // VM41, плотность видео-строки 208 байт
-            {
-                for (int j = 0; j < barcount * 2; j++)
-                {
-                    uint16_t bits = pBoard->GetRAMWordView(otraddr);  // читаем слово - выводим 8 пикселей
-                    otraddr += 2;
-                    uint32_t palc0 = (paladdr + (bits & 15));
-                    uint16_t c0 = GETPALETTEHILO(palc0);
-                    uint32_t color0 = Color16Convert(c0);
-                    FILL2PIXELS(color0)
-                    uint32_t palc1 = (paladdr + ((bits >> 4) & 15));
-                    uint16_t c1 = GETPALETTEHILO(palc1);
-                    uint32_t color1 = Color16Convert(c1);
-                    FILL2PIXELS(color1)
-                    uint32_t palc2 = (paladdr + ((bits >> 8) & 15));
-                    uint16_t c2 = GETPALETTEHILO(palc2);
-                    uint32_t color2 = Color16Convert(c2);
-                    FILL2PIXELS(color2)
-                    uint32_t palc3 = (paladdr + ((bits >> 12) & 15));
-                    uint16_t c3 = GETPALETTEHILO(palc3);
-                    uint32_t color3 = Color16Convert(c3);
-                    FILL2PIXELS(color3)
-                }
-            }
-            else if (vmode == 15 && otrpb)
-            {
-                while (barcount > 0)
-                {
-                    uint16_t bits0 = pBoard->GetRAMWordView(otraddr);  // читаем слово - выводим 8 пикселей
-                    otraddr += 2;
-                    uint32_t palc0 = (paladdr + (bits0 & 15));
-                    uint16_t c0 = GETPALETTEHILO(palc0);
-                    uint32_t color0 = Color16Convert(c0);
-                    FILL4PIXELS(color0)
-                    uint32_t palc1 = (paladdr + ((bits0 >> 4) & 15));
-                    uint16_t c1 = GETPALETTEHILO(palc1);
-                    uint32_t color1 = Color16Convert(c1);
-                    FILL4PIXELS(color1)
-                    uint16_t bits1 = pBoard->GetRAMWordView(otraddr);  // читаем слово - выводим 8 пикселей
-                    otraddr += 2;
-                    uint32_t palc2 = (paladdr + (bits1 & 15));
-                    uint16_t c2 = GETPALETTEHILO(palc2);
-                    uint32_t color2 = Color16Convert(c2);
-                    FILL4PIXELS(color2)
-                    uint32_t palc3 = (paladdr + ((bits1 >> 4) & 15));
-                    uint16_t c3 = GETPALETTEHILO(palc3);
-                    uint32_t color3 = Color16Convert(c3);
-                    FILL4PIXELS(color3)
-                    barcount--;
-                }
-            }
-            else //if (vmode == 12)  // VM1, плотность видео-строки 208 байт - запрещенный режим
-            {
-                while (barcount > 0)
-                {
-                    FILL8PIXELS(colorBorder)
-                    FILL8PIXELS(colorBorder)
-                    barcount--;
-                }
-            }
-
-            if (bar <= 0) break;
-            firstOtr = false;
-        }
-
-        uint32_t* pBits = pImageBits + line * NEON_SCREEN_WIDTH;
-        memcpy(pBits, linebits, sizeof(uint32_t) * NEON_SCREEN_WIDTH);
-    }
-}
-
-
 //////////////////////////////////////////////////////////////////////
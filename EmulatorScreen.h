@@ -0,0 +1,20 @@
+/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// EmulatorScreen.h
+// Rendering the Neon screen from the video RAM
+
+#pragma once
+
+const int NEON_SCREEN_WIDTH  = 832;
+const int NEON_SCREEN_HEIGHT = 300;
+
+// Render the screen to the RGB32 buffer of NEON_SCREEN_WIDTH x NEON_SCREEN_HEIGHT pixels
+void Emulator_PrepareScreenRGB32(const CMotherboard* pBoard, uint32_t* pBits);
@@ -0,0 +1,767 @@
+/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// Fuzz.cpp
+// Native keyboard input fuzzer for the guest programs: runs random keyboard matrix sequences from the base snapshot,
+// keeps the inputs reaching new guest code in the corpus, and reports the inputs causing traps or hangs.
+//
+// Build:
+//   g++ -O2 -pthread Fuzz.cpp emubase/Board.cpp emubase/Processor.cpp emubase/Floppy.cpp emubase/Hard.cpp
+//       emubase/pit8253.cpp emubase/Disasm.cpp emubase/StateImage.cpp emubase/Rewind.cpp emubase/DiskOverlay.cpp
+//       emubase/RunAhead.cpp util/lz4.cpp -o fuzz
+// Usage:
+//   fuzz [options] > results.json
+//   -state FILE     Base snapshot, .neonst state image with the program under test; the built-in boot image by default
+//   -corpus DIR     Seed inputs to start with, and where the new corpus inputs go; the directory must exist
+//   -crashes DIR    Where the minimized crashing inputs go; the directory must exist
+//   -j N            Threads, the number of cores by default
+//   -seconds N      Time to run, 60 by default; -runs N to stop after N runs
+//   -hang N         Frames stuck on the same PC with no interrupts taken to report the hang, 50 by default; 0 = off;
+//                   the PC is checked at the frame end, so it catches "BR ." and WAIT with no interrupts coming
+//   -vectors LIST   Trap vectors reported as crashes, octal, comma separated, "h" prefix for HALT mode vectors;
+//                   4,10,h4,h174 by default: bus error or illegal instruction, reserved instruction,
+//                   bus error in HALT mode, double bus error; not h170, the firmware enters HALT mode that way
+//   -seed N         Random seed
+// The inputs are saved as the key scripts for BatchRun.cpp: lines "FRAME SCAN 1|0", so the crash could be replayed.
+
+#include "stdafx.h"
+#include "emubase/Emubase.h"
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+
+// DebugPrint and DebugLog
+void DebugPrint(LPCTSTR) {}
+void DebugPrintFormat(LPCTSTR, ...) {}
+void DebugLogClear() {}
+void DebugLogCloseFile() {}
+void DebugLog(LPCTSTR) {}
+void DebugLogFormat(LPCTSTR, ...) {}
+
+#include "pk11_rom.h"
+#include "boot_image.h"
+
+#define FUZZ_MAX_THREADS     256
+#define FUZZ_MAX_STEPS       64     // Steps in the input sequence
+#define FUZZ_MAX_STEP_FRAMES 8      // Frames to hold the step keyboard matrix
+#define FUZZ_TAIL_FRAMES     25     // Frames to run with all the keys released, after the input
+#define FUZZ_MAX_CORPUS      4096
+#define FUZZ_MAX_CRASHES     256
+#define FUZZ_MAX_VECTORS     32
+#define FUZZ_COVERAGE_SIZE   65536  // See CProcessor::SetCoverageMap()
+#define FUZZ_RTC_TIME        946684800  // 2000-01-01, for the runs to be deterministic
+
+enum FuzzResultKind { FUZZ_OK = 0, FUZZ_TRAP = 1, FUZZ_HANG = 2 };
+
+
+//////////////////////////////////////////////////////////////////////
+
+
+// Input sequence: keyboard matrices, each one held for some frames
+struct FuzzStep
+{
+    uint8_t matrix[8];
+    int frames;
+};
+
+struct FuzzInput
+{
+    FuzzStep steps[FUZZ_MAX_STEPS];
+    int count;
+};
+
+struct FuzzResult
+{
+    FuzzResultKind kind;
+    uint16_t vector;
+    bool okHaltMode;
+    uint16_t pc;  // Trap instruction address; for the hang, the current PC
+    int frame;  // Frame when it happened, counting from 1
+};
+
+struct FuzzCrash
+{
+    FuzzResult result;
+    int count;  // How many times it was found
+    char sFileName[64];
+};
+
+struct FuzzWorker
+{
+    int index;
+    uint64_t random;  // xorshift64 state
+    CMotherboard* pBase;  // Base snapshot, cloned for every run
+    uint8_t* pCoverage;  // Run coverage
+    // Current run
+    int frame;
+    int lastActivityFrame;  // Last frame with an interrupt taken or with the PC moved
+    uint16_t lastPC;  // PC at the end of the previous frame
+    FuzzResult result;
+};
+
+static uint16_t g_FuzzVectors[FUZZ_MAX_VECTORS];  // Crash vectors, 0x8000 flag for HALT mode
+static int g_nFuzzVectorCount = 0;
+static int g_nHangFrames = 50;
+
+static const uint8_t* g_pBaseImage = nullptr;
+static uint32_t g_nBaseImageSize = 0;
+static const char* g_sCorpusDir = nullptr;
+static const char* g_sCrashesDir = nullptr;
+
+static pthread_mutex_t g_FuzzMutex = PTHREAD_MUTEX_INITIALIZER;  // Guards everything below
+static FuzzInput* g_pCorpus[FUZZ_MAX_CORPUS];
+static int g_nCorpusCount = 0;
+static uint8_t g_Coverage[FUZZ_COVERAGE_SIZE];
+static int g_nCoverageCount = 0;
+static FuzzCrash g_Crashes[FUZZ_MAX_CRASHES];
+static int g_nCrashCount = 0;
+static long g_nRuns = 0;
+static long g_nFrames = 0;
+static long g_nMaxRuns = 0;
+static double g_dStopTime = 0.0;
+static bool g_okStop = false;
+
+
+//////////////////////////////////////////////////////////////////////
+
+
+static double Fuzz_GetTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t Fuzz_Random(FuzzWorker* pWorker)
+{
+    uint64_t x = pWorker->random;
+    x ^= x << 13;  x ^= x >> 7;  x ^= x << 17;
+    pWorker->random = x;
+    return (uint32_t)(x >> 32);
+}
+
+static uint32_t Fuzz_RandomBelow(FuzzWorker* pWorker, uint32_t limit)
+{
+    return Fuzz_Random(pWorker) % limit;
+}
+
+static uint8_t* Fuzz_ReadFile(const char* sFileName, uint32_t* pSize)
+{
+    FILE* fpFile = ::fopen(sFileName, "rb");
+    if (fpFile == nullptr)
+        return nullptr;
+    ::fseek(fpFile, 0, SEEK_END);
+    uint32_t fileSize = (uint32_t)::ftell(fpFile);
+    ::fseek(fpFile, 0, SEEK_SET);
+    uint8_t* pData = (uint8_t*) ::malloc(fileSize);
+    if (pData != nullptr && ::fread(pData, 1, fileSize, fpFile) != fileSize)
+    {
+        ::free(pData);  pData = nullptr;
+    }
+    ::fclose(fpFile);
+    *pSize = fileSize;
+    return pData;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Input sequences as key scripts: the key events on the step matrices changes
+
+static bool Fuzz_SaveInput(const FuzzInput* pInput, const char* sFileName)
+{
+    FILE* fpFile = ::fopen(sFileName, "wt");
+    if (fpFile == nullptr)
+        return false;
+
+    uint8_t matrix[8];
+    memset(matrix, 0, sizeof(matrix));
+    int frame = 1;
+    for (int i = 0; i < pInput->count; i++)
+    {
+        const FuzzStep* pStep = pInput->steps + i;
+        for (int row = 0; row < 8; row++)
+        {
+            uint8_t changed = matrix[row] ^ pStep->matrix[row];
+            for (int bit = 0; bit < 8; bit++)
+            {
+                if ((changed & (1 << bit)) != 0)
+                    fprintf(fpFile, "%d %03x %d\n", frame, (row << 8) | (1 << bit), (pStep->matrix[row] >> bit) & 1);
+            }
+            matrix[row] = pStep->matrix[row];
+        }
+        frame += pStep->frames;
+    }
+    for (int row = 0; row < 8; row++)  // Release all at the end
+    {
+        for (int bit = 0; bit < 8; bit++)
+        {
+            if ((matrix[row] & (1 << bit)) != 0)
+                fprintf(fpFile, "%d %03x 0\n", frame, (row << 8) | (1 << bit));
+        }
+    }
+
+    ::fclose(fpFile);
+    return true;
+}
+
+static bool Fuzz_LoadInput(FuzzInput* pInput, const char* sFileName)
+{
+    FILE* fpFile = ::fopen(sFileName, "rt");
+    if (fpFile == nullptr)
+        return false;
+
+    memset(pInput, 0, sizeof(FuzzInput));
+    uint8_t matrix[8];
+    memset(matrix, 0, sizeof(matrix));
+    int stepframe = 1;  // First frame of the current step
+    char line[256];
+    bool okResult = true;
+    while (::fgets(line, sizeof(line), fpFile) != nullptr)
+    {
+        const char* p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '#' || *p == '\r' || *p == '\n' || *p == 0)
+            continue;
+        int frame = 0, pressed = 0;
+        unsigned int scan = 0;
+        if (sscanf(p, "%d %x %d", &frame, &scan, &pressed) != 3 || frame < stepframe)
+        {
+            okResult = false;
+            break;
+        }
+        if (frame > stepframe)  // The matrix before this event is held until the frame
+        {
+            while (frame > stepframe && pInput->count < FUZZ_MAX_STEPS)
+            {
+                FuzzStep* pStep = pInput->steps + pInput->count++;
+                memcpy(pStep->matrix, matrix, sizeof(matrix));
+                pStep->frames = frame - stepframe;
+                if (pStep->frames > FUZZ_MAX_STEP_FRAMES)
+                    pStep->frames = FUZZ_MAX_STEP_FRAMES;
+                stepframe += pStep->frames;
+            }
+            stepframe = frame;
+        }
+        if (pressed)
+            matrix[(scan >> 8) & 7] |= (scan & 0xff);
+        else
+            matrix[(scan >> 8) & 7] &= ~(scan & 0xff);
+    }
+    ::fclose(fpFile);
+    return okResult && pInput->count > 0;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Running the input
+
+static bool Fuzz_IsCrashVector(uint16_t vector, bool okHaltMode)
+{
+    uint16_t key = vector | (okHaltMode ? 0x8000 : 0);
+    for (int i = 0; i < g_nFuzzVectorCount; i++)
+    {
+        if (g_FuzzVectors[i] == key)
+            return true;
+    }
+    return false;
+}
+
+static void CALLBACK Fuzz_TrapCallback(void* param, uint16_t vector, bool okHaltMode, uint16_t pc)
+{
+    FuzzWorker* pWorker = (FuzzWorker*)param;
+    pWorker->lastActivityFrame = pWorker->frame;
+    if (pWorker->result.kind == FUZZ_OK && Fuzz_IsCrashVector(vector, okHaltMode))
+    {
+        pWorker->result.kind = FUZZ_TRAP;
+        pWorker->result.vector = vector;
+        pWorker->result.okHaltMode = okHaltMode;
+        pWorker->result.pc = pc;
+        pWorker->result.frame = pWorker->frame;
+    }
+}
+
+// Run the input from the base snapshot; returns false if the machine failed to clone
+static bool Fuzz_Run(FuzzWorker* pWorker, const FuzzInput* pInput)
+{
+    memset(&pWorker->result, 0, sizeof(pWorker->result));
+    memset(pWorker->pCoverage, 0, FUZZ_COVERAGE_SIZE);
+    CMotherboard* pBoard = pWorker->pBase->Clone();
+    if (pBoard == nullptr)
+        return false;
+    CProcessor* pCPU = pBoard->GetCPU();
+    pCPU->SetCoverageMap(pWorker->pCoverage);
+    pCPU->SetTrapCallback(Fuzz_TrapCallback, pWorker);
+
+    pWorker->frame = 0;
+    pWorker->lastActivityFrame = 0;
+    pWorker->lastPC = pCPU->GetPC();
+    uint8_t released[8];
+    memset(released, 0, sizeof(released));
+    for (int i = 0; i <= pInput->count && pWorker->result.kind == FUZZ_OK; i++)
+    {
+        bool okTail = (i == pInput->count);
+        pBoard->UpdateKeyboardMatrix(okTail ? released : pInput->steps[i].matrix);
+        int frames = okTail ? FUZZ_TAIL_FRAMES : pInput->steps[i].frames;
+        for (int f = 0; f < frames && pWorker->result.kind == FUZZ_OK; f++)
+        {
+            pWorker->frame++;
+            pBoard->SystemFrame();
+            if (pCPU->GetPC() != pWorker->lastPC)
+            {
+                pWorker->lastActivityFrame = pWorker->frame;
+                pWorker->lastPC = pCPU->GetPC();
+            }
+            if (g_nHangFrames > 0 && pWorker->result.kind == FUZZ_OK &&
+                pWorker->frame - pWorker->lastActivityFrame >= g_nHangFrames)
+            {
+                pWorker->result.kind = FUZZ_HANG;
+                pWorker->result.pc = pCPU->GetPC();
+                pWorker->result.okHaltMode = pCPU->IsHaltMode();
+                pWorker->result.frame = pWorker->frame;
+            }
+        }
+    }
+
+    delete pBoard;
+    return true;
+}
+
+static bool Fuzz_IsSameResult(const FuzzResult* pResult1, const FuzzResult* pResult2)
+{
+    return pResult1->kind == pResult2->kind && pResult1->vector == pResult2->vector &&
+            pResult1->okHaltMode == pResult2->okHaltMode && pResult1->pc == pResult2->pc;
+}
+
+// Make the crashing input smaller, keeping the same result: cut the steps after the crash, drop the steps,
+// release the keys, shorten the steps
+static void Fuzz_Minimize(FuzzWorker* pWorker, FuzzInput* pInput, const FuzzResult* pResult)
+{
+    int frame = 0;
+    for (int i = 0; i < pInput->count; i++)
+    {
+        frame += pInput->steps[i].frames;
+        if (frame >= pResult->frame)
+        {
+            pInput->count = i + 1;
+            break;
+        }
+    }
+
+    FuzzInput trial;
+    for (int i = pInput->count - 1; i >= 0; i--)
+    {
+        trial = *pInput;
+        memmove(trial.steps + i, trial.steps + i + 1, (trial.count - i - 1) * sizeof(FuzzStep));
+        trial.count--;
+        if (Fuzz_Run(pWorker, &trial) && Fuzz_IsSameResult(&pWorker->result, pResult))
+            *pInput = trial;
+    }
+    for (int i = 0; i < pInput->count; i++)
+    {
+        for (int bit = 0; bit < 64; bit++)
+        {
+            if ((pInput->steps[i].matrix[bit / 8] & (1 << (bit % 8))) == 0)
+                continue;
+            trial = *pInput;
+            trial.steps[i].matrix[bit / 8] &= ~(1 << (bit % 8));
+            if (Fuzz_Run(pWorker, &trial) && Fuzz_IsSameResult(&pWorker->result, pResult))
+                *pInput = trial;
+        }
+        if (pInput->steps[i].frames > 1)
+        {
+            trial = *pInput;
+            trial.steps[i].frames = 1;
+            if (Fuzz_Run(pWorker, &trial) && Fuzz_IsSameResult(&pWorker->result, pResult))
+                *pInput = trial;
+        }
+    }
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Mutations
+
+static void Fuzz_RandomStep(FuzzWorker* pWorker, FuzzStep* pStep)
+{
+    memset(pStep->matrix, 0, sizeof(pStep->matrix));
+    pStep->matrix[Fuzz_RandomBelow(pWorker, 8)] = (uint8_t)(1 << Fuzz_RandomBelow(pWorker, 8));
+    pStep->frames = 1 + Fuzz_RandomBelow(pWorker, FUZZ_MAX_STEP_FRAMES);
+}
+
+static void Fuzz_Mutate(FuzzWorker* pWorker, FuzzInput* pInput, const FuzzInput* pOther)
+{
+    int mutations = 1 + Fuzz_RandomBelow(pWorker, 4);
+    for (int m = 0; m < mutations; m++)
+    {
+        if (pInput->count == 0)
+        {
+            Fuzz_RandomStep(pWorker, pInput->steps);
+            pInput->count = 1;
+            continue;
+        }
+        int index = Fuzz_RandomBelow(pWorker, pInput->count);
+        FuzzStep* pStep = pInput->steps + index;
+        switch (Fuzz_RandomBelow(pWorker, 8))
+        {
+        case 0:  // Flip a key
+            pStep->matrix[Fuzz_RandomBelow(pWorker, 8)] ^= (uint8_t)(1 << Fuzz_RandomBelow(pWorker, 8));
+            break;
+        case 1:  // One key only
+            Fuzz_RandomStep(pWorker, pStep);
+            break;
+        case 2:  // Release all
+            memset(pStep->matrix, 0, sizeof(pStep->matrix));
+            break;
+        case 3:  // Hold longer or shorter
+            pStep->frames = 1 + Fuzz_RandomBelow(pWorker, FUZZ_MAX_STEP_FRAMES);
+            break;
+        case 4:  // Insert a new step
+        case 5:  // Duplicate the step
+            if (pInput->count < FUZZ_MAX_STEPS)
+            {
+                memmove(pStep + 1, pStep, (pInput->count - index) * sizeof(FuzzStep));
+                pInput->count++;
+                if (m % 2 == 0)
+                    Fuzz_RandomStep(pWorker, pStep);
+            }
+            break;
+        case 6:  // Delete the step
+            memmove(pStep, pStep + 1, (pInput->count - index - 1) * sizeof(FuzzStep));
+            pInput->count--;
+            break;
+        case 7:  // Splice: this input up to the step, then the other input
+            if (pOther != nullptr && pOther->count > 0)
+            {
+                int from = Fuzz_RandomBelow(pWorker, pOther->count);
+                int count = pOther->count - from;
+                if (index + count > FUZZ_MAX_STEPS)
+                    count = FUZZ_MAX_STEPS - index;
+                memcpy(pStep, pOther->steps + from, count * sizeof(FuzzStep));
+                pInput->count = index + count;
+            }
+            break;
+        }
+    }
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Corpus and crashes, under g_FuzzMutex
+
+// Merge the run coverage to the global one; returns the number of new addresses
+static int Fuzz_MergeCoverage(const uint8_t* pCoverage)
+{
+    int newcount = 0;
+    for (int i = 0; i < FUZZ_COVERAGE_SIZE; i++)
+    {
+        if (pCoverage[i] != 0 && g_Coverage[i] == 0)
+        {
+            g_Coverage[i] = 1;
+            newcount++;
+        }
+    }
+    g_nCoverageCount += newcount;
+    return newcount;
+}
+
+static void Fuzz_AddToCorpus(const FuzzInput* pInput)
+{
+    if (g_nCorpusCount >= FUZZ_MAX_CORPUS)
+        return;
+    FuzzInput* pCopy = (FuzzInput*) ::malloc(sizeof(FuzzInput));
+    *pCopy = *pInput;
+    g_pCorpus[g_nCorpusCount++] = pCopy;
+
+    if (g_sCorpusDir != nullptr)
+    {
+        char sFileName[512];
+        snprintf(sFileName, sizeof(sFileName), "%s/input%04d.keys", g_sCorpusDir, g_nCorpusCount);
+        Fuzz_SaveInput(pInput, sFileName);
+    }
+}
+
+// Find the crash with the same result; returns nullptr if it is a new one
+static FuzzCrash* Fuzz_FindCrash(const FuzzResult* pResult)
+{
+    for (int i = 0; i < g_nCrashCount; i++)
+    {
+        if (Fuzz_IsSameResult(&g_Crashes[i].result, pResult))
+            return g_Crashes + i;
+    }
+    return nullptr;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+
+
+static void* Fuzz_WorkerThread(void* param)
+{
+    FuzzWorker* pWorker = (FuzzWorker*)param;
+    FuzzInput input;
+    FuzzInput other;
+    for (;;)
+    {
+        // Take the corpus input to mutate, and another one to splice with
+        pthread_mutex_lock(&g_FuzzMutex);
+        bool okStop = g_okStop || (g_nMaxRuns > 0 && g_nRuns >= g_nMaxRuns) || Fuzz_GetTime() >= g_dStopTime;
+        if (okStop)
+            g_okStop = true;
+        else
+        {
+            input = *g_pCorpus[Fuzz_RandomBelow(pWorker, g_nCorpusCount)];
+            other = *g_pCorpus[Fuzz_RandomBelow(pWorker, g_nCorpusCount)];
+            g_nRuns++;
+        }
+        pthread_mutex_unlock(&g_FuzzMutex);
+        if (okStop)
+            break;
+
+        Fuzz_Mutate(pWorker, &input, &other);
+        if (!Fuzz_Run(pWorker, &input))
+            break;
+        FuzzResult result = pWorker->result;
+        int frames = pWorker->frame;
+
+        pthread_mutex_lock(&g_FuzzMutex);
+        g_nFrames += frames;
+        bool okNewCoverage = Fuzz_MergeCoverage(pWorker->pCoverage) > 0;
+        if (okNewCoverage && result.kind == FUZZ_OK)
+            Fuzz_AddToCorpus(&input);
+        FuzzCrash* pCrash = (result.kind != FUZZ_OK) ? Fuzz_FindCrash(&result) : nullptr;
+        if (pCrash != nullptr)
+            pCrash->count++;
+        bool okNewCrash = (result.kind != FUZZ_OK && pCrash == nullptr && g_nCrashCount < FUZZ_MAX_CRASHES);
+        if (okNewCrash)  // Reserve the slot, so the other threads count it as found
+        {
+            pCrash = g_Crashes + g_nCrashCount++;
+            memset(pCrash, 0, sizeof(FuzzCrash));
+            pCrash->result = result;
+            pCrash->count = 1;
+        }
+        pthread_mutex_unlock(&g_FuzzMutex);
+
+        if (okNewCrash)
+        {
+            Fuzz_Minimize(pWorker, &input, &result);
+
+            pthread_mutex_lock(&g_FuzzMutex);
+            if (result.kind == FUZZ_HANG)
+                snprintf(pCrash->sFileName, sizeof(pCrash->sFileName), "hang-%c%06o.keys",
+                        result.okHaltMode ? 'h' : 'u', result.pc);
+            else
+                snprintf(pCrash->sFileName, sizeof(pCrash->sFileName), "trap-%s%o-%06o.keys",
+                        result.okHaltMode ? "h" : "", result.vector, result.pc);
+            if (g_sCrashesDir != nullptr)
+            {
+                char sFileName[512];
+                snprintf(sFileName, sizeof(sFileName), "%s/%s", g_sCrashesDir, pCrash->sFileName);
+                Fuzz_SaveInput(&input, sFileName);
+            }
+            fprintf(stderr, "Found %s\n", pCrash->sFileName);
+            pthread_mutex_unlock(&g_FuzzMutex);
+        }
+    }
+    return nullptr;
+}
+
+static bool Fuzz_ParseVectors(const char* sList)
+{
+    g_nFuzzVectorCount = 0;
+    const char* p = sList;
+    while (*p != 0)
+    {
+        bool okHalt = (*p == 'h' || *p == 'H');
+        if (okHalt) p++;
+        char* end = nullptr;
+        unsigned long vector = strtoul(p, &end, 8);
+        if (end == p || vector > 0377 || g_nFuzzVectorCount >= FUZZ_MAX_VECTORS)
+            return false;
+        g_FuzzVectors[g_nFuzzVectorCount++] = (uint16_t)(vector | (okHalt ? 0x8000 : 0));
+        p = end;
+        if (*p == ',') p++;
+    }
+    return g_nFuzzVectorCount > 0;
+}
+
+static void Fuzz_LoadCorpus()
+{
+    DIR* pDir = opendir(g_sCorpusDir);
+    if (pDir == nullptr)
+        return;
+    struct dirent* pEntry;
+    FuzzInput input;
+    while ((pEntry = readdir(pDir)) != nullptr && g_nCorpusCount < FUZZ_MAX_CORPUS)
+    {
+        size_t len = strlen(pEntry->d_name);
+        if (len < 5 || strcmp(pEntry->d_name + len - 5, ".keys") != 0)
+            continue;
+        char sFileName[512];
+        snprintf(sFileName, sizeof(sFileName), "%s/%s", g_sCorpusDir, pEntry->d_name);
+        if (!Fuzz_LoadInput(&input, sFileName))
+            continue;
+        FuzzInput* pCopy = (FuzzInput*) ::malloc(sizeof(FuzzInput));
+        *pCopy = input;
+        g_pCorpus[g_nCorpusCount++] = pCopy;
+    }
+    closedir(pDir);
+}
+
+static void Fuzz_PrintResults(int threads, double seconds)
+{
+    printf("{\n  \"runs\": %ld, \"frames\": %ld, \"seconds\": %.3f, \"threads\": %d, \"runs_per_second\": %.1f,"
+            " \"fps\": %.1f,\n", g_nRuns, g_nFrames, seconds, threads,
+            (seconds > 0.0) ? g_nRuns / seconds : 0.0, (seconds > 0.0) ? g_nFrames / seconds : 0.0);
+    printf("  \"corpus\": %d, \"coverage\": %d,\n", g_nCorpusCount, g_nCoverageCount);
+    printf("  \"crashes\": [");
+    for (int i = 0; i < g_nCrashCount; i++)
+    {
+        const FuzzCrash* pCrash = g_Crashes + i;
+        printf("%s\n    { \"kind\": \"%s\", ", (i > 0) ? "," : "", (pCrash->result.kind == FUZZ_HANG) ? "hang" : "trap");
+        if (pCrash->result.kind == FUZZ_TRAP)
+            printf("\"vector\": \"%03o\", ", pCrash->result.vector);
+        printf("\"mode\": \"%s\", \"pc\": \"%06o\", \"frame\": %d, \"count\": %d, \"file\": \"%s\" }",
+                pCrash->result.okHaltMode ? "halt" : "user", pCrash->result.pc, pCrash->result.frame,
+                pCrash->count, pCrash->sFileName);
+    }
+    printf("%s]\n}\n", (g_nCrashCount > 0) ? "\n  " : "");
+}
+
+int main(int argc, char* argv[])
+{
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int seconds = 60;
+    uint64_t seed = (uint64_t)time(0);
+    const char* sStateFile = nullptr;
+    Fuzz_ParseVectors("4,10,h4,h174");
+    bool okUsage = true;
+    for (int i = 1; i < argc && okUsage; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (value == nullptr)
+            okUsage = false;
+        else if (strcmp(arg, "-state") == 0)
+            sStateFile = value;
+        else if (strcmp(arg, "-corpus") == 0)
+            g_sCorpusDir = value;
+        else if (strcmp(arg, "-crashes") == 0)
+            g_sCrashesDir = value;
+        else if (strcmp(arg, "-j") == 0)
+            threads = atoi(value);
+        else if (strcmp(arg, "-seconds") == 0)
+            seconds = atoi(value);
+        else if (strcmp(arg, "-runs") == 0)
+            g_nMaxRuns = atol(value);
+        else if (strcmp(arg, "-hang") == 0)
+            g_nHangFrames = atoi(value);
+        else if (strcmp(arg, "-vectors") == 0)
+            okUsage = Fuzz_ParseVectors(value);
+        else if (strcmp(arg, "-seed") == 0)
+            seed = strtoull(value, nullptr, 10);
+        else
+            okUsage = false;
+        i++;
+    }
+    if (!okUsage)
+    {
+        fprintf(stderr, "Usage: fuzz [-state FILE] [-corpus DIR] [-crashes DIR] [-j N] [-seconds N] [-runs N] [-hang N]"
+                " [-vectors LIST] [-seed N]\n");
+        return 2;
+    }
+    if (threads < 1) threads = 1;
+    if (threads > FUZZ_MAX_THREADS) threads = FUZZ_MAX_THREADS;
+
+    CProcessor::Init();
+    StateImage_AddKnownRom((const uint8_t*)pk11_rom);
+
+    g_pBaseImage = boot_image;
+    g_nBaseImageSize = boot_image_length;
+    uint8_t* pStateData = nullptr;
+    if (sStateFile != nullptr)
+    {
+        pStateData = Fuzz_ReadFile(sStateFile, &g_nBaseImageSize);
+        if (pStateData == nullptr)
+        {
+            fprintf(stderr, "Failed to read the state image %s\n", sStateFile);
+            return 2;
+        }
+        g_pBaseImage = pStateData;
+    }
+
+    // Every worker has the base machine of its own
+    FuzzWorker* pWorkers = (FuzzWorker*) ::calloc(threads, sizeof(FuzzWorker));
+    for (int i = 0; i < threads; i++)
+    {
+        FuzzWorker* pWorker = pWorkers + i;
+        pWorker->index = i;
+        pWorker->random = seed * 2654435761u + i * 0x9E3779B97F4A7C15ull + 1;
+        pWorker->pCoverage = (uint8_t*) ::malloc(FUZZ_COVERAGE_SIZE);
+        pWorker->pBase = new CMotherboard();
+        pWorker->pBase->SetConfiguration((uint16_t)1024);
+        pWorker->pBase->SetSharedROM((const uint8_t*)pk11_rom);
+        pWorker->pBase->SetRtcFixedTime(FUZZ_RTC_TIME);
+        uint32_t uptime = 0;
+        if (!StateImage_Load(pWorker->pBase, g_pBaseImage, g_nBaseImageSize, &uptime, true, false))
+        {
+            fprintf(stderr, "Failed to load the base state image\n");
+            return 2;
+        }
+    }
+
+    // The empty input must run clean, otherwise everything would be reported
+    FuzzInput empty;
+    memset(&empty, 0, sizeof(empty));
+    if (!Fuzz_Run(pWorkers, &empty) || pWorkers->result.kind != FUZZ_OK)
+    {
+        fprintf(stderr, "The base snapshot %s with no input, vector %03o, at PC %06o; nothing to fuzz\n",
+                (pWorkers->result.kind == FUZZ_HANG) ? "hangs" : "traps", pWorkers->result.vector, pWorkers->result.pc);
+        return 2;
+    }
+    Fuzz_MergeCoverage(pWorkers->pCoverage);
+
+    if (g_sCorpusDir != nullptr)
+        Fuzz_LoadCorpus();
+    if (g_nCorpusCount == 0)
+    {
+        FuzzInput* pSeed = (FuzzInput*) ::malloc(sizeof(FuzzInput));
+        *pSeed = empty;
+        g_pCorpus[g_nCorpusCount++] = pSeed;
+    }
+    fprintf(stderr, "Fuzzing with %d threads, %d corpus inputs, %d covered addresses\n",
+            threads, g_nCorpusCount, g_nCoverageCount);
+
+    double startTime = Fuzz_GetTime();
+    g_dStopTime = startTime + seconds;
+    pthread_t workers[FUZZ_MAX_THREADS];
+    for (int i = 1; i < threads; i++)
+        pthread_create(workers + i, nullptr, Fuzz_WorkerThread, pWorkers + i);
+    Fuzz_WorkerThread(pWorkers);
+    for (int i = 1; i < threads; i++)
+        pthread_join(workers[i], nullptr);
+
+    Fuzz_PrintResults(threads, Fuzz_GetTime() - startTime);
+
+    for (int i = 0; i < threads; i++)
+    {
+        delete pWorkers[i].pBase;
+        ::free(pWorkers[i].pCoverage);
+    }
+    ::free(pWorkers);
+    for (int i = 0; i < g_nCorpusCount; i++)
+        ::free(g_pCorpus[i]);
+    ::free(pStateData);
+    CProcessor::Done();
+    return (g_nCrashCount > 0) ? 1 : 0;
+}
+
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1649 @@
+/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// Boot image: the state image of the machine at the VT-100 prompt, after the cold boot with no disks attached.
+// Version 2.0 image, RAM chunks compressed, the built-in ROM saved by hash only. See Emulator_RestoreBootImage().
+
+const int boot_image_length = 26096;
+
+const static uint8_t boot_image[boot_image_length] =
+{
+0x4e, 0x65, 0x6f, 0x6e, 0x42, 0x54, 0x4c, 0x21, 0x00, 0x00, 0x02, 0x00, 0x28, 0x0a, 0x10, 0x00,
+0x14, 0x00, 0x00, 0x00, 0xd0, 0x65, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xe0, 0x64, 0x00, 0x00,
+0x42, 0x4f, 0x52, 0x44, 0x00, 0x00, 0x01, 0x00, 0x90, 0x01, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+0xe6, 0x06, 0xe4, 0x75, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0xce,
+0x00, 0x01, 0x00, 0x10, 0xe0, 0x05, 0x00, 0x41, 0x00, 0x0b, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x02,
+0x00, 0x20, 0x74, 0xf8, 0x06, 0x00, 0x50, 0x00, 0x00, 0x20, 0x00, 0x40, 0x07, 0x00, 0x85, 0x00,
+0x60, 0x00, 0x80, 0x00, 0xa0, 0x00, 0xe0, 0x10, 0x00, 0x04, 0x02, 0x00, 0x14, 0x18, 0x09, 0x00,
+0x0f, 0x02, 0x00, 0x66, 0x1d, 0x01, 0x7a, 0x00, 0xcd, 0x01, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x11,
+0x00, 0x01, 0x12, 0x09, 0x1a, 0x1d, 0x00, 0x0f, 0x02, 0x00, 0x7d, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x43, 0x50, 0x55, 0x20, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+0x1f, 0x00, 0x00, 0x00, 0xa7, 0x03, 0xb6, 0x06, 0x64, 0xe0, 0x01, 0xaa, 0x81, 0x0d, 0x00, 0x01,
+0x00, 0x60, 0x0e, 0x02, 0x9c, 0x05, 0xd8, 0x02, 0x0e, 0x00, 0x01, 0x05, 0x00, 0x0f, 0x02, 0x00,
+0x1b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x44, 0x42, 0x46, 0x00, 0x00, 0x01, 0x00,
+0x00, 0x08, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x1f, 0x00, 0x01, 0x00,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x46, 0x44, 0x43, 0x20, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+0x71, 0x00, 0x3d, 0x16, 0x81, 0x01, 0x01, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x31,
+0x02, 0x02, 0x60, 0x08, 0x00, 0x0f, 0x02, 0x00, 0x13, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x4f, 0x4d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+0x46, 0x04, 0x6b, 0x16, 0x8e, 0xf1, 0xcf, 0x73, 0x80, 0x97, 0x11, 0x5c, 0x52, 0x41, 0x4d, 0x20,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x3d, 0x00, 0x00, 0xbd, 0xde, 0x20, 0x29,
+0xb0, 0x04, 0x00, 0x10, 0x02, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00, 0x10, 0xaa,
+0x05, 0x00, 0x0f, 0x02, 0x00, 0x29, 0x93, 0x30, 0x01, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x34,
+0x04, 0x00, 0x93, 0x36, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x3a, 0x04, 0x00, 0x2f, 0x3c,
+0x01, 0x5e, 0x00, 0x29, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0x05, 0x60, 0x10, 0xbe, 0x40,
+0x01, 0x00, 0x02, 0x08, 0x00, 0x13, 0x4a, 0x08, 0x00, 0x13, 0x54, 0x08, 0x00, 0x13, 0x5e, 0x08,
+0x00, 0x13, 0x68, 0x08, 0x00, 0x13, 0x72, 0x08, 0x00, 0x11, 0x7c, 0x08, 0x00, 0x04, 0x02, 0x00,
+0xf3, 0x00, 0xe0, 0xff, 0x00, 0xc0, 0x00, 0xc0, 0xe0, 0xff, 0xe0, 0xff, 0x60, 0xc0, 0x00, 0x00,
+0x60, 0x17, 0x00, 0x11, 0x60, 0x14, 0x00, 0x01, 0x1e, 0x00, 0x03, 0x12, 0x00, 0x00, 0x26, 0x00,
+0x20, 0x00, 0xc0, 0x18, 0x00, 0x0c, 0x28, 0x00, 0x01, 0x34, 0x00, 0x14, 0xc0, 0x27, 0x00, 0x20,
+0x00, 0x60, 0x02, 0x00, 0x12, 0x30, 0x04, 0x00, 0x23, 0x00, 0x30, 0x17, 0x00, 0x01, 0x10, 0x00,
+0x00, 0x0c, 0x00, 0x01, 0x2d, 0x00, 0x00, 0x02, 0x00, 0x81, 0xf8, 0x3f, 0xf8, 0x3f, 0x00, 0x30,
+0x18, 0x30, 0x08, 0x00, 0x20, 0x00, 0x18, 0x13, 0x00, 0x03, 0x16, 0x00, 0x02, 0x02, 0x00, 0x01,
+0x0f, 0x00, 0x00, 0x02, 0x00, 0x30, 0x30, 0x18, 0x30, 0x28, 0x00, 0x11, 0x18, 0x4d, 0x00, 0x04,
+0x28, 0x00, 0x11, 0x18, 0x12, 0x00, 0x00, 0x02, 0x00, 0x00, 0x23, 0x00, 0x01, 0x02, 0x00, 0x81,
+0x18, 0x0c, 0x18, 0x00, 0x18, 0x0c, 0x18, 0x0c, 0x25, 0x00, 0x11, 0x0c, 0x13, 0x00, 0x31, 0x00,
+0x00, 0x0c, 0x12, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x62, 0xfe, 0x0f,
+0xfe, 0x0f, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x14, 0x00, 0x31, 0x00, 0x00, 0x06,
+0x12, 0x00, 0x15, 0x06, 0x10, 0x00, 0x0f, 0x02, 0x00, 0xff, 0xff, 0x17, 0x4f, 0x38, 0x08, 0x02,
+0x11, 0x2c, 0x02, 0x14, 0xd0, 0x30, 0x4a, 0x80, 0x00, 0x00, 0xc2, 0x12, 0x58, 0xff, 0x00, 0x01,
+0xde, 0x12, 0x34, 0x00, 0x30, 0x01, 0x00, 0x08, 0x07, 0x00, 0x50, 0x00, 0xda, 0x2e, 0xda, 0x2e,
+0x09, 0x00, 0x20, 0x0e, 0x03, 0x06, 0x00, 0x06, 0x02, 0x00, 0x26, 0x26, 0x19, 0x0c, 0x00, 0x0f,
+0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x16, 0xc0, 0x38, 0x09, 0x0f, 0x02, 0x00, 0xe2,
+0x37, 0x8c, 0x03, 0xc0, 0x66, 0x0a, 0x02, 0x5d, 0x0f, 0x04, 0x02, 0x00, 0x0a, 0x0e, 0x00, 0x0f,
+0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xaf, 0xc4, 0x0f, 0xd4, 0x0f,
+0x08, 0x10, 0x80, 0x82, 0x74, 0x82, 0xc8, 0x08, 0x05, 0xf0, 0x2d, 0xf8, 0x06, 0x2e, 0x07, 0x38,
+0x07, 0x50, 0x07, 0x62, 0x07, 0x78, 0x07, 0x9c, 0x07, 0xac, 0x07, 0x28, 0x08, 0x40, 0x08, 0x90,
+0x08, 0xcc, 0x08, 0xd2, 0x08, 0xd2, 0x09, 0xd8, 0x08, 0x46, 0x09, 0xd0, 0x09, 0x26, 0x0a, 0x3a,
+0x0a, 0x44, 0x0a, 0x60, 0x0a, 0x7e, 0x0a, 0xb4, 0x0a, 0xba, 0x0a, 0xc2, 0x0a, 0x5c, 0x0b, 0x84,
+0x0b, 0xa6, 0x0b, 0xce, 0x0b, 0xee, 0x0b, 0xcd, 0x12, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xa8, 0x2f, 0x78, 0x84, 0xb8, 0x05, 0xeb, 0x55, 0x54, 0x84, 0x3c, 0x84, 0x48, 0x04, 0x01,
+0x24, 0x24, 0x0e, 0x0e, 0x01, 0x75, 0x8c, 0x82, 0x98, 0x82, 0x60, 0x84, 0x6c, 0x1a, 0x00, 0x0f,
+0x02, 0x00, 0x2d, 0x2f, 0xc8, 0x47, 0x42, 0x00, 0x17, 0xf5, 0x08, 0x0d, 0x00, 0x3c, 0x10, 0x7c,
+0x13, 0x07, 0x00, 0x22, 0x13, 0xdc, 0xa2, 0x6c, 0x13, 0x00, 0xa4, 0x54, 0x02, 0x78, 0x04, 0x84,
+0x84, 0x20, 0x41, 0x00, 0xf5, 0x03, 0x82, 0x81, 0xb2, 0x81, 0x12, 0x80, 0xa2, 0x81, 0xd6, 0x83,
+0x18, 0x80, 0xa4, 0x82, 0xa4, 0x82, 0x80, 0xbf, 0x1b, 0x00, 0x0b, 0x02, 0x00, 0x2a, 0x3c, 0x02,
+0x11, 0x00, 0x57, 0xe8, 0x81, 0xe8, 0x81, 0xa4, 0x02, 0x08, 0x55, 0x2e, 0x82, 0xa0, 0x06, 0x4e,
+0xf4, 0x00, 0x5f, 0x00, 0x00, 0x66, 0x80, 0x66, 0xf5, 0x10, 0xfe, 0x20, 0xa2, 0x81, 0x1a, 0x01,
+0x22, 0x00, 0x00, 0x05, 0x19, 0x2f, 0xfe, 0xff, 0x01, 0x00, 0x05, 0x81, 0xd6, 0x83, 0x12, 0x80,
+0x09, 0x03, 0x58, 0xfe, 0x2c, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0e, 0x02, 0xd8, 0x02, 0x47, 0x1c,
+0x91, 0x80, 0x00, 0xa0, 0x00, 0xe0, 0x00, 0x20, 0x00, 0x40, 0x16, 0x00, 0x02, 0x07, 0x00, 0xf1,
+0x04, 0x01, 0x00, 0xea, 0x82, 0x52, 0x4f, 0x4d, 0x2d, 0x70, 0x72, 0x6f, 0x63, 0x20, 0x6c, 0x6f,
+0x61, 0x64, 0x65, 0x72, 0xdf, 0x01, 0xc2, 0xe8, 0x81, 0x00, 0x00, 0x12, 0x80, 0x00, 0x00, 0x29,
+0x82, 0x81, 0x04, 0x2f, 0x00, 0x44, 0x3a, 0x04, 0x40, 0x04, 0x46, 0x00, 0x15, 0xc0, 0x46, 0x00,
+0x03, 0x9d, 0x21, 0x90, 0x10, 0x00, 0x00, 0x52, 0x65, 0x73, 0x65, 0x74, 0x20, 0x48, 0x00, 0x51,
+0x65, 0x73, 0x73, 0x20, 0x20, 0x46, 0x00, 0x20, 0x2e, 0x82, 0x46, 0x00, 0x20, 0x52, 0x09, 0x02,
+0x00, 0xae, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x3e, 0x05, 0x54, 0x05, 0x46, 0x00, 0x11, 0x10,
+0x63, 0x00, 0xc4, 0xf0, 0x4f, 0x00, 0x00, 0x4b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x49,
+0x00, 0x00, 0x19, 0x00, 0x03, 0x28, 0x02, 0x62, 0x04, 0x2e, 0x82, 0x72, 0x06, 0xff, 0x26, 0x14,
+0x80, 0x04, 0x2e, 0x82, 0x60, 0x05, 0xff, 0xff, 0xbf, 0x0e, 0x00, 0x71, 0x04, 0x2e, 0x82, 0x54,
+0x09, 0x00, 0x00, 0x1a, 0x00, 0xf2, 0x0c, 0x08, 0x2e, 0x82, 0x00, 0x09, 0xff, 0xff, 0x18, 0x80,
+0x18, 0x80, 0xb2, 0x17, 0xb2, 0x17, 0x00, 0x00, 0x64, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x12,
+0xce, 0x14, 0x76, 0x00, 0x00, 0x06, 0x01, 0x05, 0x02, 0x01, 0x41, 0x01, 0xa2, 0x81, 0x64, 0x48,
+0x1d, 0x91, 0x48, 0x61, 0x72, 0x64, 0x2d, 0x64, 0x69, 0x73, 0x6b, 0x77, 0x00, 0x00, 0x74, 0x00,
+0x4f, 0x00, 0x00, 0x0a, 0x83, 0x60, 0x01, 0x05, 0x04, 0x02, 0x00, 0x00, 0xdc, 0x00, 0x80, 0xef,
+0x00, 0xde, 0x6d, 0x00, 0x01, 0x80, 0x2d, 0x95, 0x01, 0xf1, 0x04, 0x04, 0x03, 0x38, 0x05, 0x04,
+0x00, 0x80, 0x00, 0xc0, 0x01, 0xe0, 0x01, 0x00, 0x02, 0x20, 0x02, 0x40, 0x02, 0x60, 0xf6, 0x02,
+0x01, 0xb8, 0x01, 0xf0, 0x01, 0x40, 0x50, 0x83, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2d, 0x73,
+0x79, 0x73, 0x74, 0x65, 0x6d, 0x63, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x70, 0x83, 0xff, 0xfc, 0xff,
+0x0f, 0xcd, 0x01, 0x08, 0x01, 0x66, 0x00, 0x00, 0x2b, 0x00, 0xd1, 0x29, 0x00, 0x12, 0x02, 0x00,
+0x00, 0xe1, 0x40, 0x00, 0x40, 0xea, 0x2b, 0x04, 0x84, 0x01, 0x45, 0x90, 0x02, 0xb0, 0x02, 0xcc,
+0x00, 0x02, 0x02, 0x00, 0xf3, 0x01, 0x30, 0xb6, 0x83, 0xb4, 0xd8, 0xe1, 0xdf, 0xdb, 0xd5, 0xd9,
+0x5f, 0x56, 0x54, 0x2d, 0x31, 0x30, 0x4d, 0x1e, 0x8f, 0xd6, 0x83, 0xff, 0xeb, 0xff, 0xff, 0xff,
+0x01, 0x67, 0x00, 0x07, 0x02, 0xc6, 0x03, 0x02, 0x45, 0x00, 0x01, 0x02, 0x00, 0x01, 0x93, 0x01,
+0xd0, 0xe0, 0x00, 0x00, 0x01, 0x20, 0x01, 0x40, 0x01, 0x60, 0x01, 0x80, 0x01, 0xa0, 0xeb, 0x01,
+0x00, 0xf8, 0x23, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x84, 0x4f, 0x70, 0x65, 0x72, 0x61, 0x74,
+0x69, 0x6e, 0x67, 0x20, 0xcf, 0x00, 0x44, 0xff, 0x3f, 0x00, 0xf0, 0x1e, 0x01, 0x0f, 0x02, 0x00,
+0x03, 0x20, 0xc0, 0x01, 0x5a, 0x01, 0x00, 0xae, 0x01, 0x20, 0xff, 0xff, 0x84, 0x1f, 0x02, 0x0c,
+0x00, 0x00, 0x55, 0x00, 0x22, 0x0c, 0x04, 0x0c, 0x00, 0x93, 0xbf, 0xff, 0x80, 0x00, 0x00, 0x05,
+0x0c, 0x03, 0x34, 0x61, 0x24, 0x62, 0x00, 0x04, 0x70, 0x83, 0xec, 0x2b, 0x24, 0x00, 0x63, 0x00,
+0x04, 0xa4, 0x82, 0xde, 0x14, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x51, 0x1e, 0x06, 0x1e, 0x06, 0x82, 0x81, 0x57, 0xb0, 0x0c,
+0x00, 0x01, 0x00, 0x0c, 0x00, 0x02, 0x00, 0xf6, 0x8d, 0x02, 0xc5, 0x3b, 0x0a, 0x02, 0x00, 0x03,
+0x13, 0x00, 0x1f, 0x3c, 0x8c, 0x57, 0x0c, 0x0f, 0x42, 0x3c, 0x03, 0x01, 0x02, 0x00, 0x01, 0x7c,
+0x3c, 0x0f, 0x02, 0x00, 0x05, 0x4f, 0x4b, 0x42, 0x7c, 0x09, 0x1c, 0x00, 0x05, 0x0f, 0x02, 0x00,
+0x41, 0x2f, 0xff, 0xf8, 0x56, 0x00, 0x41, 0x0f, 0x02, 0x00, 0xa7, 0xf3, 0x38, 0xdf, 0x15, 0x03,
+0x00, 0x6a, 0xf8, 0xa0, 0x00, 0xc2, 0x15, 0xd0, 0x03, 0x78, 0x02, 0xdf, 0x09, 0x02, 0x04, 0x00,
+0x0a, 0xc2, 0x15, 0x00, 0x20, 0x00, 0x6c, 0x28, 0x00, 0xc0, 0x65, 0xff, 0x01, 0xc0, 0x45, 0xff,
+0x01, 0xc1, 0x15, 0x00, 0x80, 0x40, 0x60, 0x80, 0xe0, 0x21, 0x18, 0x81, 0x20, 0xfd, 0x02, 0x80,
+0x10, 0x82, 0x60, 0x57, 0x0a, 0x00, 0x00, 0xee, 0x02, 0xdf, 0x15, 0x20, 0x04, 0x76, 0xf8, 0xa0,
+0x00, 0xdf, 0x15, 0xc4, 0x08, 0x00, 0x20, 0xde, 0x12, 0x08, 0x00, 0xf3, 0x04, 0xc2, 0x15, 0x20,
+0x20, 0xc3, 0x15, 0x02, 0x00, 0xdf, 0x09, 0xa0, 0x03, 0xc2, 0x15, 0x20, 0x40, 0xc3, 0x15, 0x04,
+0x0c, 0x00, 0x51, 0x60, 0x00, 0xc3, 0x15, 0x0e, 0x0c, 0x00, 0x31, 0xdf, 0x15, 0x01, 0x78, 0x00,
+0xf5, 0x04, 0xc0, 0x15, 0x54, 0x03, 0x1f, 0x10, 0x58, 0xff, 0xa0, 0x00, 0xdf, 0x17, 0x56, 0x03,
+0x90, 0x03, 0xc0, 0x15, 0x8c, 0x10, 0x00, 0xf0, 0x21, 0x24, 0x03, 0x96, 0xe2, 0xdf, 0x0b, 0x58,
+0xde, 0xfd, 0x03, 0xc0, 0x15, 0x09, 0x03, 0xc1, 0x15, 0x58, 0xfe, 0xc8, 0x95, 0x08, 0x00, 0x97,
+0x0a, 0xae, 0x0e, 0x02, 0x02, 0x57, 0x92, 0x08, 0x00, 0xc8, 0xa5, 0x0a, 0x00, 0x09, 0x02, 0xc8,
+0x97, 0xba, 0x02, 0x04, 0x80, 0x48, 0x92, 0x08, 0x8c, 0x02, 0x00, 0xf0, 0x19, 0xc8, 0x45, 0x00,
+0xf8, 0xc9, 0x15, 0x06, 0x03, 0xa0, 0x00, 0xc9, 0x8b, 0xfe, 0x80, 0xc9, 0x35, 0x00, 0xff, 0x05,
+0x03, 0xc8, 0xb5, 0x08, 0x00, 0xdb, 0x03, 0x88, 0x8a, 0xe2, 0x01, 0xdf, 0x95, 0xff, 0xff, 0xba,
+0x02, 0xdf, 0x15, 0x1b, 0xeb, 0xf4, 0x00, 0x04, 0x84, 0x00, 0x10, 0xb3, 0x0c, 0x3f, 0x42, 0x00,
+0x00, 0x60, 0x00, 0x08, 0x00, 0x08, 0x02, 0x00, 0x01, 0xbc, 0x02, 0x0f, 0x38, 0x3f, 0x05, 0x0f,
+0xf6, 0x02, 0x07, 0x91, 0x04, 0x00, 0x0c, 0x00, 0x28, 0x00, 0x68, 0xc6, 0x00, 0x04, 0x00, 0x93,
+0x00, 0xc5, 0x00, 0x00, 0x28, 0xc5, 0x00, 0x00, 0x50, 0x04, 0x00, 0x93, 0x78, 0xc5, 0x00, 0x00,
+0xa0, 0xc5, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x22, 0xf0, 0xc5, 0x28, 0x00, 0x11, 0x04, 0x02, 0x00,
+0x00, 0x58, 0x00, 0xa0, 0x08, 0x00, 0xc0, 0x00, 0x11, 0x00, 0x1e, 0x00, 0x01, 0x02, 0x20, 0x01,
+0xf0, 0x19, 0xc1, 0x15, 0x23, 0x00, 0x20, 0x0a, 0x42, 0x7e, 0xca, 0x65, 0x02, 0x00, 0x03, 0x03,
+0xdf, 0x15, 0x02, 0x00, 0x3a, 0x03, 0x9f, 0x14, 0x20, 0x03, 0x03, 0x02, 0xdf, 0x15, 0x00, 0xa0,
+0x34, 0x03, 0x9f, 0x12, 0x1e, 0x03, 0xc2, 0x65, 0xe6, 0xff, 0xbe, 0x01, 0xf0, 0x14, 0xdf, 0x10,
+0x7e, 0xf8, 0xa0, 0x00, 0x83, 0x0c, 0xc1, 0x15, 0x24, 0x03, 0x11, 0x10, 0xc0, 0x65, 0x20, 0x00,
+0xc4, 0x7e, 0xc0, 0x17, 0x0e, 0x80, 0x00, 0x1c, 0x1e, 0x00, 0x01, 0x10, 0xdf, 0x15, 0x0e, 0x03,
+0x8c, 0xee, 0x01, 0xfe, 0x08, 0x17, 0x02, 0x80, 0xd1, 0x95, 0xff, 0xff, 0x83, 0x7e, 0x87, 0x00,
+0x01, 0x10, 0xc1, 0x65, 0x30, 0x00, 0x91, 0x94, 0xfe, 0x02, 0x87, 0x00, 0x3c, 0x42, 0x41, 0xc2,
+0x15, 0x70, 0x04, 0x58, 0x00, 0x41, 0x15, 0x46, 0x80, 0x6c, 0xec, 0x01, 0x20, 0x00, 0x10, 0x3c,
+0x01, 0x20, 0xc6, 0x11, 0x3e, 0x01, 0x12, 0x74, 0x12, 0x00, 0x20, 0x00, 0x66, 0xc0, 0x01, 0xfe,
+0x16, 0x15, 0x7a, 0x80, 0x7a, 0xf8, 0xa0, 0x00, 0xc5, 0x15, 0x00, 0xd8, 0xc4, 0x15, 0xc0, 0x03,
+0x40, 0x15, 0x07, 0x80, 0x01, 0x1c, 0x0a, 0x00, 0xc1, 0x25, 0xff, 0xff, 0x02, 0x03, 0x75, 0x10,
+0xfe, 0x1f, 0x0a, 0x7f, 0xe5, 0x01, 0x58, 0x42, 0x22, 0x84, 0x04, 0xf8, 0x41, 0x00, 0xf6, 0x41,
+0x11, 0x72, 0x22, 0x41, 0x20, 0x00, 0x08, 0xf6, 0x41, 0x12, 0x46, 0xaa, 0x03, 0x63, 0x04, 0x60,
+0x05, 0xff, 0xff, 0x48, 0x0c, 0x00, 0x00, 0x32, 0x42, 0x0e, 0x54, 0x42, 0x31, 0xc2, 0x15, 0xb2,
+0xa4, 0x00, 0xf1, 0x0a, 0xc0, 0x65, 0x28, 0x00, 0x1f, 0x10, 0x5e, 0x05, 0xdf, 0x15, 0x02, 0x0f,
+0x20, 0x0e, 0xdf, 0x15, 0x1e, 0x0e, 0x1e, 0x0e, 0xdf, 0x15, 0xa6, 0x04, 0x70, 0xa6, 0x00, 0x13,
+0x9a, 0x08, 0x00, 0x11, 0x82, 0x08, 0x00, 0x73, 0x1f, 0x10, 0x3a, 0x0e, 0xdf, 0x15, 0x8e, 0x0c,
+0x00, 0x93, 0x3c, 0x0e, 0xc0, 0x15, 0xa0, 0x06, 0xdf, 0x15, 0x56, 0xe4, 0x00, 0x20, 0xf0, 0x4f,
+0xe4, 0x00, 0x51, 0xdf, 0x15, 0x38, 0x08, 0x40, 0x3c, 0x00, 0xa0, 0x84, 0x04, 0x32, 0x0e, 0xdf,
+0x15, 0xf0, 0x00, 0x36, 0xe2, 0x0c, 0x00, 0x20, 0x82, 0x04, 0x06, 0x00, 0xf0, 0x09, 0x26, 0x05,
+0xc6, 0x11, 0xc0, 0x15, 0x52, 0x09, 0x01, 0x10, 0x02, 0x10, 0xc3, 0x17, 0x36, 0x0e, 0xc4, 0x15,
+0xc0, 0x07, 0xdf, 0x17, 0x32, 0x0e, 0x14, 0x01, 0xf8, 0xff, 0x0e, 0xe6, 0x15, 0x3e, 0x05, 0x26,
+0x10, 0x4a, 0x08, 0x56, 0x82, 0x00, 0x0a, 0xdf, 0x15, 0x22, 0x0e, 0x9c, 0xf8, 0xa0, 0x00, 0xc0,
+0x17, 0x46, 0xc8, 0xdf, 0x09, 0x52, 0x06, 0x01, 0x94, 0xc1, 0x45, 0x00, 0xff, 0xc1, 0x0c, 0x44,
+0x1c, 0xde, 0x0b, 0xc8, 0x8b, 0x34, 0x03, 0xf1, 0x8b, 0xdf, 0x0b, 0x08, 0x03, 0x07, 0x81, 0x17,
+0x21, 0x64, 0x10, 0x04, 0x86, 0xcc, 0x8b, 0x02, 0x03, 0x14, 0x8a, 0xf9, 0x01, 0xc4, 0x17, 0x20,
+0x0e, 0x17, 0x21, 0x24, 0x10, 0x24, 0x87, 0x26, 0x10, 0x66, 0x10, 0xa6, 0x10, 0xc4, 0x15, 0x64,
+0x0e, 0x00, 0x11, 0x17, 0x20, 0x64, 0x10, 0x10, 0x86, 0xc8, 0x8b, 0x02, 0x02, 0x80, 0x0a, 0xf9,
+0x01, 0xc1, 0x15, 0xde, 0x0b, 0xc2, 0x15, 0x00, 0x01, 0x11, 0x20, 0x02, 0x03, 0x83, 0x7e, 0x00,
+0x00, 0x21, 0x11, 0x14, 0x94, 0xfe, 0x02, 0xed, 0x01, 0x1f, 0x11, 0x20, 0x0e, 0x02, 0x11, 0x97,
+0x20, 0x64, 0x10, 0x02, 0x86, 0x12, 0x8a, 0xfb, 0x01, 0x82, 0x15, 0x81, 0x15, 0x80, 0x15, 0x31,
+0x11, 0xde, 0x0b, 0x14, 0x94, 0x1e, 0x02, 0xc4, 0x17, 0x1e, 0x0e, 0x00, 0x12, 0x0f, 0x80, 0x0c,
+0x20, 0x09, 0x03, 0x26, 0x11, 0x17, 0x21, 0x1e, 0x0e, 0x03, 0x86, 0x14, 0x20, 0xfb, 0x02, 0x24,
+0x0a, 0x84, 0x15, 0x0a, 0x01, 0xd4, 0x0b, 0xcc, 0x0b, 0xfd, 0x03, 0x06, 0x01, 0xc0, 0x55, 0x00,
+0x80, 0xc4, 0x25, 0xde, 0x0d, 0x01, 0x86, 0x24, 0x10, 0x31, 0x10, 0xde, 0x0b, 0x1f, 0x11, 0x1e,
+0x0e, 0x87, 0x00, 0xc8, 0x8b, 0x09, 0x02, 0x24, 0x8a, 0x04, 0x18, 0x04, 0x8a, 0xc4, 0x00, 0x31,
+0x11, 0xde, 0x0b, 0x87, 0x00, 0x14, 0x94, 0x04, 0x03, 0x17, 0x21, 0x62, 0x10, 0xfb, 0x87, 0x24,
+0x8a, 0x1f, 0x11, 0x20, 0x0e, 0x87, 0x00, 0x01, 0x10, 0x57, 0x74, 0xf4, 0xff, 0xc1, 0x45, 0xf1,
+0xff, 0xc1, 0x65, 0x22, 0x0e, 0x5f, 0x14, 0x94, 0xe2, 0x5f, 0x12, 0x96, 0xe2, 0xc0, 0x45, 0x00,
+0xe0, 0xc0, 0x55, 0x00, 0x40, 0x87, 0x00, 0x12, 0x01, 0x11, 0x48, 0x12, 0x01, 0xf0, 0x11, 0xc1,
+0x15, 0x10, 0x00, 0x02, 0x94, 0x03, 0x03, 0xdf, 0x09, 0xe4, 0x08, 0x45, 0x7e, 0xff, 0x35, 0x80,
+0x00, 0xa2, 0x07, 0x02, 0x02, 0x5f, 0x00, 0x06, 0x09, 0x87, 0x00, 0xdf, 0x15, 0x10, 0x00, 0x7c,
+0x01, 0xf0, 0x0f, 0x50, 0x00, 0x36, 0xe2, 0xc0, 0x15, 0x44, 0x0e, 0xc1, 0x15, 0x54, 0x0e, 0xc5,
+0x15, 0x08, 0x00, 0xc4, 0x17, 0x34, 0xe2, 0x09, 0x12, 0x03, 0x11, 0xc3, 0x45, 0x07, 0x00, 0xc3,
+0x0c, 0x02, 0x00, 0xf0, 0x79, 0xc4, 0x45, 0xf8, 0xff, 0x03, 0xdd, 0x74, 0x09, 0xd1, 0x78, 0xd0,
+0x10, 0x50, 0x7f, 0xdf, 0x15, 0xc2, 0x00, 0x36, 0xe2, 0x1f, 0x0a, 0x3e, 0x0e, 0x1f, 0x0a, 0x42,
+0x0e, 0xdf, 0x45, 0x12, 0x00, 0x40, 0x0e, 0xc5, 0x15, 0x00, 0x04, 0xc4, 0x15, 0x4c, 0x0e, 0x5f,
+0x31, 0x4a, 0x0e, 0x07, 0x03, 0x5f, 0x41, 0x4a, 0x0e, 0x5f, 0x41, 0x5a, 0x0e, 0xdf, 0x55, 0x10,
+0x00, 0x40, 0x0e, 0x5f, 0x31, 0x48, 0x0e, 0x0a, 0x03, 0x5f, 0x41, 0x48, 0x0e, 0x5f, 0x41, 0x58,
+0x0e, 0xdf, 0x95, 0xe0, 0x00, 0x3e, 0x0e, 0xdf, 0x55, 0x20, 0x00, 0x42, 0x0e, 0x05, 0x0c, 0x4c,
+0x31, 0x0c, 0x03, 0x4c, 0x41, 0x5f, 0x41, 0x5c, 0x0e, 0xdf, 0x95, 0x20, 0x00, 0x3f, 0x0e, 0xdf,
+0x55, 0x40, 0x00, 0x42, 0x0e, 0xdf, 0x55, 0x02, 0x00, 0x40, 0x0e, 0x8c, 0x0c, 0x06, 0x86, 0xdf,
+0x45, 0x01, 0x00, 0x5c, 0x0e, 0xdf, 0x55, 0x80, 0x00, 0x42, 0x0e, 0xcc, 0x0c, 0x4a, 0x00, 0x00,
+0x5e, 0x00, 0x03, 0x4a, 0x00, 0x50, 0x55, 0x04, 0x00, 0x1e, 0x80, 0xb2, 0x00, 0xf0, 0x17, 0xc2,
+0x15, 0xff, 0xff, 0x04, 0x18, 0xe1, 0x0b, 0x04, 0x02, 0xc2, 0x65, 0x0b, 0x00, 0x46, 0x7f, 0x87,
+0x00, 0xc4, 0x0b, 0x11, 0x02, 0xa6, 0x10, 0x26, 0x11, 0x44, 0x12, 0x04, 0x0c, 0x82, 0x0a, 0xfd,
+0x86, 0x9f, 0x20, 0x34, 0x0e, 0xd4, 0x03, 0xe6, 0xff, 0xff, 0x34, 0x0e, 0xc4, 0x0b, 0xf5, 0x02,
+0x84, 0x15, 0x82, 0x15, 0xe9, 0x01, 0x1c, 0x00, 0xf0, 0x07, 0xe6, 0x03, 0x9f, 0x10, 0x34, 0x0e,
+0xdf, 0x15, 0x19, 0x00, 0x36, 0x0e, 0xdf, 0x15, 0x10, 0x01, 0x32, 0x0e, 0x05, 0x01, 0xc2, 0x17,
+0x12, 0x00, 0xf0, 0x13, 0x05, 0x00, 0x36, 0x0e, 0xc2, 0xa5, 0x2b, 0x00, 0x25, 0x02, 0xdf, 0x8b,
+0x3f, 0x0e, 0x11, 0x02, 0xc5, 0x15, 0x04, 0x00, 0x5f, 0x79, 0x40, 0x0e, 0x5f, 0x31, 0x40, 0x0e,
+0x05, 0x03, 0xdf, 0x15, 0x32, 0x07, 0xc8, 0x02, 0x00, 0x4e, 0x01, 0x13, 0x00, 0x0a, 0x00, 0x00,
+0x92, 0x00, 0x08, 0x22, 0x00, 0x11, 0x00, 0xea, 0x02, 0x00, 0x22, 0x00, 0x02, 0xf4, 0x02, 0x00,
+0x0a, 0x00, 0xf0, 0x2f, 0xdc, 0x08, 0x42, 0xf8, 0xa0, 0x00, 0x82, 0x9c, 0x86, 0x0b, 0x1c, 0x81,
+0xdf, 0x8b, 0x3e, 0x0e, 0x08, 0x03, 0x82, 0x9c, 0x9c, 0x09, 0x97, 0xa0, 0x40, 0x00, 0x0a, 0x87,
+0xc2, 0x45, 0xe0, 0x00, 0x07, 0x01, 0xc5, 0x17, 0x40, 0x0e, 0x45, 0x1d, 0x7c, 0x09, 0x85, 0x60,
+0x02, 0x0a, 0x42, 0xd3, 0x9f, 0x10, 0xe0, 0x08, 0xc5, 0x17, 0x1e, 0x0e, 0xc5, 0x25, 0x1e, 0x0e,
+0x23, 0x02, 0xce, 0x01, 0xa0, 0x35, 0x01, 0xc2, 0x45, 0xe0, 0xff, 0xc2, 0x67, 0x42, 0x0e, 0x1c,
+0x00, 0xb1, 0xdf, 0x55, 0x00, 0x01, 0xe0, 0x08, 0xdf, 0x15, 0xe0, 0x08, 0x44, 0x56, 0x03, 0x20,
+0x78, 0x04, 0x96, 0x00, 0xf0, 0x01, 0xc2, 0x0c, 0x83, 0x1c, 0xde, 0x0b, 0x06, 0x80, 0xcb, 0x17,
+0xe0, 0x08, 0x02, 0x86, 0x32, 0x0a, 0x56, 0x02, 0x04, 0x46, 0x00, 0xf1, 0x00, 0x09, 0x03, 0xdd,
+0x17, 0xe0, 0x08, 0x05, 0x86, 0xd5, 0x0b, 0xfe, 0x03, 0xe5, 0x0b, 0x5f, 0x84, 0x02, 0xf1, 0x02,
+0xc2, 0x10, 0xc2, 0x35, 0x00, 0xff, 0x03, 0x02, 0xc2, 0x8b, 0xc7, 0x02, 0x87, 0x00, 0xc2, 0x94,
+0x07, 0x38, 0x02, 0x24, 0xfb, 0x01, 0x58, 0x00, 0x00, 0x40, 0x02, 0xf7, 0x3f, 0x62, 0x05, 0x16,
+0x03, 0x87, 0x00, 0x23, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x30, 0x08, 0xc5, 0x17, 0x26, 0x05, 0x95,
+0x90, 0x57, 0x21, 0x26, 0x05, 0x02, 0x02, 0xc5, 0x15, 0x84, 0x04, 0x5f, 0x21, 0x82, 0x04, 0x02,
+0x03, 0x5f, 0x11, 0x26, 0x05, 0x87, 0x00, 0xdf, 0x97, 0x39, 0x0e, 0x38, 0x0e, 0xc5, 0x17, 0x82,
+0x04, 0x5f, 0x21, 0x26, 0x05, 0x06, 0x02, 0x3f, 0x0a, 0x26, 0x05, 0xdf, 0x45, 0x80, 0x00, 0x70,
+0xcf, 0x87, 0x00, 0x5f, 0x93, 0x72, 0xcf, 0x7f, 0x95, 0x18, 0x05, 0x3a, 0x00, 0x90, 0x11, 0x82,
+0x04, 0xff, 0x55, 0x80, 0x00, 0x02, 0x05, 0xee, 0x01, 0xf0, 0x1f, 0x70, 0xcf, 0xff, 0xb7, 0x38,
+0x0e, 0xf6, 0x04, 0x06, 0x03, 0xdf, 0x15, 0x6a, 0x80, 0x78, 0xf8, 0xa0, 0x00, 0x1f, 0x8a, 0x38,
+0x0e, 0x87, 0x00, 0xc0, 0x17, 0x70, 0xcf, 0xc0, 0x8c, 0x1f, 0xa0, 0x39, 0x0e, 0x09, 0x03, 0x1f,
+0x90, 0x39, 0x0e, 0x1f, 0x90, 0x38, 0x0e, 0xea, 0x02, 0x24, 0x00, 0x00, 0x20, 0x05, 0xf8, 0x0f,
+0x87, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x9c, 0x09, 0xcd, 0x09, 0xfe, 0x09,
+0x2f, 0x0a, 0x60, 0x0a, 0x91, 0x0a, 0xc2, 0x0a, 0xf3, 0x0a, 0x24, 0x0b, 0x55, 0x0b, 0x04, 0x00,
+0xf9, 0x53, 0x3b, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x2d, 0x3a, 0x6a,
+0x63, 0x75, 0x6b, 0x65, 0x6e, 0x67, 0x5b, 0x5d, 0x7a, 0x68, 0x5f, 0x2f, 0x66, 0x79, 0x77, 0x61,
+0x70, 0x72, 0x6f, 0x6c, 0x64, 0x76, 0x5c, 0x2e, 0x71, 0x5e, 0x73, 0x6d, 0x69, 0x74, 0x78, 0x62,
+0x40, 0x2c, 0x20, 0x2b, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x3d, 0x2a,
+0x4a, 0x43, 0x55, 0x4b, 0x45, 0x4e, 0x47, 0x7b, 0x7d, 0x5a, 0x48, 0x20, 0x3f, 0x46, 0x59, 0x57,
+0x41, 0x50, 0x52, 0x4f, 0x4c, 0x44, 0x56, 0x7c, 0x3e, 0x51, 0x7e, 0x53, 0x4d, 0x49, 0x54, 0x58,
+0x42, 0x60, 0x3c, 0x20, 0x62, 0x00, 0x03, 0x31, 0x00, 0x66, 0x5b, 0x5d, 0x5a, 0x48, 0x5f, 0x2f,
+0x31, 0x00, 0x42, 0x5c, 0x2e, 0x51, 0x5e, 0x31, 0x00, 0x0c, 0x62, 0x00, 0x03, 0x93, 0x00, 0x66,
+0x7b, 0x7d, 0x7a, 0x68, 0x20, 0x3f, 0x93, 0x00, 0x42, 0x7c, 0x3e, 0x71, 0x7e, 0x93, 0x00, 0x0c,
+0x62, 0x00, 0xfb, 0x13, 0xd9, 0xe6, 0xe3, 0xda, 0xd5, 0xdd, 0xd3, 0xe8, 0xe9, 0xd7, 0xe5, 0xea,
+0x2f, 0xe4, 0xeb, 0xd2, 0xd0, 0xdf, 0xe0, 0xde, 0xdb, 0xd4, 0xd6, 0xed, 0x2e, 0xef, 0xe7, 0xe1,
+0xdc, 0xd8, 0xe2, 0xec, 0xd1, 0xee, 0xc4, 0x00, 0xfb, 0x13, 0xb9, 0xc6, 0xc3, 0xba, 0xb5, 0xbd,
+0xb3, 0xc8, 0xc9, 0xb7, 0xc5, 0xca, 0x3f, 0xc4, 0xcb, 0xb2, 0xb0, 0xbf, 0xc0, 0xbe, 0xbb, 0xb4,
+0xb6, 0xcd, 0x3e, 0xcf, 0xc7, 0xc1, 0xbc, 0xb8, 0xc2, 0xcc, 0xb1, 0xce, 0x62, 0x00, 0x08, 0x31,
+0x00, 0x17, 0x2f, 0x31, 0x00, 0x15, 0x2e, 0x31, 0x00, 0x0b, 0x62, 0x00, 0x08, 0x93, 0x00, 0x17,
+0x3f, 0x93, 0x00, 0x15, 0x3e, 0x93, 0x00, 0x81, 0x3c, 0x20, 0x3b, 0xa5, 0xa4, 0x33, 0x95, 0x94,
+0x88, 0x01, 0xf2, 0x3f, 0x81, 0x8b, 0xa0, 0xa6, 0xa1, 0x90, 0x96, 0x91, 0x8a, 0x82, 0x86, 0x8f,
+0x87, 0x85, 0x2f, 0xa9, 0xaa, 0xa7, 0x99, 0x9a, 0x97, 0x8d, 0x9f, 0x83, 0x8e, 0x9e, 0x84, 0xa3,
+0xa8, 0xa2, 0x93, 0x98, 0x92, 0x89, 0x80, 0x8c, 0x88, 0x20, 0xf0, 0xf1, 0x22, 0xfc, 0xfd, 0xad,
+0xae, 0xaf, 0xab, 0xac, 0xfb, 0xfa, 0xf6, 0xf7, 0xf8, 0xf9, 0xf3, 0xf2, 0xf5, 0xf4, 0x7b, 0x7d,
+0x5a, 0x48, 0x5f, 0x9b, 0x9c, 0x9d, 0xfe, 0x41, 0x50, 0x52, 0x4f, 0x4c, 0x44, 0x56, 0x7c, 0x3e,
+0x51, 0x7e, 0x57, 0x01, 0xf0, 0xbc, 0x60, 0x3c, 0x20, 0x83, 0x86, 0x90, 0x91, 0x0b, 0x09, 0x0c,
+0x19, 0x0a, 0x89, 0x8e, 0x82, 0x85, 0x92, 0x93, 0x18, 0x16, 0x8f, 0x94, 0x17, 0x88, 0x8a, 0x81,
+0x84, 0x9f, 0x8b, 0x25, 0x23, 0x95, 0x96, 0x24, 0x87, 0x80, 0x00, 0x27, 0x29, 0x28, 0x2c, 0x2f,
+0x30, 0x2b, 0x97, 0x00, 0x01, 0x26, 0x1b, 0x1d, 0x1c, 0x20, 0x2e, 0x2a, 0x1f, 0x2d, 0x00, 0x02,
+0x1a, 0x0e, 0x10, 0x0f, 0x13, 0x22, 0x1e, 0x12, 0x21, 0x00, 0x00, 0x0d, 0x01, 0x03, 0x02, 0x06,
+0x15, 0x11, 0x05, 0x14, 0x8c, 0x98, 0x00, 0x99, 0x9a, 0x9b, 0x9c, 0x08, 0x04, 0x9d, 0x07, 0x8d,
+0x9e, 0x64, 0x0e, 0x68, 0x0e, 0x6c, 0x0e, 0x70, 0x0e, 0x74, 0x0e, 0x78, 0x0e, 0x7c, 0x0e, 0x80,
+0x0e, 0x84, 0x0e, 0x88, 0x0e, 0x94, 0x0e, 0xac, 0x0e, 0x8c, 0x0e, 0x90, 0x0e, 0x98, 0x0e, 0x0d,
+0x00, 0xb0, 0x0e, 0x00, 0x00, 0xb4, 0x0e, 0xb8, 0x0e, 0x9c, 0x0e, 0xa4, 0x0e, 0xa0, 0x0e, 0xa8,
+0x0e, 0x09, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x7f,
+0x00, 0xbc, 0x0e, 0xc0, 0x0e, 0xc4, 0x0e, 0xc8, 0x0e, 0xcc, 0x0e, 0xd0, 0x0e, 0xd4, 0x0e, 0xd8,
+0x0e, 0xdc, 0x0e, 0xe0, 0x0e, 0xf4, 0x0e, 0xf0, 0x0e, 0xfc, 0x0e, 0xff, 0x0e, 0xf8, 0x0e, 0x00,
+0x00, 0x0e, 0x00, 0x00, 0x00, 0xf3, 0x0e, 0x0f, 0x00, 0xe4, 0x0e, 0xea, 0x0e, 0xe7, 0x0e, 0xed,
+0x0e, 0xbc, 0x08, 0x0f, 0x02, 0x00, 0xff, 0xba, 0x4c, 0x1e, 0x0e, 0x02, 0x0f, 0xd0, 0x01, 0x01,
+0x13, 0x0b, 0x67, 0x00, 0x00, 0x00, 0x8e, 0x82, 0x9a, 0xf2, 0x4d, 0x0f, 0x02, 0x00, 0x09, 0xff,
+0x8e, 0x1b, 0x4f, 0x70, 0x00, 0x1b, 0x4f, 0x71, 0x00, 0x1b, 0x4f, 0x72, 0x00, 0x1b, 0x4f, 0x73,
+0x00, 0x1b, 0x4f, 0x74, 0x00, 0x1b, 0x4f, 0x75, 0x00, 0x1b, 0x4f, 0x76, 0x00, 0x1b, 0x4f, 0x77,
+0x00, 0x1b, 0x4f, 0x78, 0x00, 0x1b, 0x4f, 0x79, 0x00, 0x1b, 0x4f, 0x6d, 0x00, 0x1b, 0x4f, 0x6c,
+0x00, 0x1b, 0x4f, 0x6e, 0x00, 0x1b, 0x4f, 0x4d, 0x00, 0x1b, 0x5b, 0x41, 0x00, 0x1b, 0x5b, 0x42,
+0x00, 0x1b, 0x5b, 0x43, 0x00, 0x1b, 0x5b, 0x44, 0x00, 0x1b, 0x4f, 0x50, 0x00, 0x1b, 0x4f, 0x51,
+0x00, 0x1b, 0x4f, 0x52, 0x00, 0x1b, 0x4f, 0x53, 0x00, 0x1b, 0x3f, 0x70, 0x00, 0x1b, 0x3f, 0x71,
+0x00, 0x1b, 0x3f, 0x72, 0x00, 0x1b, 0x3f, 0x73, 0x00, 0x1b, 0x3f, 0x74, 0x00, 0x1b, 0x3f, 0x75,
+0x00, 0x1b, 0x3f, 0x76, 0x00, 0x1b, 0x3f, 0x77, 0x00, 0x1b, 0x3f, 0x78, 0x00, 0x1b, 0x3f, 0x79,
+0x00, 0x1b, 0x41, 0x00, 0x1b, 0x42, 0x00, 0x1b, 0x43, 0x00, 0x1b, 0x44, 0x00, 0x1b, 0x50, 0x00,
+0x00, 0x1b, 0x3f, 0x6e, 0x00, 0x1b, 0x3f, 0x4d, 0x00, 0x1b, 0x51, 0x00, 0x1b, 0x52, 0xba, 0x00,
+0x0a, 0x0f, 0x02, 0x00, 0xff, 0x36, 0x10, 0x08, 0x9f, 0x4e, 0x60, 0x03, 0x01, 0x00, 0x03, 0xe1,
+0x02, 0x72, 0x10, 0x63, 0x01, 0x02, 0x1f, 0x05, 0xff, 0x60, 0x5d, 0x01, 0xf0, 0x19, 0xc0, 0x15,
+0x7a, 0x10, 0x1f, 0x0a, 0x8e, 0x10, 0xd7, 0x65, 0x01, 0x00, 0x03, 0x00, 0x0c, 0x87, 0xdf, 0x8b,
+0x38, 0xe2, 0xf9, 0x80, 0xdf, 0xa5, 0xbf, 0x00, 0x38, 0xe2, 0x05, 0x86, 0xd0, 0x97, 0x3a, 0xe2,
+0xc0, 0x25, 0x82, 0x10, 0xf0, 0x86, 0x92, 0x08, 0xf1, 0x1a, 0x10, 0x00, 0x3e, 0xe2, 0xc1, 0x15,
+0x00, 0x04, 0x1f, 0x0a, 0x3e, 0xe2, 0x41, 0x7e, 0xc0, 0x15, 0x6e, 0x10, 0xc1, 0x15, 0x03, 0x00,
+0x04, 0x01, 0xc0, 0x15, 0x71, 0x10, 0x41, 0x95, 0x48, 0x95, 0x1f, 0x0a, 0xd4, 0x10, 0x57, 0x60,
+0x06, 0x00, 0x0d, 0x46, 0x00, 0x13, 0xfa, 0x46, 0x00, 0xf0, 0x09, 0x06, 0x87, 0x17, 0x94, 0x02,
+0x00, 0xdf, 0x17, 0xe8, 0x10, 0x3a, 0xe2, 0x50, 0x7e, 0x85, 0x00, 0x5f, 0x15, 0x02, 0x11, 0xdf,
+0x15, 0x02, 0x11, 0xde, 0x08, 0xf2, 0x35, 0x85, 0x00, 0x50, 0xf2, 0x12, 0x7a, 0xb3, 0x9b, 0xc2,
+0x15, 0xbb, 0x12, 0xc5, 0x15, 0x22, 0xe2, 0x26, 0x0a, 0xce, 0x97, 0xc0, 0x12, 0xce, 0x35, 0x08,
+0x00, 0x02, 0x03, 0xce, 0x55, 0x00, 0xff, 0xce, 0x55, 0x28, 0x00, 0xdf, 0xb5, 0x08, 0x00, 0x3d,
+0x19, 0x02, 0x03, 0xce, 0x45, 0x08, 0x00, 0x95, 0x94, 0x85, 0x0a, 0xc5, 0x25, 0x2a, 0xe2, 0xfb,
+0x86, 0x92, 0x93, 0x95, 0x15, 0xdf, 0x17, 0xbe, 0x12, 0xae, 0x12, 0x20, 0x00, 0xf0, 0x0f, 0x23,
+0x02, 0xca, 0xb5, 0x10, 0x00, 0x05, 0x03, 0xdf, 0x8a, 0x6b, 0x10, 0xdf, 0xc5, 0xfc, 0xff, 0x6b,
+0x10, 0xdf, 0x97, 0x6b, 0x10, 0x3e, 0xe2, 0x8d, 0x92, 0xdf, 0x15, 0xb2, 0x12, 0x6c, 0x00, 0x42,
+0xdf, 0x15, 0xae, 0x12, 0xfa, 0x08, 0x20, 0x02, 0x00, 0x26, 0x0c, 0x02, 0x20, 0x00, 0xf0, 0x01,
+0xcd, 0x35, 0x01, 0x00, 0x01, 0x02, 0xa1, 0x00, 0xdf, 0x35, 0x40, 0x00, 0x22, 0xe2, 0x87, 0x00,
+0xf0, 0x0b, 0xf0, 0x0b, 0xe6, 0x10, 0xc2, 0x17, 0x72, 0x10, 0x1f, 0x8a, 0x72, 0x10, 0xc0, 0x97,
+0xc0, 0x12, 0x00, 0x8c, 0x5f, 0x8c, 0x72, 0x10, 0xdf, 0x97, 0x72, 0x10, 0x74, 0x10, 0x0a, 0x00,
+0xf0, 0x03, 0x00, 0x8c, 0x00, 0x8c, 0xdf, 0x95, 0xdb, 0x00, 0xb8, 0x12, 0x03, 0x86, 0xdf, 0x95,
+0x3b, 0x00, 0xb8, 0x12, 0x16, 0x00, 0x80, 0xdf, 0x97, 0xbe, 0x12, 0x73, 0x10, 0xc2, 0xe7, 0x0a,
+0x00, 0xf0, 0x09, 0xbd, 0x12, 0x75, 0x10, 0xc2, 0x45, 0xfe, 0x00, 0x0e, 0x03, 0x5f, 0x09, 0xc6,
+0x10, 0x03, 0x0f, 0xc3, 0x15, 0x28, 0x00, 0xdf, 0x15, 0x02, 0x01, 0x76, 0x00, 0x00, 0x12, 0x00,
+0x53, 0x01, 0x08, 0xdf, 0x09, 0x82, 0xa0, 0x00, 0x80, 0xdf, 0xa5, 0x24, 0x00, 0xc1, 0x12, 0x04,
+0x02, 0x18, 0x00, 0xe1, 0x09, 0x46, 0x24, 0x01, 0xdf, 0xa5, 0x34, 0x00, 0xc1, 0x12, 0x05, 0x02,
+0xcd, 0x0b, 0x12, 0x00, 0xf2, 0x18, 0x45, 0x1b, 0x01, 0xdf, 0xa5, 0x50, 0x00, 0xc1, 0x12, 0x35,
+0x02, 0xe6, 0x17, 0x72, 0x10, 0xdf, 0x95, 0x02, 0x00, 0x73, 0x10, 0x1f, 0x9d, 0x0a, 0x00, 0x74,
+0x10, 0x1f, 0x9d, 0x0c, 0x00, 0x75, 0x10, 0x1f, 0x9d, 0x0e, 0x00, 0x76, 0x10, 0x2e, 0x00, 0x20,
+0x06, 0x4d, 0x20, 0x00, 0x99, 0x76, 0x10, 0x9f, 0x15, 0x72, 0x10, 0xdf, 0x15, 0xb6, 0xf6, 0x00,
+0x35, 0xc3, 0x15, 0x32, 0x84, 0x00, 0x80, 0xc2, 0x0b, 0x08, 0x03, 0xc2, 0x15, 0x00, 0x02, 0xc8,
+0x01, 0x86, 0x83, 0x7e, 0xdf, 0x55, 0x08, 0x00, 0x3c, 0x19, 0x92, 0x00, 0xa0, 0xcd, 0x0b, 0xdf,
+0xa5, 0x3f, 0x00, 0x7a, 0x10, 0x04, 0x86, 0xb0, 0x0f, 0x51, 0x73, 0x10, 0xa0, 0x00, 0x83, 0xc2,
+0x0c, 0x10, 0x87, 0xce, 0x09, 0xf3, 0x02, 0x0a, 0x32, 0x02, 0xb3, 0x9b, 0x32, 0x02, 0xdb, 0x5a,
+0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x30, 0x24, 0x1a, 0x51, 0x5c, 0x04, 0xde, 0x14, 0xff, 0xff,
+0xfa, 0x4f, 0x62, 0x08, 0x15, 0x54, 0x17, 0xac, 0x14, 0xc0, 0x0e, 0x20, 0x18, 0x00, 0xd4, 0x0d,
+0x00, 0x7e, 0x0c, 0x11, 0x4a, 0xe6, 0x0d, 0xf0, 0x09, 0xc5, 0x15, 0x2e, 0xe2, 0xcd, 0x0b, 0x25,
+0x0a, 0x5f, 0x09, 0xac, 0x10, 0xc3, 0x15, 0x64, 0x00, 0xc4, 0x15, 0x82, 0x18, 0x0d, 0x1d, 0x04,
+0x00, 0xf6, 0x00, 0x2e, 0x02, 0x07, 0x2e, 0x01, 0x00, 0xf4, 0x10, 0xf0, 0x07, 0xef, 0x02, 0xc2,
+0x0b, 0x06, 0x02, 0xdf, 0xb5, 0xc0, 0x00, 0x7a, 0x10, 0x02, 0x02, 0xcc, 0x15, 0x00, 0x40, 0xc4,
+0x65, 0x14, 0x00, 0x1a, 0x00, 0x93, 0xe2, 0x02, 0xd5, 0x15, 0x08, 0x00, 0xc4, 0x15, 0x14, 0xe8,
+0x00, 0x11, 0x00, 0x6c, 0x01, 0xf4, 0x09, 0xcd, 0x35, 0x40, 0x00, 0x05, 0x02, 0x0a, 0x7f, 0x5f,
+0x09, 0xf4, 0x10, 0x50, 0x81, 0x0e, 0x01, 0xcd, 0x15, 0x10, 0x00, 0xc3, 0x15, 0xe8, 0x03, 0x5e,
+0x00, 0x00, 0xfc, 0x01, 0x21, 0x07, 0x03, 0x1e, 0x00, 0xf3, 0x22, 0xf2, 0x9f, 0x0a, 0x6c, 0x10,
+0x5f, 0x00, 0x98, 0x14, 0xc4, 0x15, 0x08, 0x11, 0xcc, 0x09, 0x56, 0x87, 0xc0, 0x15, 0x50, 0x01,
+0xc1, 0x15, 0x20, 0xe2, 0xc9, 0x0b, 0x02, 0x7e, 0xc0, 0x15, 0xb0, 0x00, 0x03, 0x10, 0xc2, 0x15,
+0xd2, 0x17, 0x52, 0x92, 0x02, 0x7e, 0x97, 0x2c, 0xfe, 0xff, 0x2e, 0xa7, 0x38, 0x00, 0x50, 0xe3,
+0x22, 0x8a, 0xc2, 0x7e, 0x38, 0x00, 0xf2, 0x0e, 0xc0, 0x17, 0xd2, 0x17, 0x0c, 0x03, 0x1f, 0x70,
+0xd4, 0x17, 0x40, 0x10, 0x08, 0x03, 0x1f, 0x70, 0xd6, 0x17, 0x5f, 0x20, 0xd8, 0x17, 0x03, 0x02,
+0x1f, 0x20, 0xda, 0x17, 0x03, 0x64, 0x00, 0x90, 0x8b, 0x03, 0x0a, 0xc2, 0x15, 0xe0, 0x17, 0xf2,
+0x45, 0x8f, 0x03, 0xf0, 0x11, 0x80, 0x1c, 0x0a, 0x00, 0x1c, 0x03, 0x32, 0x70, 0x06, 0x00, 0x40,
+0x10, 0x18, 0x03, 0x32, 0x70, 0x02, 0x00, 0x72, 0x20, 0x10, 0x00, 0x13, 0x02, 0x32, 0x20, 0x12,
+0x00, 0x10, 0x02, 0xf2, 0x55, 0x24, 0x00, 0xf0, 0x49, 0xca, 0x35, 0x00, 0x10, 0x02, 0x03, 0xdf,
+0x10, 0x66, 0x10, 0xca, 0x35, 0x00, 0x08, 0x05, 0x03, 0xc4, 0x10, 0x17, 0x75, 0x03, 0x00, 0x1f,
+0x11, 0x68, 0x10, 0xc2, 0x65, 0x14, 0x00, 0x83, 0x0a, 0xc3, 0x25, 0x08, 0x00, 0xd8, 0x02, 0x29,
+0x01, 0xc3, 0x15, 0xbd, 0x12, 0x8b, 0x8a, 0x25, 0x81, 0xcc, 0x09, 0x01, 0x86, 0xf9, 0x03, 0xdf,
+0x92, 0xe8, 0x17, 0x8b, 0x8a, 0xcc, 0x09, 0xfd, 0x86, 0xfc, 0x02, 0xdf, 0x92, 0xea, 0x17, 0xdf,
+0xe7, 0xe8, 0x17, 0xea, 0x17, 0xcb, 0x8a, 0xc3, 0x15, 0xc0, 0x12, 0xcb, 0x95, 0x28, 0x00, 0xcb,
+0x8a, 0x28, 0x00, 0xf0, 0x13, 0xfc, 0x03, 0xcb, 0xc5, 0xf8, 0xff, 0x8b, 0x8a, 0xdf, 0x92, 0xe6,
+0x17, 0xdf, 0x15, 0x00, 0x04, 0xe2, 0x17, 0xdf, 0x15, 0xf8, 0xff, 0xf0, 0x17, 0xdf, 0x55, 0x00,
+0x40, 0xe0, 0x17, 0xdf, 0x15, 0xc2, 0x12, 0xb8, 0x0f, 0xf2, 0x07, 0xd0, 0x0b, 0x1f, 0x10, 0x24,
+0x19, 0xdf, 0x17, 0x66, 0x10, 0x58, 0xce, 0x05, 0x0a, 0xdf, 0xb5, 0x10, 0x00, 0xc0, 0x12, 0x06,
+0x03, 0xb0, 0x01, 0x10, 0x10, 0x6c, 0x10, 0xb0, 0x01, 0xc0, 0x15, 0xb2, 0x17, 0x01, 0x10, 0x02,
+0x0a, 0x5f, 0x11, 0xde, 0x02, 0xf0, 0x11, 0xe6, 0x15, 0xac, 0x14, 0x9f, 0xc0, 0x2c, 0xe2, 0x9f,
+0xc0, 0xc0, 0x12, 0x09, 0x08, 0x3f, 0x0a, 0x42, 0x04, 0xe6, 0x15, 0x54, 0x17, 0xdf, 0x95, 0x03,
+0x00, 0x6b, 0x10, 0x1f, 0x0a, 0x3c, 0x19, 0x00, 0x02, 0x20, 0x26, 0x19, 0x90, 0x0f, 0xf0, 0x0d,
+0xc1, 0x17, 0x58, 0xce, 0xdf, 0x45, 0xfe, 0xff, 0x58, 0xce, 0xdf, 0x09, 0xb4, 0x17, 0xc2, 0x15,
+0x34, 0x19, 0x52, 0x14, 0x52, 0x14, 0x85, 0x10, 0x52, 0x14, 0xdf, 0x95, 0x12, 0x03, 0x80, 0x4a,
+0x12, 0x3b, 0x03, 0x04, 0x80, 0xdf, 0x95, 0x0e, 0x03, 0xf2, 0x09, 0x0a, 0x0b, 0x44, 0x99, 0xc4,
+0x45, 0xf0, 0xff, 0x1f, 0x91, 0x3d, 0x19, 0xc3, 0x15, 0x14, 0x00, 0xc4, 0x70, 0xc3, 0x65, 0xe0,
+0x17, 0xc4, 0x10, 0xfa, 0x03, 0xf2, 0x07, 0x04, 0x02, 0xdf, 0x8b, 0x6c, 0x10, 0x17, 0x03, 0x20,
+0x01, 0xd4, 0x0b, 0x1f, 0x9d, 0x0d, 0x00, 0x6f, 0x10, 0x5f, 0x09, 0xbc, 0x10, 0xac, 0x00, 0x40,
+0x0c, 0x02, 0xdf, 0xd5, 0xb4, 0x00, 0x00, 0x06, 0x00, 0x55, 0x2c, 0xe2, 0xc3, 0x15, 0x10, 0x1c,
+0x02, 0x40, 0xc1, 0x17, 0x38, 0x19, 0x7a, 0x00, 0xc2, 0xcc, 0x35, 0x00, 0x40, 0x07, 0x02, 0x57,
+0xa9, 0xf0, 0x00, 0x13, 0x03, 0x0a, 0x03, 0xf3, 0x1a, 0x87, 0x00, 0xe5, 0x8b, 0x70, 0x03, 0xcd,
+0xa5, 0xfb, 0x00, 0x07, 0x02, 0x09, 0x1d, 0x10, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x01, 0x80, 0xc9,
+0x0a, 0x87, 0x00, 0xcd, 0xa5, 0xf0, 0x00, 0x17, 0x02, 0xdf, 0x0a, 0x3a, 0x19, 0x45, 0x02, 0xc2,
+0x15, 0x14, 0x9a, 0x04, 0xa0, 0x04, 0x02, 0xc4, 0x15, 0xd2, 0x17, 0xc2, 0x15, 0xb0, 0x00, 0x74,
+0x00, 0xc0, 0xc1, 0x12, 0x03, 0x03, 0x54, 0x94, 0x82, 0x7e, 0x87, 0x00, 0x11, 0x95, 0x06, 0x00,
+0xf2, 0x3f, 0xcd, 0xa5, 0xf2, 0x00, 0x32, 0x02, 0xdf, 0x25, 0xd2, 0x58, 0x3a, 0x19, 0x2a, 0x02,
+0x43, 0x10, 0xc2, 0x15, 0xbc, 0x12, 0xd2, 0x97, 0xd2, 0x17, 0xd2, 0x97, 0xde, 0x17, 0xc1, 0x17,
+0x34, 0x19, 0x00, 0x0a, 0x34, 0x72, 0x06, 0x00, 0x01, 0x6d, 0x04, 0x00, 0x00, 0x2d, 0x02, 0x00,
+0x19, 0x83, 0x00, 0x6d, 0x00, 0x00, 0xc0, 0x45, 0x00, 0xf8, 0x12, 0x10, 0xca, 0xc5, 0x0f, 0x00,
+0x52, 0xd0, 0xca, 0x95, 0x50, 0x00, 0xc1, 0x10, 0xc3, 0x15, 0x00, 0x01, 0xc0, 0x15, 0x20, 0xe2,
+0xb4, 0x04, 0xe0, 0xdf, 0x0b, 0x2c, 0xe2, 0x48, 0x94, 0x48, 0x94, 0xc3, 0x7e, 0x5f, 0x00, 0x08,
+0x11, 0x28, 0x0f, 0x00, 0xb6, 0x00, 0x51, 0xcd, 0x25, 0xf1, 0x00, 0xf9, 0x9e, 0x00, 0xf2, 0x01,
+0xf6, 0x02, 0xdf, 0x25, 0x2e, 0xa7, 0x34, 0x19, 0xf2, 0x02, 0xc5, 0x15, 0x3a, 0x19, 0x0d, 0x0a,
+0x3e, 0x00, 0xf4, 0x07, 0xbc, 0x12, 0xd0, 0x15, 0x01, 0xff, 0x10, 0x0a, 0xc8, 0xc5, 0x0f, 0x00,
+0x46, 0x01, 0xcc, 0x0b, 0x02, 0x80, 0x9f, 0x0a, 0x34, 0x19, 0xb4, 0x00, 0x60, 0xcc, 0x35, 0x00,
+0x20, 0xda, 0x02, 0x7e, 0x14, 0xc0, 0xbc, 0x12, 0xc5, 0x15, 0x3b, 0x19, 0x4a, 0x93, 0x25, 0xa0,
+0x4a, 0x0b, 0xa2, 0x00, 0xf5, 0x15, 0x03, 0x1d, 0x0a, 0x00, 0x03, 0x72, 0x43, 0xe0, 0x01, 0x6d,
+0x08, 0x00, 0xca, 0xa0, 0x01, 0x86, 0xca, 0x90, 0xca, 0xa5, 0x04, 0x00, 0x02, 0x86, 0xca, 0x95,
+0x04, 0x00, 0x83, 0x94, 0xdf, 0x90, 0x6b, 0x10, 0x1f, 0x8b, 0x74, 0x05, 0xfa, 0x00, 0x60, 0x34,
+0x19, 0xc3, 0x00, 0xcd, 0xe0, 0x01, 0x80, 0x43, 0x63, 0x52, 0x90, 0x01, 0x10, 0xde, 0x00, 0x40,
+0x03, 0x06, 0x5f, 0x8a, 0xaa, 0x00, 0x0a, 0xe4, 0x00, 0x80, 0x4a, 0xd0, 0x41, 0x19, 0xcd, 0x60,
+0xd5, 0x60, 0x8e, 0x01, 0x01, 0xe4, 0x00, 0x01, 0x46, 0x01, 0x2c, 0x0e, 0x03, 0xec, 0x00, 0xf3,
+0x01, 0xcd, 0x0b, 0x04, 0x80, 0xc8, 0x10, 0xc8, 0x10, 0x8d, 0x0a, 0xfc, 0x81, 0xdf, 0x09, 0x08,
+0x11, 0xba, 0x00, 0xf3, 0x01, 0x02, 0x11, 0x92, 0x11, 0x92, 0xc3, 0x7e, 0x33, 0x87, 0xdf, 0x0b,
+0x3a, 0x19, 0x9f, 0x06, 0x87, 0x96, 0x01, 0x22, 0x0f, 0x03, 0x28, 0x04, 0xf1, 0x02, 0x03, 0x03,
+0xdf, 0xd7, 0x7b, 0x10, 0x3c, 0x19, 0x1f, 0x0c, 0x58, 0xce, 0x04, 0x86, 0xdf, 0x15, 0xd6, 0x2a,
+0x0e, 0xf6, 0x03, 0x10, 0x01, 0xc5, 0x15, 0x98, 0x00, 0xdf, 0x35, 0x01, 0x00, 0x2e, 0xe2, 0x03,
+0x03, 0xdf, 0x57, 0x22, 0xe2, 0x22, 0x00, 0x11, 0xd2, 0x22, 0x00, 0xf0, 0x27, 0xc0, 0x17, 0x3c,
+0x19, 0xc0, 0x00, 0xc0, 0x55, 0x80, 0x00, 0xc0, 0x57, 0x68, 0x10, 0x1f, 0x10, 0x58, 0xce, 0xff,
+0x15, 0x00, 0x04, 0x72, 0x01, 0x87, 0x00, 0x00, 0x0a, 0x17, 0x76, 0x03, 0x00, 0xc0, 0x0c, 0x01,
+0x0c, 0xb1, 0x00, 0x01, 0x0c, 0x01, 0x0c, 0x1f, 0x1c, 0x26, 0x19, 0x94, 0xe2, 0x1f, 0x1c, 0x28,
+0x19, 0x96, 0xe2, 0x24, 0x05, 0x0f, 0x02, 0x00, 0x9d, 0x31, 0x52, 0x00, 0x02, 0x76, 0x0c, 0x80,
+0x0a, 0x00, 0x1e, 0xe1, 0x53, 0x00, 0x68, 0x06, 0xc0, 0x00, 0x3c, 0x52, 0x00, 0x06, 0x14, 0x00,
+0x10, 0x40, 0xac, 0x09, 0xb0, 0x02, 0x00, 0x01, 0x00, 0x14, 0x00, 0x14, 0xd1, 0x53, 0x00, 0xd0,
+0xd3, 0x72, 0x41, 0x40, 0x52, 0x00, 0x04, 0x28, 0x00, 0x11, 0x11, 0x14, 0x00, 0x20, 0xe4, 0x0a,
+0x3c, 0x00, 0x13, 0x50, 0x28, 0x00, 0x01, 0x0d, 0x00, 0x03, 0x50, 0x00, 0x0f, 0x14, 0x00, 0x29,
+0x20, 0x7c, 0x84, 0x68, 0x56, 0x09, 0x6e, 0x57, 0x01, 0x2e, 0x16, 0x10, 0xff, 0x08, 0x00, 0x0f,
+0x02, 0x00, 0xac, 0x22, 0x50, 0x43, 0xf6, 0x57, 0x0f, 0xce, 0x56, 0x01, 0x00, 0x02, 0x00, 0x31,
+0x08, 0x03, 0xcc, 0xfa, 0x19, 0x11, 0xca, 0x06, 0x00, 0x0f, 0x02, 0x00, 0xaf, 0x0f, 0x00, 0x1a,
+0xfd, 0x0f, 0x02, 0x00, 0x25, 0x1f, 0xff, 0x01, 0x00, 0x20, 0x0b, 0x6c, 0x00, 0x00, 0x6c, 0x7c,
+0xfc, 0x0e, 0x49, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x18, 0x49, 0xfa, 0x18, 0xfe, 0x00,
+0x51, 0x1c, 0x9c, 0x89, 0xa0, 0xf0, 0x77, 0x03, 0xa3, 0xdc, 0x1f, 0x5e, 0xf3, 0x92, 0xff, 0x10,
+0x00, 0x31, 0x04, 0x20, 0x04, 0x88, 0x5a, 0x00, 0x02, 0x00, 0xa0, 0x2b, 0x01, 0x00, 0x00, 0x19,
+0x00, 0x01, 0x00, 0x16, 0x29, 0xb6, 0x19, 0x00, 0x94, 0x0e, 0x20, 0xfc, 0xff, 0x02, 0x00, 0x00,
+0x1c, 0x00, 0x0a, 0x02, 0x00, 0x32, 0x64, 0x08, 0x58, 0xa9, 0x03, 0x10, 0x04, 0xb6, 0x00, 0x12,
+0x5a, 0x62, 0x18, 0x10, 0x00, 0x0c, 0x00, 0x17, 0x5c, 0x0c, 0x00, 0x20, 0xe8, 0x88, 0xd2, 0x18,
+0x20, 0x0c, 0x00, 0x3e, 0x19, 0xf0, 0x01, 0x1f, 0x10, 0xf4, 0x02, 0xc2, 0x15, 0x20, 0x00, 0xc1,
+0x15, 0x92, 0xe2, 0x11, 0x10, 0x80, 0x60, 0x04, 0x00, 0xe0, 0x1f, 0x10, 0x00, 0x03, 0x11, 0x10,
+0x26, 0x10, 0x04, 0x10, 0xdf, 0x15, 0xf0, 0x02, 0x9a, 0x08, 0x31, 0xdf, 0x15, 0xfc, 0x08, 0x00,
+0xf3, 0x32, 0xc0, 0x15, 0x03, 0x00, 0x89, 0x13, 0x89, 0x60, 0x66, 0x14, 0x04, 0x7e, 0xc5, 0x15,
+0x00, 0x20, 0x42, 0x11, 0xc3, 0x15, 0x00, 0x30, 0x12, 0x10, 0x12, 0x10, 0xc3, 0x7e, 0xd5, 0x15,
+0x28, 0x29, 0xd5, 0x15, 0x04, 0x20, 0xc0, 0x15, 0xac, 0x02, 0xc2, 0x15, 0x12, 0x00, 0x15, 0x14,
+0x82, 0x7e, 0x55, 0x25, 0x4d, 0x11, 0x55, 0x25, 0x17, 0x75, 0x06, 0x00, 0xc4, 0x45, 0xff, 0x03,
+0xdf, 0x15, 0x01, 0x74, 0x00, 0xf0, 0x61, 0x26, 0x29, 0xe6, 0x17, 0x96, 0xe2, 0x1f, 0x10, 0x96,
+0xe2, 0xc0, 0x15, 0x1e, 0x00, 0x15, 0x0a, 0x02, 0x7e, 0x5f, 0x11, 0x30, 0x20, 0x5f, 0x11, 0x40,
+0x20, 0x5f, 0x11, 0x50, 0x20, 0x5f, 0x11, 0x60, 0x20, 0x5f, 0x11, 0x68, 0x20, 0xc2, 0x15, 0x00,
+0x60, 0xc0, 0x15, 0x04, 0x00, 0xc3, 0x15, 0x6c, 0x02, 0xc1, 0x15, 0x08, 0x00, 0xd2, 0x14, 0x42,
+0x7e, 0xc2, 0x65, 0x30, 0x00, 0x07, 0x7e, 0x00, 0x0a, 0x30, 0x90, 0x00, 0x64, 0x80, 0x0a, 0x17,
+0x20, 0x00, 0x01, 0xfa, 0x87, 0x9f, 0x15, 0x96, 0xe2, 0xd5, 0x15, 0x18, 0x20, 0x5f, 0x0a, 0x0c,
+0x29, 0x00, 0x0a, 0xc1, 0x17, 0x90, 0xe2, 0x17, 0x76, 0x06, 0x00, 0xdf, 0x15, 0x81, 0x00, 0x00,
+0x02, 0x5f, 0x60, 0x00, 0x02, 0x1f, 0x10, 0x0c, 0x15, 0xf7, 0x18, 0x00, 0x60, 0xc3, 0x15, 0x88,
+0x01, 0x03, 0x61, 0xc2, 0x15, 0x02, 0x00, 0xcd, 0x15, 0x80, 0x00, 0x55, 0x60, 0x15, 0x10, 0x85,
+0x7e, 0xc2, 0x15, 0x2c, 0x01, 0xd5, 0x10, 0x15, 0x0a, 0xc3, 0x65, 0x1a, 0x00, 0x85, 0x7e, 0xc2,
+0x97, 0x0b, 0x1c, 0x00, 0xf1, 0x58, 0xc5, 0x15, 0x0e, 0x29, 0x5f, 0x11, 0xec, 0x20, 0xd5, 0x15,
+0x0e, 0x29, 0x95, 0x0a, 0x95, 0x0a, 0xd5, 0x15, 0x34, 0x00, 0xd5, 0x15, 0x04, 0x02, 0xd5, 0x17,
+0x90, 0xe2, 0xc3, 0x15, 0x1c, 0x66, 0xcb, 0x15, 0x8e, 0x00, 0x53, 0x60, 0xc0, 0x55, 0x00, 0x01,
+0x0b, 0x10, 0xcd, 0x15, 0x87, 0x01, 0x15, 0x61, 0xc1, 0x15, 0x9c, 0xe2, 0x09, 0x0a, 0xe1, 0x17,
+0x8a, 0xe2, 0xe1, 0x17, 0x88, 0xe2, 0xc0, 0x15, 0x04, 0xc0, 0xc3, 0x17, 0x26, 0x29, 0xd7, 0x74,
+0x06, 0x00, 0xc3, 0x45, 0xff, 0x03, 0xc3, 0x65, 0x00, 0x00, 0xd0, 0x10, 0x10, 0x0a, 0xc3, 0x15,
+0x00, 0x00, 0x03, 0x61, 0xd0, 0x10, 0x08, 0x0a, 0xdf, 0x15, 0x58, 0xff, 0x72, 0x60, 0x01, 0x11,
+0xe4, 0x60, 0x01, 0x40, 0xdf, 0x15, 0x00, 0x40, 0xba, 0x0b, 0x21, 0x80, 0x11, 0x4a, 0x00, 0x21,
+0x14, 0x21, 0x02, 0x00, 0xf2, 0x3b, 0xdf, 0x0b, 0xa0, 0x15, 0x3a, 0x03, 0xdf, 0x8b, 0xa1, 0x15,
+0x0e, 0x81, 0x03, 0x02, 0xdf, 0x09, 0x0a, 0x08, 0x0c, 0x01, 0xdf, 0x09, 0x92, 0x05, 0x1f, 0x0a,
+0x98, 0x15, 0xdf, 0x15, 0x4a, 0x00, 0x9a, 0x15, 0xdf, 0x09, 0x56, 0x06, 0x02, 0x01, 0xdf, 0x09,
+0x54, 0x09, 0xc3, 0x17, 0x04, 0x20, 0xc1, 0x1c, 0x0a, 0x00, 0x04, 0x0a, 0x57, 0x70, 0x68, 0x00,
+0xc1, 0x65, 0x20, 0x66, 0xc2, 0x1c, 0x0e, 0x00, 0x85, 0x10, 0x0b, 0x03, 0xd1, 0x0b, 0x40, 0x14,
+0x64, 0x07, 0xf1, 0x1e, 0x80, 0x8c, 0x80, 0x8c, 0x02, 0x60, 0xc2, 0x8b, 0x10, 0x81, 0xf5, 0x02,
+0xc9, 0x17, 0x1c, 0x66, 0x85, 0x0c, 0x51, 0x61, 0xc9, 0x45, 0xff, 0x83, 0xc9, 0x55, 0x00, 0x01,
+0xc9, 0x97, 0x1e, 0x66, 0x44, 0x0a, 0x03, 0x03, 0xc1, 0x1c, 0x0c, 0x00, 0xde, 0x01, 0xdf, 0x15,
+0x00, 0xbe, 0x0d, 0xf0, 0x03, 0xc3, 0x15, 0x9c, 0xe2, 0x0b, 0x0a, 0xe3, 0x17, 0x8a, 0xe2, 0xe3,
+0x17, 0x88, 0xe2, 0xc1, 0x17, 0x58, 0xcf, 0x5c, 0x0a, 0x20, 0xd0, 0x02, 0x5c, 0x0a, 0x04, 0xa0,
+0x07, 0x02, 0xa2, 0x07, 0xf0, 0x06, 0x13, 0x1c, 0xd0, 0x02, 0x0b, 0x1c, 0xd2, 0x02, 0x40, 0x14,
+0x17, 0x20, 0x2a, 0x00, 0x03, 0x87, 0xe1, 0x15, 0xff, 0xff, 0xdc, 0x00, 0x08, 0x70, 0x15, 0x15,
+0x0a, 0xd5, 0x15, 0x4a, 0x00, 0x06, 0x00, 0xf0, 0x0d, 0x19, 0x00, 0x0d, 0x0a, 0xf8, 0x09, 0xa0,
+0x0a, 0x8c, 0x01, 0xc3, 0x17, 0x02, 0x20, 0xc0, 0x9c, 0x1b, 0x00, 0x05, 0x10, 0xc0, 0x00, 0x40,
+0xd1, 0xe6, 0x10, 0xc3, 0x65, 0xe8, 0x0a, 0xff, 0x49, 0x9e, 0x15, 0xc2, 0x12, 0x42, 0x23, 0x01,
+0x86, 0x42, 0x13, 0xc1, 0x18, 0x41, 0x29, 0x01, 0x87, 0x41, 0x13, 0xc4, 0x18, 0x84, 0x0c, 0x84,
+0x0c, 0x44, 0x29, 0x01, 0x86, 0x44, 0x13, 0xc3, 0x18, 0x83, 0x0c, 0x83, 0x0c, 0x43, 0x29, 0x01,
+0x87, 0x43, 0x13, 0x81, 0x20, 0x04, 0x87, 0x03, 0x21, 0x02, 0x87, 0xdf, 0x09, 0xf0, 0x05, 0x83,
+0x15, 0xc3, 0x1c, 0x02, 0x00, 0xc3, 0x27, 0x02, 0x20, 0xd6, 0x02, 0xdf, 0x09, 0xba, 0x07, 0x87,
+0x00, 0xc4, 0xe0, 0xc5, 0x15, 0x1a, 0x00, 0xc5, 0x70, 0x43, 0x60, 0xc3, 0x65, 0x6e, 0x21, 0x81,
+0xe0, 0x00, 0x06, 0x0d, 0x1f, 0x0a, 0x00, 0x06, 0xff, 0xcd, 0x15, 0x81, 0x52, 0x05, 0x0f, 0x02,
+0x00, 0x1b, 0x0f, 0xff, 0x05, 0x20, 0x02, 0x86, 0x05, 0x06, 0x02, 0x00, 0x0f, 0x00, 0x06, 0x42,
+0x02, 0xaa, 0x09, 0x06, 0xd2, 0x60, 0x0f, 0x00, 0x06, 0x01, 0x11, 0xc0, 0xe8, 0x1f, 0xff, 0x03,
+0xff, 0xff, 0x10, 0x60, 0xde, 0x05, 0xee, 0x05, 0xde, 0x04, 0x60, 0x02, 0x40, 0x02, 0x20, 0x02,
+0x00, 0x02, 0x00, 0x06, 0xff, 0xff, 0xe3, 0x71, 0x41, 0x61, 0x1f, 0x8a, 0x4c, 0x06, 0xc3, 0x88,
+0x12, 0xf0, 0x03, 0x81, 0x0a, 0x1f, 0x8a, 0x2c, 0x06, 0x81, 0x0c, 0x5f, 0x90, 0x30, 0x06, 0x05,
+0x01, 0xc1, 0x65, 0x04, 0x00, 0x0c, 0x00, 0xff, 0x03, 0x2c, 0x06, 0x5f, 0x0b, 0x4c, 0x06, 0xc1,
+0x10, 0x43, 0x61, 0x00, 0x01, 0x11, 0x90, 0x09, 0x01, 0x11, 0x10, 0x02, 0x00, 0x05, 0xf0, 0x7b,
+0x01, 0x01, 0x11, 0x90, 0xc4, 0x0a, 0xea, 0x80, 0x87, 0x00, 0x9f, 0x11, 0xb6, 0x07, 0xc1, 0x17,
+0x98, 0x15, 0x5f, 0x10, 0xc6, 0x06, 0x43, 0x10, 0x57, 0x70, 0x1a, 0x00, 0xc1, 0x65, 0x6e, 0x21,
+0xd7, 0x70, 0xa0, 0x01, 0xc3, 0x65, 0x20, 0x66, 0xdf, 0x10, 0x84, 0x06, 0x45, 0x10, 0x40, 0x94,
+0x40, 0x0a, 0x5f, 0x10, 0xa6, 0x06, 0xc3, 0x15, 0x00, 0xe0, 0x40, 0xa4, 0xfe, 0x03, 0x04, 0x1c,
+0x6c, 0x20, 0x06, 0x15, 0x5f, 0x11, 0xb8, 0x06, 0xe1, 0x8b, 0x05, 0x81, 0x40, 0x11, 0x40, 0xe0,
+0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x00, 0x00, 0x53, 0xc5, 0xe5, 0xf3, 0x28, 0x85, 0x0a, 0x54, 0x75,
+0x05, 0xe5, 0x85, 0x0c, 0xc0, 0x35, 0x00, 0x02, 0x07, 0x02, 0x57, 0x0b, 0x79, 0x14, 0x1f, 0x0c,
+0xb8, 0x06, 0x02, 0x86, 0xc0, 0x45, 0x00, 0x01, 0xc2, 0x15, 0x4b, 0x00, 0x94, 0x74, 0x02, 0xe5,
+0xc2, 0x0c, 0xc2, 0x0c, 0x86, 0x60, 0x57, 0x10, 0x0c, 0x29, 0xf2, 0x20, 0xff, 0x19, 0xc1, 0x00,
+0x01, 0x0c, 0x02, 0x0c, 0x81, 0x0c, 0x02, 0x0c, 0xc0, 0x0c, 0xc1, 0x00, 0x81, 0x0c, 0x00, 0x0c,
+0xc1, 0x0c, 0xc1, 0x00, 0x00, 0x8a, 0x40, 0xd0, 0x01, 0x8a, 0x42, 0x50, 0x42, 0x61, 0x40, 0x0b,
+0x93, 0x10, 0x13, 0x10, 0x06, 0x65, 0x2c, 0x00, 0x13, 0x8f, 0xb3, 0x10, 0x64, 0x00, 0x33, 0x10,
+0x66, 0x00, 0x30, 0x00, 0x17, 0x5f, 0xcc, 0x00, 0x33, 0x10, 0xce, 0x30, 0x00, 0x18, 0x91, 0x34,
+0x01, 0x33, 0x10, 0x36, 0x01, 0xc1, 0x17, 0xd4, 0x1c, 0x01, 0xf0, 0x11, 0x02, 0x81, 0x5f, 0x00,
+0x86, 0x06, 0xdf, 0x65, 0xa0, 0x01, 0x84, 0x06, 0x9f, 0x0a, 0xc6, 0x06, 0xdf, 0x27, 0x9a, 0x15,
+0xc6, 0x06, 0x02, 0x87, 0x5f, 0x00, 0x7c, 0x06, 0xc6, 0x15, 0x02, 0x03, 0xc2, 0x1f, 0xf0, 0x13,
+0x4b, 0x00, 0xc0, 0x15, 0x6e, 0x21, 0x48, 0x8a, 0xfe, 0x80, 0xc0, 0x65, 0x1a, 0x00, 0x45, 0x7f,
+0x87, 0x00, 0xc0, 0x14, 0x1b, 0x10, 0xf0, 0x18, 0x02, 0x00, 0x23, 0x0a, 0x87, 0x00, 0x4b, 0x10,
+0x73, 0x1c, 0x58, 0x0f, 0x80, 0xf9, 0x10, 0x02, 0x00, 0xf1, 0x10, 0x02, 0x00, 0x32, 0x00, 0xe2,
+0x98, 0x15, 0xc0, 0x10, 0xc0, 0x65, 0x0a, 0x00, 0x0d, 0x14, 0x8d, 0x0c, 0x95, 0x0c, 0x06, 0x00,
+0x60, 0x15, 0x14, 0x15, 0x14, 0xd5, 0x11, 0xb4, 0x01, 0x22, 0x50, 0x09, 0xb4, 0x01, 0x2f, 0x60,
+0x08, 0xb4, 0x01, 0x01, 0x24, 0x38, 0x08, 0xb4, 0x01, 0x60, 0x54, 0x08, 0xc3, 0x15, 0x00, 0x00,
+0xb4, 0x01, 0xe2, 0xc1, 0x0a, 0x1f, 0xa0, 0xa2, 0x15, 0x03, 0x03, 0xc3, 0x65, 0x04, 0x00, 0x73,
+0x01, 0xc2, 0x01, 0x44, 0xc5, 0xe5, 0x00, 0x00, 0xae, 0x01, 0x37, 0xc2, 0x15, 0x00, 0x9a, 0x01,
+0xf0, 0x0f, 0x82, 0x15, 0x80, 0x15, 0xc0, 0x00, 0x00, 0x0c, 0x02, 0x0c, 0x80, 0x0c, 0x02, 0x0c,
+0x33, 0x90, 0x02, 0x00, 0xf3, 0xc5, 0x80, 0x00, 0x03, 0x00, 0x00, 0x8a, 0x80, 0x0c, 0x33, 0xd0,
+0x08, 0x00, 0xe0, 0xc0, 0x0c, 0x02, 0x50, 0x42, 0x61, 0x73, 0x0b, 0x02, 0x00, 0x93, 0x10, 0xd3,
+0x0b, 0x6c, 0x01, 0x0a, 0x32, 0x00, 0x11, 0x66, 0x32, 0x00, 0x13, 0x67, 0x32, 0x00, 0x00, 0x08,
+0x00, 0x04, 0x32, 0x00, 0x20, 0x66, 0x00, 0xa2, 0x01, 0x0e, 0x32, 0x00, 0x11, 0xce, 0x32, 0x00,
+0x13, 0xcf, 0x32, 0x00, 0x00, 0x08, 0x00, 0x04, 0x32, 0x00, 0x20, 0xce, 0x00, 0xa4, 0x01, 0x0e,
+0x32, 0x00, 0x20, 0x36, 0x01, 0x96, 0x00, 0x22, 0x37, 0x01, 0x96, 0x00, 0x00, 0x08, 0x00, 0x04,
+0x32, 0x00, 0x20, 0x36, 0x01, 0xa6, 0x01, 0x00, 0x06, 0x01, 0x20, 0x81, 0x80, 0x9a, 0x01, 0x60,
+0x38, 0x08, 0x9f, 0x0a, 0x60, 0x08, 0x9a, 0x01, 0x20, 0x60, 0x08, 0x9a, 0x01, 0x60, 0x30, 0x08,
+0xc6, 0x15, 0x00, 0x00, 0x4a, 0x01, 0x22, 0x9c, 0x0a, 0x4a, 0x01, 0x2f, 0xaa, 0x09, 0x4a, 0x01,
+0x01, 0x20, 0x82, 0x09, 0x44, 0x00, 0x00, 0xfe, 0x02, 0x26, 0x9e, 0x09, 0x4a, 0x01, 0x02, 0x3e,
+0x01, 0x42, 0x97, 0x21, 0x50, 0x2d, 0x50, 0x01, 0x2f, 0x71, 0x01, 0x4a, 0x01, 0x6b, 0x2c, 0xa0,
+0x00, 0x7e, 0x01, 0x0f, 0x4c, 0x01, 0x43, 0x11, 0x80, 0x4c, 0x01, 0x60, 0x82, 0x09, 0x9f, 0x0a,
+0xaa, 0x09, 0x4c, 0x01, 0x20, 0xaa, 0x09, 0x4c, 0x01, 0x22, 0x7a, 0x09, 0x4c, 0x01, 0xf0, 0x21,
+0x2e, 0x0b, 0xe8, 0x0b, 0x5e, 0x0c, 0xce, 0x0c, 0xea, 0x0c, 0xfc, 0x0c, 0x02, 0x0d, 0x78, 0x0d,
+0x08, 0x0e, 0x28, 0x0e, 0x48, 0x0e, 0x76, 0x0e, 0xd8, 0x0e, 0xf8, 0x0e, 0x32, 0x0f, 0x5c, 0x0f,
+0x90, 0x0f, 0xb8, 0x0f, 0xea, 0x0f, 0xca, 0x0a, 0xa4, 0x15, 0x57, 0x12, 0x00, 0x00, 0x57, 0x1c,
+0x3d, 0x12, 0xfc, 0x01, 0x40, 0x1c, 0x02, 0x00, 0x54, 0x03, 0xdf, 0x09, 0x86, 0x0b, 0xc1, 0x17,
+0xcc, 0x0a, 0x66, 0x10, 0x98, 0x0b, 0x51, 0x81, 0x15, 0x02, 0x0a, 0xc1, 0xda, 0x16, 0xf0, 0x0f,
+0xc2, 0x15, 0x10, 0x00, 0xc1, 0x45, 0x03, 0xf0, 0x02, 0x6c, 0xd0, 0x02, 0xc2, 0x57, 0xd2, 0x0a,
+0x40, 0x1d, 0xfc, 0xff, 0x43, 0x1d, 0xfe, 0xff, 0x55, 0x10, 0x95, 0x10, 0xc1, 0x60, 0x24, 0x00,
+0xd1, 0x04, 0x03, 0xc1, 0x45, 0x00, 0x10, 0xc2, 0x65, 0x10, 0x00, 0x0b, 0x7e, 0x87, 0x5a, 0x00,
+0xf0, 0x05, 0x27, 0x03, 0x45, 0x12, 0x1b, 0x03, 0xc5, 0x35, 0x81, 0xff, 0x22, 0x02, 0x45, 0x1d,
+0xec, 0x20, 0x1f, 0x03, 0x40, 0x2d, 0x8e, 0x14, 0xf0, 0x07, 0x40, 0x1d, 0x04, 0x00, 0xc5, 0x65,
+0x08, 0x00, 0x5f, 0x11, 0x92, 0x09, 0xc1, 0x65, 0x06, 0x00, 0x4d, 0x14, 0xd5, 0x45, 0x03, 0xf0,
+0x06, 0x00, 0xa0, 0x08, 0x00, 0x07, 0x7e, 0x5f, 0x0a, 0xa0, 0x15, 0x87, 0x00, 0x94, 0x00, 0x00,
+0x12, 0x00, 0x06, 0x18, 0x00, 0xf1, 0x40, 0x87, 0x00, 0x61, 0x0a, 0x87, 0x00, 0xc3, 0x15, 0xec,
+0x20, 0xc2, 0x15, 0x40, 0x00, 0xd3, 0x0b, 0x04, 0x03, 0x83, 0x7e, 0x61, 0x0a, 0xd6, 0x0b, 0x87,
+0x00, 0xc4, 0x15, 0x2a, 0x20, 0x01, 0x01, 0x44, 0x11, 0x05, 0x13, 0x05, 0x03, 0x35, 0x20, 0x02,
+0x00, 0xfa, 0x82, 0x4c, 0x13, 0x12, 0x01, 0x17, 0x74, 0x02, 0x00, 0xc0, 0x65, 0x08, 0x00, 0xc5,
+0x17, 0x00, 0x20, 0x1f, 0x60, 0x00, 0x20, 0xd7, 0x27, 0x00, 0x20, 0x00, 0x60, 0x03, 0x83, 0x5f,
+0x11, 0x00, 0x20, 0xe3, 0x01, 0x75, 0xf2, 0x03, 0xf0, 0x19, 0x63, 0x11, 0xc3, 0xe5, 0xec, 0x20,
+0xd1, 0x10, 0xc5, 0x65, 0x04, 0x00, 0x40, 0x14, 0x15, 0x10, 0x55, 0x14, 0x87, 0x00, 0x40, 0x12,
+0xcb, 0x03, 0xc0, 0x35, 0x81, 0xff, 0xc8, 0x02, 0x05, 0x1c, 0xec, 0x20, 0xc5, 0x03, 0x30, 0x0a,
+0xec, 0x20, 0x62, 0x00, 0x40, 0x05, 0x01, 0x73, 0x2d, 0x34, 0x00, 0xc0, 0x03, 0x83, 0xc4, 0x10,
+0x03, 0x13, 0xf9, 0x02, 0x4c, 0x11, 0xcd, 0x10, 0x82, 0x0c, 0xf0, 0x15, 0x02, 0x10, 0xb3, 0x20,
+0x04, 0x00, 0x0d, 0x02, 0xc4, 0x12, 0xdf, 0x09, 0xce, 0x07, 0xcb, 0x17, 0x28, 0x20, 0xdf, 0x10,
+0x28, 0x20, 0xc5, 0x9c, 0x1b, 0x00, 0x35, 0x0a, 0x6c, 0x20, 0x03, 0x11, 0x01, 0x01, 0xc3, 0x12,
+0x58, 0x0c, 0x40, 0xec, 0x02, 0x9f, 0x11, 0xda, 0x00, 0x31, 0x40, 0x12, 0x06, 0x60, 0x00, 0x82,
+0x03, 0x02, 0x03, 0x1c, 0x6c, 0x20, 0x02, 0x02, 0xc4, 0x00, 0xf1, 0x00, 0x43, 0x12, 0x04, 0x03,
+0xdf, 0x09, 0x48, 0x0c, 0x5f, 0x00, 0x68, 0x13, 0xc0, 0x15, 0x6c, 0xe4, 0x00, 0x20, 0xd0, 0x0b,
+0xae, 0x26, 0xf0, 0x18, 0xef, 0x01, 0xc3, 0x17, 0x28, 0x20, 0x06, 0x02, 0xc3, 0x17, 0x00, 0x20,
+0xdf, 0x65, 0x24, 0x00, 0x00, 0x20, 0x02, 0x01, 0xdf, 0x12, 0x28, 0x20, 0xc5, 0x10, 0xe0, 0x10,
+0xc8, 0x65, 0x14, 0x00, 0xc0, 0xe5, 0x6c, 0x20, 0x09, 0x10, 0xc0, 0x34, 0x0f, 0xf0, 0x0a, 0x0a,
+0x02, 0x7e, 0x73, 0x92, 0x1b, 0x00, 0xe6, 0x10, 0xdf, 0x09, 0x68, 0x13, 0x83, 0x15, 0x04, 0x87,
+0xc1, 0x17, 0x04, 0x20, 0x5f, 0x00, 0xda, 0x07, 0x26, 0x0d, 0x44, 0x30, 0x0a, 0x6c, 0x20, 0x9e,
+0x00, 0x00, 0x60, 0x01, 0x51, 0x48, 0x0c, 0xc3, 0xe5, 0x14, 0x16, 0x00, 0x08, 0xb8, 0x00, 0x40,
+0x5f, 0x00, 0xec, 0x07, 0x1c, 0x00, 0xc0, 0xc1, 0x65, 0x12, 0x00, 0xc0, 0x15, 0x08, 0x00, 0xe1,
+0x18, 0x02, 0x7e, 0x10, 0x05, 0x80, 0x04, 0x20, 0x02, 0x01, 0xc5, 0x15, 0x02, 0x20, 0x1c, 0x00,
+0x00, 0x38, 0x00, 0x00, 0x34, 0x00, 0x20, 0x41, 0x13, 0xd2, 0x00, 0x00, 0x60, 0x00, 0x20, 0x08,
+0x00, 0x02, 0x00, 0x02, 0x92, 0x29, 0x00, 0x52, 0x14, 0xf0, 0x01, 0x07, 0x02, 0x07, 0x12, 0x07,
+0x22, 0x03, 0x32, 0x03, 0x0a, 0x03, 0x1a, 0x03, 0x2a, 0x01, 0x3a, 0x78, 0x10, 0xf0, 0x24, 0x20,
+0x00, 0x30, 0x00, 0x00, 0x02, 0x10, 0x02, 0x20, 0x02, 0x30, 0x02, 0x40, 0x00, 0x50, 0x00, 0x60,
+0x00, 0x70, 0x00, 0x40, 0x02, 0x50, 0x02, 0x60, 0x02, 0x70, 0x02, 0x80, 0x00, 0x90, 0x00, 0xa0,
+0x00, 0xb0, 0x00, 0x80, 0x02, 0x90, 0x02, 0xa0, 0x02, 0xb0, 0x02, 0xc0, 0x00, 0xd0, 0x00, 0xe0,
+0x00, 0xf0, 0x8a, 0x10, 0xf0, 0x41, 0x06, 0x05, 0x10, 0x40, 0x92, 0xc0, 0x45, 0xf8, 0xff, 0xc0,
+0x0c, 0x03, 0x9c, 0x2c, 0x0d, 0x04, 0x9c, 0x2d, 0x0d, 0xc4, 0x65, 0x30, 0x20, 0xd4, 0x0b, 0x02,
+0x03, 0xc3, 0x7e, 0x87, 0x00, 0xa4, 0x10, 0x03, 0x0b, 0x03, 0x6c, 0x1c, 0x0d, 0xd7, 0x74, 0x0e,
+0x00, 0x02, 0x86, 0xc3, 0x55, 0x04, 0x00, 0xd1, 0xd0, 0xc3, 0x00, 0xd1, 0x90, 0xc4, 0xe5, 0x30,
+0x20, 0xdf, 0x15, 0x54, 0x14, 0xe8, 0x0d, 0xdf, 0x15, 0x14, 0x0a, 0xfe, 0x0d, 0x04, 0x1d, 0x3c,
+0x0d, 0xc4, 0x65, 0x00, 0x60, 0xc0, 0x7c, 0x1a, 0xf0, 0x1e, 0x35, 0x00, 0x04, 0x02, 0x03, 0xc0,
+0x15, 0x80, 0x00, 0xe6, 0x17, 0x96, 0xe2, 0x26, 0x10, 0x26, 0x11, 0xdf, 0x17, 0xe8, 0x0d, 0xf8,
+0x0d, 0xdf, 0x17, 0x26, 0x29, 0x96, 0xe2, 0x54, 0x14, 0x02, 0x7e, 0x84, 0x15, 0xc4, 0x65, 0x00,
+0x01, 0x80, 0x15, 0x85, 0x0c, 0x03, 0x86, 0x10, 0x00, 0x80, 0x02, 0x01, 0x14, 0x0a, 0x02, 0x7e,
+0x9f, 0x15, 0x36, 0x16, 0xf0, 0x15, 0x43, 0x94, 0xc3, 0x45, 0xf8, 0xff, 0xc3, 0x0c, 0xc3, 0x9c,
+0x2d, 0x0d, 0xe3, 0x0b, 0x40, 0x92, 0x17, 0x74, 0xfb, 0xff, 0xc0, 0x45, 0xf9, 0xff, 0x03, 0x60,
+0x33, 0x0a, 0x30, 0x20, 0x87, 0x00, 0x05, 0x10, 0x44, 0x94, 0x62, 0x27, 0xff, 0x17, 0xc4, 0x0c,
+0xc4, 0x00, 0x44, 0xd4, 0x17, 0x75, 0xfb, 0xff, 0xc4, 0x35, 0x40, 0x00, 0xb9, 0x03, 0xc2, 0x15,
+0x48, 0x00, 0x84, 0x78, 0xb5, 0x01, 0x05, 0x10, 0xdf, 0x15, 0x11, 0x15, 0xe8, 0x0d, 0xdf, 0x15,
+0xa0, 0x00, 0xfe, 0x0d, 0x2c, 0x00, 0x01, 0x13, 0xa9, 0x2c, 0x00, 0xf0, 0x0b, 0x5f, 0x00, 0xbe,
+0x0d, 0xdf, 0x09, 0xd8, 0x0e, 0x43, 0x14, 0xd7, 0x20, 0xa0, 0x01, 0x02, 0x87, 0xc3, 0x17, 0x22,
+0x29, 0xc0, 0x10, 0xd7, 0x74, 0xfd, 0xff, 0x10, 0x01, 0xf2, 0x11, 0xc3, 0x65, 0x04, 0x02, 0xdf,
+0x10, 0x1c, 0x29, 0xc2, 0x15, 0x08, 0x00, 0x80, 0x74, 0x93, 0x90, 0xc2, 0x00, 0x93, 0x90, 0xc3,
+0x65, 0x32, 0x00, 0xc2, 0x15, 0x77, 0x00, 0x80, 0x74, 0x42, 0x0a, 0x12, 0x00, 0xf1, 0x02, 0x45,
+0x14, 0x57, 0x21, 0x2b, 0x01, 0x02, 0x87, 0xc5, 0x17, 0x24, 0x29, 0xc5, 0x0c, 0xc5, 0x0c, 0xc5,
+0x04, 0x01, 0xa0, 0x1e, 0x29, 0x50, 0x11, 0x48, 0x13, 0xcd, 0x17, 0x1a, 0x29, 0x84, 0x25, 0xf0,
+0x05, 0x1c, 0x29, 0x0c, 0x03, 0x10, 0x8a, 0x10, 0x8a, 0xc0, 0x65, 0x32, 0x00, 0xd0, 0x95, 0xff,
+0xff, 0xc8, 0x95, 0xff, 0xff, 0x24, 0x00, 0xf1, 0x04, 0x03, 0x14, 0x0b, 0x12, 0x87, 0x00, 0xc2,
+0x17, 0x2e, 0x20, 0x03, 0x03, 0x9f, 0x10, 0x2e, 0x20, 0x0b, 0x01, 0xc2, 0x84, 0x02, 0x24, 0x04,
+0x00, 0x4e, 0x03, 0xf0, 0x0b, 0x02, 0x87, 0x21, 0x0b, 0x0b, 0x01, 0xc3, 0x15, 0x2c, 0x20, 0xc0,
+0x12, 0x03, 0x22, 0x02, 0x03, 0x00, 0x12, 0xfc, 0x01, 0xca, 0x10, 0x88, 0x10, 0x72, 0x12, 0x46,
+0x07, 0x20, 0x40, 0x12, 0x1a, 0x00, 0xf0, 0x0f, 0xc2, 0x12, 0x97, 0x20, 0x2c, 0x20, 0x06, 0x03,
+0x32, 0x20, 0x02, 0x00, 0x05, 0x03, 0x83, 0x10, 0x82, 0x12, 0xf7, 0x01, 0x21, 0x0b, 0x05, 0x01,
+0x8b, 0x12, 0xca, 0x17, 0x2e, 0x20, 0x58, 0x00, 0x60, 0x87, 0x00, 0x42, 0x10, 0xd2, 0x0b, 0x2c,
+0x00, 0xf0, 0x19, 0xc4, 0x12, 0x17, 0x21, 0x2c, 0x20, 0x0d, 0x03, 0x1f, 0x1d, 0x02, 0x00, 0x9c,
+0xe2, 0x80, 0x10, 0xc5, 0x15, 0x06, 0xc2, 0xcd, 0x8b, 0x07, 0x03, 0x15, 0xa4, 0xfc, 0x03, 0x03,
+0x11, 0x04, 0x13, 0xf0, 0x01, 0x21, 0x0b, 0x02, 0x01, 0x09, 0x1d, 0x5e, 0x00, 0xf0, 0x0b, 0x42,
+0x10, 0x40, 0x14, 0x06, 0x03, 0x00, 0x12, 0x17, 0x20, 0x2c, 0x20, 0x04, 0x02, 0x0a, 0x0a, 0x0a,
+0x01, 0xc0, 0x17, 0x2c, 0x20, 0x0a, 0x10, 0x1f, 0x1c, 0x3c, 0x00, 0x42, 0xc2, 0x15, 0x06, 0xc2,
+0xaa, 0x2b, 0x20, 0x40, 0x12, 0xce, 0x03, 0x11, 0x11, 0x6e, 0x03, 0xa8, 0x0e, 0x03, 0xc3, 0x1c,
+0xec, 0xff, 0xc3, 0x65, 0x14, 0x00, 0xe0, 0x02, 0x62, 0xc0, 0x9c, 0x17, 0x00, 0x21, 0x10, 0x60,
+0x04, 0x00, 0x64, 0x04, 0x00, 0x48, 0x00, 0x22, 0xfb, 0x03, 0x48, 0x00, 0xf0, 0x03, 0x43, 0x12,
+0xf6, 0x03, 0xc3, 0x35, 0x81, 0xff, 0xf3, 0x02, 0xc3, 0x1c, 0xec, 0x20, 0xf0, 0x03, 0xd1, 0x0b,
+0xc2, 0x07, 0x32, 0xd7, 0x14, 0x00, 0x04, 0x00, 0xf0, 0x06, 0x10, 0x00, 0x00, 0xc0, 0x9c, 0x02,
+0x00, 0xc0, 0x45, 0xfc, 0xff, 0xc0, 0x25, 0x02, 0x00, 0x01, 0x02, 0x80, 0x0a, 0x05, 0x10, 0x8e,
+0x09, 0x20, 0x17, 0x10, 0xdc, 0x07, 0x41, 0x57, 0x11, 0x00, 0x00, 0x6e, 0x05, 0x16, 0x14, 0x08,
+0x00, 0x2c, 0x41, 0x12, 0x66, 0x05, 0x13, 0x01, 0xa0, 0x18, 0xf4, 0x11, 0x1f, 0x1c, 0xd0, 0x02,
+0x98, 0xe2, 0x1f, 0x1c, 0xd2, 0x02, 0x9a, 0xe2, 0xc2, 0x15, 0x76, 0x12, 0xc5, 0x15, 0x0a, 0x00,
+0xdf, 0x09, 0xf4, 0x11, 0x17, 0x0a, 0x00, 0x00, 0xe6, 0x15, 0x7e, 0x10, 0x14, 0x00, 0x10, 0xc0,
+0x08, 0x0a, 0xf0, 0x4f, 0xd4, 0xc0, 0x0c, 0xc0, 0x35, 0xc0, 0x01, 0x02, 0x02, 0x78, 0x00, 0xd4,
+0x50, 0x00, 0x12, 0xc0, 0x65, 0x00, 0xc0, 0xdf, 0x67, 0x36, 0x10, 0x46, 0x10, 0xdf, 0x27, 0x12,
+0x10, 0x46, 0x10, 0xed, 0x87, 0xc4, 0x17, 0x7c, 0x10, 0xc3, 0x17, 0x30, 0x10, 0x7b, 0x00, 0xc4,
+0x10, 0x40, 0x10, 0x41, 0x61, 0xf0, 0x01, 0xa0, 0x00, 0xd4, 0x11, 0xe4, 0x11, 0x14, 0x11, 0x1a,
+0x11, 0x76, 0x12, 0x76, 0x12, 0x80, 0x11, 0x86, 0x11, 0x76, 0x12, 0x7a, 0x12, 0xac, 0x12, 0xcc,
+0x12, 0xda, 0x12, 0xe4, 0x12, 0xec, 0x12, 0xf4, 0x12, 0x50, 0x13, 0x56, 0x13, 0x90, 0x12, 0xb8,
+0x12, 0xbc, 0x0f, 0x02, 0x0f, 0x02, 0x00, 0x10, 0x60, 0x1f, 0x0a, 0x82, 0x11, 0x03, 0x01, 0x9a,
+0x13, 0xff, 0x0f, 0x82, 0x11, 0x66, 0x10, 0x04, 0x94, 0xc1, 0x17, 0x7c, 0x10, 0x44, 0x78, 0x9f,
+0x18, 0x96, 0xe2, 0xdf, 0x57, 0x82, 0x11, 0x96, 0xe2, 0x83, 0x18, 0x04, 0x0c, 0x01, 0x0c, 0x81,
+0x0c, 0x06, 0x00, 0x17, 0xf0, 0x0b, 0xc4, 0x15, 0x00, 0x00, 0x44, 0x40, 0xc1, 0x45, 0x00, 0x00,
+0x01, 0x51, 0x53, 0x90, 0xc1, 0x00, 0x53, 0x90, 0xca, 0x10, 0x6d, 0x7f, 0x81, 0x15, 0x87, 0x00,
+0x06, 0x01, 0x00, 0x6c, 0x00, 0x1f, 0x02, 0x6c, 0x00, 0x06, 0xf4, 0x05, 0xdf, 0x15, 0x04, 0x00,
+0xc8, 0x11, 0xc1, 0x15, 0x00, 0x00, 0x04, 0x0c, 0x04, 0x86, 0xc1, 0x45, 0x0f, 0x00, 0xc1, 0x55,
+0x0c, 0x00, 0x11, 0xf0, 0x0c, 0x00, 0x31, 0x53, 0x90, 0xd7, 0x90, 0x2f, 0x31, 0xca, 0x10, 0x61,
+0x54, 0x00, 0x40, 0x03, 0x94, 0x03, 0x79, 0xae, 0x00, 0x67, 0xea, 0x90, 0x8a, 0x0a, 0x47, 0x7f,
+0x10, 0x00, 0x12, 0xd0, 0x10, 0x00, 0xf1, 0x03, 0xc3, 0x17, 0x3e, 0x10, 0x43, 0x61, 0xc3, 0x27,
+0x0e, 0x10, 0x02, 0x86, 0xc3, 0x17, 0x0e, 0x10, 0x43, 0xe1, 0x42, 0x2b, 0xff, 0x0a, 0x67, 0x16,
+0x10, 0xc0, 0x17, 0x46, 0x10, 0xc4, 0x14, 0xc4, 0x55, 0x00, 0x60, 0x04, 0x60, 0xe2, 0x14, 0xca,
+0x45, 0x03, 0x00, 0x22, 0x11, 0x49, 0x7f, 0x54, 0x1a, 0x3f, 0x00, 0xe0, 0x06, 0xf1, 0x00, 0x40,
+0x94, 0xc2, 0x15, 0x2c, 0x20, 0x82, 0x12, 0x05, 0x03, 0xc0, 0x0a, 0xfc, 0x04, 0x9f, 0xe0, 0x02,
+0x00, 0x88, 0x04, 0x80, 0x0e, 0x03, 0xdf, 0x70, 0x36, 0x10, 0xdf, 0x60, 0xf4, 0x01, 0xc0, 0x46,
+0x10, 0x42, 0x10, 0x06, 0x87, 0xe2, 0x0b, 0xe2, 0x60, 0x43, 0x7f, 0x1c, 0x00, 0xf0, 0x2c, 0xf4,
+0x02, 0xdf, 0x17, 0x42, 0x10, 0x46, 0x10, 0x0f, 0x01, 0x43, 0x94, 0xc5, 0x70, 0x09, 0x03, 0xdf,
+0x60, 0x3e, 0x10, 0xdf, 0x27, 0x3e, 0x10, 0x3a, 0x10, 0x03, 0x87, 0x05, 0x01, 0x43, 0x94, 0xf7,
+0x02, 0xdf, 0x17, 0x3a, 0x10, 0x3e, 0x10, 0x5f, 0x00, 0xf4, 0x11, 0x5f, 0x92, 0x7c, 0x10, 0x5f,
+0x94, 0x7d, 0x10, 0x87, 0x00, 0xdf, 0x55, 0x02, 0x00, 0x30, 0x08, 0x00, 0x12, 0x45, 0x08, 0x00,
+0xf0, 0x1b, 0x00, 0x0a, 0x40, 0xd4, 0xdf, 0x35, 0x04, 0x00, 0x36, 0x10, 0x10, 0x03, 0x05, 0x10,
+0x04, 0x10, 0x17, 0x74, 0x04, 0x00, 0xc5, 0x45, 0xf0, 0xff, 0x40, 0x51, 0x1f, 0x10, 0xaa, 0x11,
+0xc0, 0x00, 0x1f, 0x10, 0xb6, 0x11, 0x44, 0x41, 0x1f, 0x11, 0xc2, 0x11, 0x9a, 0x07, 0xd0, 0x55,
+0x55, 0xc4, 0x10, 0xc5, 0x10, 0x43, 0x0a, 0x80, 0x0c, 0x01, 0x87, 0x05, 0x06, 0x00, 0xe1, 0x86,
+0xc5, 0x50, 0x5f, 0x11, 0x68, 0x11, 0x17, 0x74, 0xfd, 0xff, 0x01, 0x87, 0x04, 0x12, 0x00, 0xd0,
+0xc4, 0x50, 0x44, 0x0a, 0x1f, 0x11, 0x6e, 0x11, 0x87, 0x00, 0x1f, 0x0a, 0x7c, 0x6a, 0x00, 0x30,
+0x15, 0xff, 0xff, 0x08, 0x00, 0xf0, 0x13, 0xc1, 0x15, 0x8e, 0x83, 0x61, 0x0a, 0xb1, 0x00, 0x87,
+0x00, 0x5f, 0x10, 0x60, 0x13, 0xc3, 0x15, 0x82, 0x15, 0x40, 0x14, 0x0b, 0x1c, 0x6c, 0x20, 0xd3,
+0xe5, 0x14, 0x00, 0x40, 0x14, 0xf0, 0x03, 0x13, 0x10, 0xc6, 0x03, 0xf4, 0x15, 0xec, 0x02, 0x00,
+0x1c, 0xec, 0x20, 0xe9, 0x03, 0xc0, 0x65, 0x04, 0x00, 0x45, 0x14, 0x01, 0x80, 0x05, 0x0a, 0x04,
+0x14, 0xe2, 0x03, 0x44, 0x21, 0x02, 0x87, 0x05, 0x11, 0xc5, 0x0a, 0x53, 0x11, 0x1f, 0x11, 0x96,
+0x15, 0x18, 0x00, 0x95, 0x1f, 0x10, 0x92, 0x09, 0xc4, 0x45, 0x03, 0x00, 0xd2, 0x20, 0x00, 0x40,
+0xc5, 0x45, 0x01, 0x00, 0x24, 0x00, 0x62, 0x94, 0x15, 0xc4, 0x15, 0x2b, 0x01, 0x28, 0x00, 0xf3,
+0x18, 0x05, 0x21, 0x01, 0x86, 0x05, 0x11, 0xc5, 0x45, 0x03, 0x00, 0x53, 0x11, 0x42, 0x14, 0x01,
+0x80, 0x42, 0x11, 0x02, 0x21, 0x01, 0x86, 0x02, 0x11, 0x85, 0x20, 0x01, 0x86, 0x42, 0x11, 0xc2,
+0x55, 0x03, 0x00, 0x93, 0x10, 0xc4, 0x15, 0x19, 0x6e, 0x00, 0x02, 0x2e, 0x00, 0x02, 0x2a, 0x00,
+0x28, 0x02, 0x0a, 0x2a, 0x00, 0xd0, 0x93, 0x10, 0x45, 0x14, 0xc5, 0xa5, 0x02, 0x00, 0x05, 0x02,
+0xf0, 0x35, 0x03, 0x68, 0x1b, 0xf1, 0x31, 0x02, 0xc5, 0x8a, 0x01, 0x86, 0x05, 0x8a, 0xc5, 0x8b,
+0x03, 0x03, 0xdf, 0x45, 0x03, 0x00, 0x88, 0x15, 0x57, 0x21, 0x00, 0x03, 0x02, 0x87, 0xc5, 0x45,
+0x00, 0xff, 0x53, 0x11, 0x45, 0x8a, 0xc0, 0x14, 0x05, 0x74, 0x05, 0x8b, 0xc2, 0x17, 0x8e, 0x15,
+0x02, 0x60, 0xc2, 0x0a, 0x9f, 0x20, 0x90, 0x15, 0x02, 0x86, 0x9f, 0x10, 0x90, 0x15, 0xc2, 0xe7,
+0x90, 0x15, 0x85, 0x74, 0x9f, 0x20, 0x88, 0x10, 0x00, 0xf1, 0x20, 0x88, 0x15, 0xc1, 0x14, 0xc1,
+0x0a, 0xc1, 0x0c, 0xc1, 0x0c, 0xc5, 0x00, 0x05, 0x8b, 0x45, 0x74, 0xc4, 0x17, 0x8a, 0x15, 0x44,
+0x60, 0x1f, 0x21, 0x8c, 0x15, 0x02, 0x86, 0x1f, 0x11, 0x8c, 0x15, 0xc4, 0xe7, 0x8c, 0x15, 0x84,
+0x0c, 0x84, 0x0c, 0x05, 0x8b, 0x05, 0x75, 0x1f, 0x21, 0x86, 0x16, 0x00, 0xfc, 0x05, 0x86, 0x15,
+0xc0, 0x15, 0x82, 0x15, 0x04, 0x0a, 0x01, 0x14, 0x51, 0x24, 0x09, 0x22, 0x01, 0x03, 0x84, 0x0a,
+0x11, 0x14, 0x08, 0x00, 0xf0, 0x05, 0xc4, 0x00, 0x09, 0x22, 0x04, 0x03, 0x84, 0x0a, 0x02, 0x87,
+0x4b, 0x12, 0x01, 0x01, 0x0b, 0x12, 0x8b, 0x0c, 0x93, 0x0c, 0x26, 0x00, 0x01, 0x14, 0x00, 0x1f,
+0x86, 0x14, 0x00, 0x00, 0x76, 0x87, 0x53, 0x12, 0x01, 0x01, 0x13, 0x12, 0x24, 0x00, 0x06, 0x10,
+0x00, 0x02, 0x62, 0x00, 0xf0, 0x2c, 0xc4, 0x00, 0x0b, 0x11, 0xd1, 0x17, 0x92, 0x09, 0xc4, 0x17,
+0x92, 0x15, 0x00, 0x91, 0x80, 0x0a, 0xc0, 0x00, 0x00, 0xd1, 0x11, 0x10, 0xc0, 0x17, 0x8e, 0x15,
+0x04, 0x74, 0x9f, 0x0c, 0x88, 0x15, 0xc0, 0xe7, 0x88, 0x15, 0x11, 0x10, 0xc4, 0x00, 0x11, 0x91,
+0x5f, 0x94, 0xa2, 0x15, 0xc0, 0x17, 0x8a, 0x15, 0x04, 0x74, 0x80, 0x0c, 0x80, 0x0c, 0xc0, 0xe7,
+0x86, 0x18, 0x00, 0xe1, 0x15, 0xfc, 0xff, 0xc0, 0x97, 0x93, 0x15, 0x17, 0x74, 0x03, 0x00, 0x07,
+0x60, 0x11, 0x01, 0x00, 0xc0, 0x07, 0x01, 0x11, 0x11, 0x11, 0x0a, 0x11, 0x11, 0x03, 0x01, 0x11,
+0x0a, 0x02, 0x00, 0x42, 0x87, 0x00, 0x80, 0x2d, 0x62, 0x08, 0x50, 0x08, 0x00, 0x13, 0x00, 0x11,
+0xd4, 0x18, 0x30, 0x02, 0x28, 0x00, 0xdb, 0x1c, 0x21, 0x4a, 0x00, 0xe2, 0x18, 0xf1, 0x00, 0x05,
+0x04, 0x00, 0x40, 0x94, 0x4b, 0x07, 0x03, 0x1c, 0xec, 0x20, 0x48, 0x03, 0xd3, 0x24, 0xa0, 0x05,
+0x50, 0x14, 0x00, 0x00, 0x05, 0x0a, 0x24, 0x0e, 0x40, 0xc5, 0x15, 0x03, 0x00, 0x8e, 0x05, 0xf0,
+0x13, 0x45, 0x14, 0x3a, 0x81, 0x44, 0x14, 0x44, 0x61, 0xc4, 0x27, 0xb2, 0x15, 0x02, 0x86, 0xc4,
+0x17, 0xb2, 0x15, 0x44, 0xe1, 0x17, 0x11, 0x00, 0x00, 0x2f, 0x07, 0xc0, 0x35, 0x20, 0x00, 0x01,
+0x03, 0x05, 0x61, 0x26, 0x07, 0x53, 0x43, 0x61, 0x45, 0x14, 0x26, 0x28, 0x00, 0x11, 0xb6, 0x28,
+0x00, 0x13, 0xb6, 0x28, 0x00, 0x52, 0x1b, 0x07, 0xc0, 0x35, 0x40, 0x28, 0x00, 0x30, 0x55, 0x00,
+0x60, 0x52, 0x00, 0xf0, 0x07, 0x44, 0x14, 0xc0, 0x35, 0x08, 0x00, 0x10, 0x03, 0x45, 0x14, 0x02,
+0x02, 0xc5, 0x17, 0x04, 0x16, 0xc5, 0x25, 0xd0, 0x07, 0x08, 0x87, 0x1a, 0x00, 0x50, 0xdf, 0x17,
+0x88, 0xe2, 0x98, 0x86, 0x25, 0xf1, 0x1d, 0xe0, 0x31, 0x01, 0x87, 0x00, 0xc0, 0x35, 0x10, 0x00,
+0x2d, 0x03, 0xc4, 0x8b, 0xfa, 0x07, 0x04, 0x1d, 0xec, 0x20, 0xf7, 0x03, 0x14, 0x25, 0x05, 0x15,
+0x42, 0x14, 0xf3, 0x81, 0x85, 0xe0, 0xf1, 0x81, 0x5f, 0x21, 0xdc, 0x15, 0x03, 0x86, 0x5f, 0x11,
+0xdc, 0x15, 0xeb, 0x88, 0x00, 0xa0, 0x02, 0x03, 0xc2, 0x67, 0xdc, 0x15, 0x05, 0x15, 0xe4, 0x07,
+0xaa, 0x0f, 0xc0, 0x84, 0x60, 0x42, 0x14, 0x85, 0xe0, 0xde, 0x81, 0x5f, 0x21, 0x04, 0x16, 0x26,
+0x00, 0x31, 0x04, 0x16, 0xd8, 0x86, 0x00, 0x00, 0x26, 0x00, 0xf0, 0x09, 0x04, 0x16, 0xc2, 0x55,
+0x00, 0x80, 0x97, 0x10, 0x00, 0x00, 0x05, 0x10, 0xc5, 0x45, 0xc7, 0xff, 0x85, 0x0c, 0x85, 0x0c,
+0x45, 0x1d, 0x16, 0x17, 0x80, 0x00, 0x80, 0xc2, 0x17, 0x04, 0x16, 0xc0, 0x45, 0xa0, 0xff, 0xb2,
+0x00, 0xf0, 0x01, 0x02, 0x03, 0xc0, 0x65, 0xe0, 0xff, 0xc0, 0x35, 0x01, 0x00, 0x05, 0x02, 0x82,
+0x0c, 0xb8, 0x03, 0x8a, 0x2f, 0xf1, 0x0e, 0x04, 0x16, 0x9f, 0x10, 0x08, 0x17, 0xc0, 0x0c, 0x02,
+0x1c, 0x3e, 0x17, 0xc2, 0x35, 0x00, 0xff, 0x02, 0x02, 0x7a, 0x00, 0x26, 0x17, 0xdf, 0x0b, 0xc4,
+0x15, 0x09, 0x02, 0xf3, 0xc6, 0x02, 0xf0, 0x03, 0x05, 0x02, 0xc2, 0x35, 0x01, 0x40, 0x02, 0x02,
+0xc2, 0x55, 0x00, 0x40, 0x9f, 0x10, 0x0a, 0x17, 0xcd, 0x09, 0xa8, 0x0e, 0xfc, 0x45, 0x08, 0x12,
+0x82, 0x7e, 0xdf, 0x0a, 0xdc, 0x15, 0xf8, 0x02, 0x87, 0x00, 0x02, 0x19, 0x30, 0x19, 0xf8, 0x18,
+0x30, 0x19, 0x1e, 0x19, 0x7e, 0x19, 0x14, 0x19, 0x7e, 0x19, 0xbe, 0x17, 0xd4, 0x17, 0xea, 0x17,
+0x0a, 0x18, 0x20, 0x18, 0x40, 0x18, 0x56, 0x18, 0x6c, 0x18, 0x8c, 0x18, 0xa2, 0x18, 0xc2, 0x18,
+0xd8, 0x18, 0x10, 0x11, 0x10, 0x91, 0x10, 0x79, 0x00, 0x00, 0x10, 0x51, 0x10, 0xd1, 0x10, 0x41,
+0x10, 0xc1, 0x50, 0x14, 0x50, 0x94, 0x02, 0x00, 0x04, 0x00, 0x50, 0x54, 0x50, 0xd4, 0x50, 0x44,
+0x50, 0xc4, 0x10, 0x00, 0xf1, 0x4e, 0x11, 0x14, 0x11, 0x94, 0x06, 0x00, 0x08, 0x00, 0x11, 0x54,
+0x11, 0xd4, 0x11, 0x44, 0x11, 0xc4, 0x20, 0x11, 0x20, 0x91, 0x20, 0x79, 0x0a, 0x00, 0x20, 0x51,
+0x20, 0xd1, 0x20, 0x41, 0x20, 0xc1, 0x60, 0x14, 0x60, 0x94, 0x0c, 0x00, 0x0e, 0x00, 0x60, 0x54,
+0x60, 0xd4, 0x60, 0x44, 0x60, 0xc4, 0x60, 0x18, 0x60, 0x98, 0x10, 0x00, 0x12, 0x00, 0x60, 0x58,
+0x60, 0xd8, 0x60, 0x48, 0x60, 0xc8, 0x11, 0x18, 0x11, 0x98, 0x14, 0x00, 0x16, 0x00, 0x11, 0x58,
+0x11, 0xd8, 0x11, 0x48, 0x11, 0xc8, 0xcd, 0x09, 0xc2, 0x17, 0x08, 0x17, 0x01, 0x92, 0x01, 0x79,
+0x50, 0x90, 0x84, 0xbe, 0x00, 0x80, 0xf6, 0x02, 0x87, 0x00, 0xff, 0x09, 0xd8, 0xfe, 0x18, 0x00,
+0x51, 0x45, 0x14, 0x50, 0x79, 0x83, 0xd4, 0x00, 0x02, 0x16, 0x00, 0xf1, 0x00, 0xc2, 0xfe, 0xdf,
+0x17, 0x08, 0x17, 0xfe, 0x17, 0x45, 0x94, 0x02, 0x92, 0x42, 0x79, 0x90, 0x36, 0x06, 0x00, 0xb0,
+0x21, 0x31, 0xdc, 0x15, 0xf1, 0x36, 0x00, 0x11, 0xa2, 0x36, 0x00, 0x39, 0x05, 0x14, 0x51, 0x36,
+0x00, 0x11, 0x8c, 0x36, 0x00, 0x9b, 0x34, 0x18, 0x05, 0x94, 0x42, 0x92, 0x42, 0x79, 0x91, 0x36,
+0x00, 0x03, 0x82, 0x00, 0x49, 0x98, 0x01, 0x79, 0x48, 0x82, 0x00, 0x11, 0x56, 0x4c, 0x00, 0x39,
+0x45, 0x14, 0x60, 0x4c, 0x00, 0x11, 0x40, 0x4c, 0x00, 0x9b, 0x80, 0x18, 0x45, 0x94, 0x02, 0x98,
+0x42, 0x79, 0x88, 0x4c, 0x00, 0x32, 0xff, 0x09, 0x20, 0x36, 0x00, 0x1a, 0x18, 0x36, 0x00, 0x11,
+0x0a, 0x36, 0x00, 0x4f, 0xb6, 0x18, 0x45, 0x98, 0x36, 0x00, 0x03, 0x20, 0xea, 0xfd, 0xee, 0x00,
+0x2a, 0x05, 0x18, 0xb8, 0x00, 0x20, 0xd4, 0xfd, 0xee, 0x00, 0x4f, 0xec, 0x18, 0x05, 0x98, 0xb8,
+0x00, 0x01, 0xf1, 0x08, 0x01, 0x15, 0xc1, 0x67, 0x9e, 0x16, 0x1f, 0x15, 0x98, 0xe2, 0xc0, 0x14,
+0xc0, 0x67, 0x16, 0x16, 0xdf, 0x14, 0x96, 0xe2, 0xdf, 0x47, 0xc4, 0x0c, 0x0b, 0x60, 0x1f, 0x19,
+0x98, 0xe2, 0x01, 0x19, 0x20, 0x00, 0x24, 0xdf, 0x18, 0x16, 0x00, 0x20, 0xc0, 0x18, 0x26, 0x00,
+0xff, 0x05, 0x87, 0x00, 0xc1, 0x67, 0x30, 0x16, 0xc1, 0x25, 0x00, 0xe0, 0x03, 0x87, 0xc1, 0xe7,
+0x04, 0x16, 0x14, 0x01, 0x01, 0x11, 0xf8, 0x08, 0x01, 0x60, 0x01, 0x0c, 0xc1, 0x55, 0x00, 0xa0,
+0xfa, 0x08, 0x11, 0x9a, 0xfa, 0x08, 0x6e, 0x9c, 0xe2, 0xc4, 0x67, 0x30, 0x16, 0x6a, 0x00, 0x0f,
+0x4e, 0x00, 0x29, 0x0e, 0x9c, 0x00, 0x00, 0xa6, 0x0c, 0x0f, 0x02, 0x00, 0x1d, 0x8f, 0x50, 0x43,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x68, 0x76, 0x01, 0x00, 0x02, 0x00, 0x40, 0xba, 0x2d, 0xda,
+0x2e, 0x08, 0x00, 0x11, 0xd8, 0x06, 0x00, 0x0f, 0x02, 0x00, 0xaf, 0x2c, 0xfe, 0x00, 0x87, 0x18,
+0x0f, 0x02, 0x00, 0xeb, 0xf0, 0x02, 0x0a, 0x00, 0x08, 0x00, 0x50, 0x43, 0x53, 0x74, 0x61, 0x6e,
+0x64, 0x61, 0x72, 0x64, 0x2f, 0x46, 0x58, 0x0f, 0x01, 0xb4, 0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c,
+0x08, 0x00, 0x00, 0xaa, 0x55, 0x02, 0x00, 0xf2, 0x14, 0x00, 0x05, 0x05, 0x07, 0x05, 0x38, 0x10,
+0x10, 0x10, 0x00, 0x00, 0x07, 0x01, 0x03, 0x01, 0x38, 0x08, 0x18, 0x08, 0x00, 0x00, 0x06, 0x01,
+0x01, 0x06, 0x18, 0x28, 0x18, 0x28, 0x00, 0x00, 0x01, 0x01, 0x01, 0x07, 0x14, 0x00, 0x30, 0x0c,
+0x12, 0x12, 0xbe, 0x06, 0x00, 0x02, 0x00, 0xf1, 0x08, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x3e,
+0x00, 0x00, 0x09, 0x0b, 0x0d, 0x09, 0x10, 0x10, 0x10, 0x70, 0x00, 0x00, 0x05, 0x05, 0x02, 0x02,
+0x46, 0x00, 0x50, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x25, 0x00, 0x01, 0x02, 0x00, 0x10, 0x0f, 0x0f,
+0x00, 0x10, 0x08, 0x0b, 0x00, 0x11, 0xf8, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x02, 0xf3, 0x37, 0x00,
+0x0a, 0x00, 0x10, 0xff, 0x05, 0x00, 0x18, 0x08, 0xb8, 0x01, 0x0f, 0x0c, 0x00, 0x13, 0x00, 0x37,
+0x00, 0x06, 0x50, 0x00, 0x02, 0x64, 0x00, 0x00, 0x02, 0x00, 0x06, 0x3e, 0x00, 0x02, 0x5a, 0x00,
+0x06, 0x02, 0x00, 0xb0, 0x00, 0x18, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x18, 0x1f, 0x00, 0x00, 0x07,
+0x00, 0xf0, 0x08, 0x0c, 0x06, 0x03, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x14, 0x14, 0x12, 0x12, 0x11,
+0x00, 0x00, 0x00, 0x20, 0x10, 0x3f, 0x08, 0x04, 0x3f, 0x02, 0x3f, 0x1a, 0x70, 0x41, 0x1c, 0x36,
+0x36, 0x36, 0x1c, 0x41, 0xb3, 0x00, 0x10, 0x08, 0x2a, 0x01, 0x0f, 0x02, 0x00, 0x04, 0x10, 0x18,
+0x01, 0x00, 0x83, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x24, 0x00, 0x51, 0x36, 0x36,
+0x7f, 0x36, 0x7f, 0x0e, 0x00, 0x61, 0x08, 0x3e, 0x0b, 0x3e, 0x68, 0x3e, 0xf8, 0x00, 0x60, 0x63,
+0x33, 0x18, 0x0c, 0x66, 0x63, 0x8d, 0x79, 0x60, 0x36, 0x1c, 0x0e, 0x5b, 0x33, 0x6e, 0x14, 0x21,
+0x05, 0xfe, 0x84, 0x60, 0x18, 0x0c, 0x06, 0x06, 0x06, 0x0c, 0x46, 0x00, 0x60, 0x18, 0x30, 0x60,
+0x60, 0x60, 0x30, 0x0a, 0x00, 0x62, 0x00, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x53, 0x00, 0x41, 0x18,
+0x18, 0x7e, 0x18, 0x14, 0x00, 0x00, 0x02, 0x00, 0x20, 0x0c, 0x0c, 0x04, 0x13, 0x41, 0x00, 0x00,
+0x00, 0x7e, 0x06, 0x00, 0x01, 0x02, 0x00, 0x01, 0x1e, 0x00, 0x60, 0x40, 0x60, 0x30, 0x18, 0x0c,
+0x06, 0xed, 0x03, 0x20, 0x3c, 0x66, 0x01, 0x00, 0x10, 0x3c, 0x64, 0x00, 0x10, 0x1c, 0xa1, 0x00,
+0x00, 0x2a, 0x00, 0x62, 0x3c, 0x66, 0x30, 0x18, 0x0c, 0x46, 0x0a, 0x00, 0x31, 0x60, 0x38, 0x60,
+0x1e, 0x00, 0x70, 0x38, 0x3c, 0x36, 0x33, 0x7f, 0x30, 0x78, 0x4c, 0x00, 0x32, 0x06, 0x3e, 0x66,
+0x14, 0x00, 0x42, 0x3c, 0x66, 0x06, 0x3e, 0x3c, 0x00, 0x51, 0x7e, 0x62, 0x60, 0x30, 0x30, 0x5a,
+0x00, 0x30, 0x3c, 0x66, 0x66, 0x03, 0x00, 0x02, 0x0a, 0x00, 0x12, 0x7c, 0x28, 0x00, 0x10, 0x00,
+0x1a, 0x00, 0x00, 0x04, 0x00, 0x02, 0x06, 0x00, 0x01, 0xcd, 0x00, 0x00, 0x80, 0x00, 0x22, 0x0c,
+0x18, 0xc6, 0x7a, 0x11, 0x7e, 0x03, 0x00, 0x50, 0x00, 0x00, 0x06, 0x0c, 0x18, 0x17, 0x00, 0x01,
+0x3c, 0x00, 0x00, 0xda, 0x00, 0x00, 0xc8, 0x00, 0x71, 0x3e, 0x63, 0x7b, 0x7b, 0x7b, 0x03, 0x1e,
+0x5c, 0x01, 0x40, 0x1c, 0x36, 0x36, 0x7f, 0x18, 0x01, 0x60, 0x3f, 0x66, 0x66, 0x3e, 0x66, 0x66,
+0x8f, 0x01, 0x51, 0x3c, 0x66, 0x03, 0x03, 0x03, 0x6e, 0x00, 0xf4, 0x02, 0x1f, 0x36, 0x66, 0x66,
+0x66, 0x36, 0x1f, 0x00, 0x00, 0x00, 0x7f, 0x46, 0x16, 0x1e, 0x16, 0x46, 0x7f, 0x0a, 0x00, 0x10,
+0x06, 0x5b, 0x02, 0x51, 0x3c, 0x66, 0x03, 0x73, 0x63, 0x28, 0x00, 0x60, 0x66, 0x66, 0x66, 0x7e,
+0x66, 0x66, 0x2d, 0x01, 0x10, 0x7e, 0xef, 0x00, 0x10, 0x18, 0xe6, 0x00, 0x60, 0x78, 0x30, 0x30,
+0x30, 0x33, 0x33, 0x64, 0x00, 0x60, 0x63, 0x33, 0x1b, 0x0f, 0x1b, 0x33, 0x64, 0x00, 0x51, 0x0f,
+0x06, 0x06, 0x06, 0x06, 0x46, 0x00, 0x60, 0x63, 0x77, 0x7f, 0x7f, 0x6b, 0x63, 0x14, 0x00, 0x51,
+0x63, 0x67, 0x6f, 0x7b, 0x73, 0x0a, 0x00, 0x70, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x11,
+0x02, 0x41, 0x66, 0x66, 0x3e, 0x06, 0x64, 0x00, 0x03, 0x14, 0x00, 0x21, 0x30, 0x60, 0x14, 0x00,
+0x31, 0x1e, 0x36, 0x67, 0xbe, 0x00, 0x50, 0x07, 0x3e, 0x70, 0x63, 0x3e, 0x36, 0x01, 0x10, 0x5a,
+0x6f, 0x00, 0x00, 0x4a, 0x01, 0x00, 0x70, 0x01, 0x02, 0x36, 0x01, 0x51, 0x63, 0x63, 0x36, 0x36,
+0x1c, 0x32, 0x02, 0x61, 0x63, 0x63, 0x6b, 0x7f, 0x7f, 0x77, 0x64, 0x00, 0x20, 0x63, 0x36, 0x49,
+0x00, 0x00, 0xd5, 0x01, 0x32, 0x66, 0x66, 0x3c, 0x32, 0x00, 0x25, 0x7e, 0x62, 0x90, 0x01, 0x10,
+0x0c, 0x01, 0x00, 0x00, 0x46, 0x00, 0x10, 0x02, 0x2d, 0x01, 0x20, 0x60, 0x40, 0x2c, 0x01, 0x10,
+0x30, 0x01, 0x00, 0x00, 0x14, 0x00, 0x30, 0x08, 0x1c, 0x36, 0x43, 0x00, 0x07, 0x02, 0x00, 0x31,
+0xff, 0x00, 0x0c, 0x2c, 0x02, 0x02, 0x02, 0x00, 0x31, 0x1e, 0x30, 0x3e, 0x4e, 0x02, 0x10, 0x07,
+0xb7, 0x01, 0x21, 0x66, 0x3b, 0x15, 0x00, 0x31, 0x3c, 0x66, 0x06, 0x18, 0x01, 0xff, 0xff, 0xf5,
+0x38, 0x30, 0x3e, 0x14, 0x02, 0x1e, 0x02, 0x28, 0x02, 0x32, 0x02, 0x3c, 0x02, 0x46, 0x02, 0x50,
+0x02, 0x5a, 0x02, 0x64, 0x02, 0x6e, 0x02, 0x78, 0x02, 0x82, 0x02, 0x8c, 0x02, 0x96, 0x02, 0xa0,
+0x02, 0xaa, 0x02, 0xb4, 0x02, 0xbe, 0x02, 0xc8, 0x02, 0xd2, 0x02, 0xdc, 0x02, 0xe6, 0x02, 0xf0,
+0x02, 0xfa, 0x02, 0x04, 0x03, 0x0e, 0x03, 0x18, 0x03, 0x22, 0x03, 0x2c, 0x03, 0x36, 0x03, 0x40,
+0x03, 0x4a, 0x03, 0x54, 0x03, 0x5e, 0x03, 0x68, 0x03, 0x72, 0x03, 0x7c, 0x03, 0x86, 0x03, 0x90,
+0x03, 0x9a, 0x03, 0xa4, 0x03, 0xae, 0x03, 0xb8, 0x03, 0xc2, 0x03, 0xcc, 0x03, 0xd6, 0x03, 0xe0,
+0x03, 0xea, 0x03, 0xf4, 0x03, 0xfe, 0x03, 0x08, 0x04, 0x12, 0x04, 0x1c, 0x04, 0x26, 0x04, 0x30,
+0x04, 0x3a, 0x04, 0x44, 0x04, 0x4e, 0x04, 0x58, 0x04, 0x62, 0x04, 0x6c, 0x04, 0x76, 0x04, 0x80,
+0x04, 0x8a, 0x04, 0x94, 0x04, 0x9e, 0x04, 0xa8, 0x04, 0xb2, 0x04, 0xbc, 0x04, 0xc6, 0x04, 0xd0,
+0x04, 0xda, 0x04, 0xe4, 0x04, 0xee, 0x04, 0xf8, 0x04, 0x02, 0x05, 0x0c, 0x05, 0x16, 0x05, 0x20,
+0x05, 0x2a, 0x05, 0x34, 0x05, 0x3e, 0x05, 0x48, 0x05, 0x52, 0x05, 0x5c, 0x05, 0x66, 0x05, 0x70,
+0x05, 0x7a, 0x05, 0x84, 0x05, 0x8e, 0x05, 0x98, 0x05, 0xa2, 0x05, 0xac, 0x05, 0xb6, 0x05, 0xc0,
+0x05, 0xca, 0x05, 0xd4, 0x05, 0xde, 0x05, 0xe8, 0x05, 0xf2, 0x05, 0xfc, 0x05, 0x06, 0x06, 0x10,
+0x06, 0x1a, 0x06, 0x24, 0x06, 0x2e, 0x06, 0x38, 0x06, 0x42, 0x06, 0x4c, 0x06, 0x56, 0x06, 0x60,
+0x06, 0x6a, 0x06, 0x74, 0x06, 0x7e, 0x06, 0x88, 0x06, 0x92, 0x06, 0x9c, 0x06, 0xa6, 0x06, 0xb0,
+0x06, 0xba, 0x06, 0xc4, 0x06, 0xce, 0x06, 0xd8, 0x06, 0xe2, 0x06, 0xec, 0x06, 0xf6, 0x06, 0x00,
+0x07, 0x0a, 0x07, 0x14, 0x07, 0x1e, 0x07, 0x28, 0x07, 0x32, 0x07, 0x3c, 0x07, 0x46, 0x07, 0x50,
+0x07, 0x5a, 0x07, 0x64, 0x07, 0x6e, 0x07, 0x78, 0x07, 0x82, 0x07, 0x8c, 0x07, 0x96, 0x07, 0xa0,
+0x07, 0xaa, 0x07, 0xb4, 0x07, 0xbe, 0x07, 0xc8, 0x07, 0xd2, 0x07, 0xdc, 0x07, 0xe6, 0x07, 0xf0,
+0x07, 0xfa, 0x07, 0x04, 0x08, 0x0e, 0x08, 0x18, 0x08, 0x22, 0x08, 0x2c, 0x08, 0x36, 0x08, 0x40,
+0x08, 0x4a, 0x08, 0x54, 0x08, 0x5e, 0x08, 0x68, 0x08, 0x72, 0x08, 0x7c, 0x08, 0x86, 0x08, 0x90,
+0x08, 0x9a, 0x08, 0xa4, 0x08, 0xae, 0x08, 0xb8, 0x08, 0xc2, 0x08, 0xcc, 0x08, 0xd6, 0x08, 0xe0,
+0x08, 0xea, 0x08, 0xf4, 0x08, 0xfe, 0x08, 0x08, 0x09, 0x12, 0x09, 0x1c, 0x09, 0x26, 0x09, 0x30,
+0x09, 0x3a, 0x09, 0x44, 0x09, 0x4e, 0x09, 0x58, 0x09, 0x62, 0x09, 0x6c, 0x09, 0x76, 0x09, 0x80,
+0x09, 0x8a, 0x09, 0x94, 0x09, 0x9e, 0x09, 0xa8, 0x09, 0xb2, 0x09, 0xbc, 0x09, 0xc6, 0x09, 0xd0,
+0x09, 0xda, 0x09, 0xe4, 0x09, 0xee, 0x09, 0xf8, 0x09, 0x02, 0x0a, 0x0c, 0x0a, 0x16, 0x0a, 0x20,
+0x0a, 0x2a, 0x0a, 0x34, 0x0a, 0x3e, 0x0a, 0x48, 0x0a, 0x52, 0x0a, 0x5c, 0x0a, 0x66, 0x0a, 0x70,
+0x0a, 0x7a, 0x0a, 0x84, 0x0a, 0x8e, 0x0a, 0x98, 0x0a, 0xa2, 0x0a, 0xac, 0x0a, 0xb6, 0x0a, 0xc0,
+0x0a, 0xca, 0x0a, 0xd4, 0x0a, 0xde, 0x0a, 0xe8, 0x0a, 0xf2, 0x0a, 0xfc, 0x0a, 0x06, 0x0b, 0x10,
+0x0b, 0x1a, 0x0b, 0x24, 0x0b, 0x2e, 0x0b, 0x38, 0x0b, 0x42, 0x0b, 0x4c, 0x0b, 0x56, 0x0b, 0x60,
+0x0b, 0x6a, 0x0b, 0x74, 0x0b, 0x7e, 0x0b, 0x88, 0x0b, 0x92, 0x0b, 0x9c, 0x0b, 0xa6, 0x0b, 0xb0,
+0x0b, 0xba, 0x0b, 0xc4, 0x0b, 0xce, 0x0b, 0xd8, 0x0b, 0xe2, 0x0b, 0xec, 0x0b, 0xf6, 0x0b, 0x00,
+0x0c, 0x0a, 0x0c, 0x00, 0x06, 0xff, 0xff, 0xff, 0xf0, 0x21, 0x33, 0x33, 0x1e, 0x06, 0x00, 0x14,
+0x06, 0x20, 0x7e, 0x06, 0x50, 0x06, 0x60, 0x38, 0x6c, 0x0c, 0x1e, 0x0c, 0x0c, 0x18, 0x07, 0x93,
+0x00, 0x00, 0x6e, 0x33, 0x33, 0x33, 0x3e, 0x30, 0x1e, 0x3c, 0x06, 0x00, 0x40, 0x07, 0x20, 0x18,
+0x00, 0x31, 0x08, 0x00, 0x40, 0x07, 0x60, 0x60, 0x00, 0x60, 0x60, 0x60, 0x60, 0xd4, 0x06, 0x60,
+0x07, 0x06, 0x66, 0x36, 0x1e, 0x36, 0x1e, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x1e, 0x00, 0x70, 0x00,
+0x00, 0x37, 0x7f, 0x6b, 0x6b, 0x6b, 0x09, 0x00, 0x20, 0x00, 0x3b, 0xfb, 0x06, 0x01, 0x0a, 0x00,
+0x00, 0x78, 0x08, 0x00, 0x64, 0x00, 0x02, 0x14, 0x00, 0x11, 0x3e, 0x42, 0x07, 0x02, 0x64, 0x00,
+0x00, 0x64, 0x08, 0x22, 0x3b, 0x66, 0x54, 0x07, 0x60, 0x00, 0x00, 0x7c, 0x06, 0x3c, 0x60, 0x40,
+0x07, 0x10, 0x0c, 0x8b, 0x00, 0x20, 0x6c, 0x38, 0x13, 0x00, 0x25, 0x00, 0x33, 0xaa, 0x00, 0x00,
+0x85, 0x07, 0x01, 0x34, 0x09, 0x61, 0x00, 0x63, 0x6b, 0x7f, 0x77, 0x22, 0x1e, 0x00, 0x01, 0x41,
+0x07, 0x02, 0x0a, 0x00, 0x60, 0x63, 0x36, 0x1c, 0x0c, 0x06, 0x03, 0x7e, 0x07, 0x30, 0x32, 0x18,
+0x4c, 0xaa, 0x00, 0x51, 0x30, 0x18, 0x18, 0x0e, 0x18, 0x76, 0x08, 0x01, 0x8c, 0x09, 0x01, 0x94,
+0x08, 0x41, 0x0c, 0x18, 0x18, 0x70, 0x93, 0x08, 0x41, 0x00, 0xce, 0xdb, 0x73, 0x38, 0x00, 0x25,
+0x00, 0xff, 0x01, 0x00, 0x42, 0x18, 0x18, 0x18, 0xff, 0x27, 0x0c, 0x45, 0x36, 0x36, 0x36, 0x36,
+0x2e, 0x0a, 0x30, 0xff, 0x00, 0xff, 0xdf, 0x00, 0x60, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x08,
+0x00, 0x00, 0x1e, 0x00, 0x10, 0x37, 0x05, 0x00, 0x01, 0xda, 0x09, 0x14, 0x3f, 0x0a, 0x00, 0x03,
+0x1e, 0x00, 0x00, 0x56, 0x00, 0x11, 0xff, 0x14, 0x00, 0x00, 0x02, 0x00, 0x10, 0xfe, 0x0f, 0x00,
+0x00, 0x7d, 0x00, 0x22, 0xf8, 0x18, 0xd9, 0x0a, 0x54, 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x46, 0x00,
+0x00, 0xd7, 0x08, 0x01, 0x9f, 0x00, 0x10, 0x1f, 0x7b, 0x0a, 0x01, 0x0a, 0x00, 0x07, 0x1e, 0x00,
+0x10, 0xf6, 0x41, 0x00, 0x01, 0x64, 0x00, 0x14, 0xfe, 0x0a, 0x00, 0x21, 0xfe, 0x06, 0x15, 0x00,
+0x00, 0x8c, 0x08, 0x12, 0x30, 0x83, 0x00, 0x41, 0x36, 0x36, 0x37, 0x30, 0x47, 0x00, 0x52, 0x36,
+0x36, 0x36, 0xf6, 0x06, 0x6f, 0x00, 0x01, 0xb4, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1f, 0x00, 0x02,
+0x02, 0x00, 0x00, 0xe9, 0x00, 0x22, 0x00, 0xf7, 0x0c, 0x00, 0x25, 0x36, 0x37, 0x3c, 0x00, 0x15,
+0xf7, 0x28, 0x00, 0x12, 0xf6, 0x5a, 0x00, 0x01, 0x14, 0x00, 0x01, 0x28, 0x00, 0x42, 0x00, 0x33,
+0x00, 0xcc, 0x04, 0x00, 0x24, 0x33, 0xcc, 0x02, 0x00, 0x42, 0xff, 0xcc, 0xff, 0x33, 0x04, 0x00,
+0x00, 0x2a, 0x00, 0x02, 0xe6, 0x00, 0x00, 0x36, 0x01, 0x11, 0x18, 0x22, 0x01, 0x00, 0x72, 0x00,
+0x01, 0xdb, 0x00, 0x01, 0x0a, 0x00, 0x01, 0x2b, 0x01, 0x01, 0x02, 0x00, 0x00, 0xa9, 0x09, 0x01,
+0xdc, 0x00, 0x05, 0x03, 0x01, 0x00, 0xa1, 0x00, 0x00, 0x06, 0x00, 0x01, 0x1f, 0x00, 0x01, 0x02,
+0x00, 0x00, 0x0e, 0x00, 0x01, 0x45, 0x00, 0x01, 0x02, 0x00, 0x06, 0x3c, 0x00, 0x06, 0x28, 0x00,
+0x02, 0x5a, 0x00, 0x00, 0x02, 0x00, 0x02, 0x28, 0x00, 0x05, 0xb7, 0x01, 0x02, 0x23, 0x00, 0x01,
+0x0f, 0x00, 0x15, 0x0f, 0x01, 0x00, 0x15, 0xf0, 0x01, 0x00, 0x01, 0x19, 0x00, 0x00, 0x5f, 0x00,
+0x02, 0x34, 0x09, 0x11, 0x63, 0x56, 0x0a, 0x20, 0x7f, 0x46, 0x17, 0x09, 0x00, 0x38, 0x01, 0x06,
+0x60, 0x0a, 0x30, 0x7f, 0x63, 0x03, 0x01, 0x00, 0x00, 0x66, 0x09, 0x00, 0xde, 0x00, 0x30, 0x36,
+0x7f, 0x41, 0x28, 0x00, 0x04, 0x60, 0x0a, 0x51, 0x6b, 0x6b, 0x3e, 0x1c, 0x3e, 0xda, 0x02, 0x60,
+0x3f, 0x61, 0x60, 0x3c, 0x60, 0x61, 0x3c, 0x00, 0x50, 0x63, 0x63, 0x73, 0x6b, 0x67, 0xc0, 0x09,
+0x24, 0x14, 0x6b, 0x0a, 0x00, 0x07, 0x56, 0x0a, 0x10, 0x7c, 0x00, 0x03, 0x01, 0xdc, 0x0b, 0x07,
+0x56, 0x0a, 0x40, 0x63, 0x63, 0x7f, 0x63, 0x32, 0x00, 0x10, 0x00, 0xf9, 0x09, 0x02, 0x56, 0x0a,
+0x00, 0x11, 0x00, 0x02, 0x14, 0x00, 0x15, 0x3f, 0x1e, 0x03, 0x06, 0xec, 0x0a, 0x20, 0x3f, 0x2d,
+0x06, 0x0a, 0x00, 0x98, 0x03, 0x51, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x0a, 0x51, 0x08, 0x3e,
+0x6b, 0x6b, 0x6b, 0x40, 0x0c, 0x00, 0x14, 0x03, 0x11, 0x36, 0x50, 0x00, 0x00, 0x28, 0x03, 0x42,
+0x33, 0x33, 0x7f, 0x40, 0x0a, 0x00, 0x02, 0x5a, 0x03, 0x11, 0x6b, 0x01, 0x00, 0x00, 0x1e, 0x0b,
+0x01, 0x09, 0x00, 0x34, 0x6b, 0xff, 0x80, 0x10, 0x0a, 0x00, 0x66, 0x03, 0x72, 0x43, 0x43, 0x4f,
+0x5b, 0x5b, 0x5b, 0x4f, 0x00, 0x0b, 0x03, 0x64, 0x0b, 0x42, 0x3e, 0x63, 0x60, 0x7c, 0x64, 0x00,
+0x70, 0x39, 0x6d, 0x6d, 0x6f, 0x6d, 0x6d, 0x39, 0x50, 0x03, 0x52, 0x33, 0x33, 0x3e, 0x3c, 0x36,
+0x2e, 0x03, 0x04, 0x56, 0x0a, 0x60, 0x00, 0x00, 0x3f, 0x03, 0x3f, 0x63, 0x04, 0x01, 0x00, 0xb6,
+0x00, 0x11, 0x3e, 0xa0, 0x0b, 0x42, 0x00, 0x00, 0x3f, 0x33, 0x40, 0x01, 0x02, 0x42, 0x01, 0x01,
+0x69, 0x01, 0x50, 0x00, 0x3e, 0x63, 0x7f, 0x03, 0x6e, 0x00, 0x62, 0x00, 0x00, 0x6b, 0x2a, 0x1c,
+0x2a, 0x1a, 0x04, 0x40, 0x1e, 0x31, 0x18, 0x31, 0xd2, 0x00, 0x21, 0x00, 0x00, 0x37, 0x01, 0x54,
+0x00, 0x00, 0x00, 0x14, 0x08, 0x0a, 0x00, 0x21, 0x00, 0x00, 0x97, 0x0b, 0x00, 0x09, 0x00, 0x01,
+0x46, 0x00, 0x02, 0x0a, 0x00, 0x22, 0x63, 0x77, 0x96, 0x0b, 0x00, 0xde, 0x00, 0x22, 0x3f, 0x33,
+0x14, 0x00, 0x22, 0x1e, 0x33, 0xc8, 0x0b, 0x00, 0x78, 0x00, 0x13, 0x33, 0x14, 0x00, 0x00, 0x74,
+0x04, 0x02, 0x60, 0x04, 0x31, 0x1e, 0x33, 0x03, 0xe6, 0x0b, 0x02, 0x42, 0x01, 0x03, 0x6e, 0x00,
+0x83, 0x63, 0x63, 0x66, 0x7c, 0x60, 0x3e, 0x00, 0x0c, 0x41, 0x01, 0x00, 0xd4, 0x0b, 0x06, 0x42,
+0x04, 0x04, 0x40, 0x01, 0x00, 0x0a, 0x00, 0x22, 0x3e, 0x30, 0xae, 0x0c, 0x00, 0x38, 0x01, 0x00,
+0x40, 0x01, 0x02, 0x0a, 0x00, 0x00, 0x40, 0x01, 0x42, 0x00, 0x00, 0x07, 0x3e, 0x40, 0x01, 0x20,
+0x00, 0x00, 0x41, 0x01, 0x00, 0x40, 0x01, 0x62, 0x00, 0x00, 0x03, 0x03, 0x1f, 0x33, 0xe7, 0x02,
+0x42, 0x1f, 0x30, 0x3c, 0x30, 0x0a, 0x00, 0x31, 0x39, 0x6d, 0x6f, 0x40, 0x01, 0xa6, 0x00, 0x00,
+0x3e, 0x33, 0x3e, 0x36, 0x33, 0x00, 0x00, 0x14, 0x4e, 0x02, 0x51, 0x14, 0x00, 0x1e, 0x33, 0x3f,
+0xea, 0x0c, 0x00, 0x02, 0x00, 0x31, 0xc0, 0x60, 0x18, 0xba, 0x04, 0x7b, 0x00, 0x00, 0x03, 0x06,
+0x18, 0x60, 0xc0, 0x0f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x13, 0x0d, 0x32, 0x38, 0xff, 0x38, 0xff,
+0x04, 0x50, 0x10, 0x1c, 0xff, 0x1c, 0x10, 0x56, 0x04, 0x12, 0x3c, 0xd7, 0x0c, 0x05, 0x02, 0x00,
+0x30, 0x7e, 0x3c, 0x18, 0x7f, 0x0d, 0x10, 0x7e, 0x05, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1f, 0x0e,
+0xa0, 0x7e, 0x00, 0x00, 0xf1, 0x11, 0x13, 0xd5, 0x15, 0xd9, 0x11, 0xca, 0x0e, 0x71, 0x81, 0x3c,
+0x42, 0x42, 0x42, 0x42, 0x3c, 0x83, 0x8a, 0x22, 0x3c, 0x3c, 0x94, 0x05, 0x71, 0x00, 0x00, 0x24,
+0x24, 0x24, 0x24, 0x5a, 0xdf, 0x0e, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xf0, 0x00, 0x26,
+0x10, 0x66, 0x10, 0xa6, 0x10, 0xe6, 0x10, 0x26, 0x11, 0x83, 0x10, 0x43, 0xe0, 0x83, 0x96, 0x2b,
+0xdf, 0x65, 0xe2, 0x40, 0x02, 0x0a, 0x40, 0x14, 0xc4, 0x15, 0x15, 0x00, 0x90, 0x10, 0x02, 0x00,
+0x13, 0x80, 0x15, 0x7f, 0xd9, 0x7e, 0x84, 0x15, 0x83, 0x15, 0x4c, 0x39, 0x22, 0x80, 0x15, 0xc4,
+0x4e, 0x02, 0x56, 0x00, 0xf9, 0x0c, 0xc2, 0x0a, 0x83, 0xe0, 0xc1, 0x0c, 0x42, 0x6c, 0xe2, 0x40,
+0xc1, 0x15, 0x0a, 0x00, 0x80, 0x10, 0xc4, 0x10, 0x10, 0x8a, 0x02, 0x7f, 0xc2, 0x65, 0x54, 0x00,
+0x47, 0x32, 0x00, 0x42, 0xdf, 0x09, 0xac, 0x2c, 0x38, 0x00, 0xf0, 0x39, 0xe6, 0x10, 0xc1, 0x0c,
+0x41, 0x1c, 0xe2, 0x40, 0x81, 0x60, 0xc1, 0x0a, 0xc0, 0x0c, 0x00, 0x1c, 0x00, 0x00, 0xdf, 0x35,
+0x00, 0x80, 0x28, 0x40, 0x14, 0x02, 0x09, 0x94, 0x31, 0x94, 0x54, 0x00, 0x31, 0x94, 0xa8, 0x00,
+0x31, 0x94, 0xfc, 0x00, 0x31, 0x94, 0x50, 0x01, 0x31, 0x94, 0xa4, 0x01, 0x31, 0x94, 0xf8, 0x01,
+0x31, 0x94, 0x4c, 0x02, 0x31, 0x94, 0xa0, 0x02, 0x31, 0x94, 0xf4, 0x02, 0x27, 0x01, 0x03, 0x94,
+0x43, 0x8a, 0xc9, 0x90, 0x06, 0x00, 0x42, 0xf1, 0x90, 0x54, 0x00, 0x08, 0x00, 0x13, 0xa8, 0x08,
+0x00, 0x13, 0xfc, 0x08, 0x00, 0x11, 0x50, 0x26, 0x00, 0x33, 0xf1, 0x90, 0xa4, 0x08, 0x00, 0x13,
+0xf8, 0x08, 0x00, 0x22, 0x4c, 0x02, 0x30, 0x00, 0x13, 0xa0, 0x08, 0x00, 0xe4, 0xf4, 0x02, 0xdf,
+0x35, 0x00, 0x20, 0x28, 0x40, 0x02, 0x03, 0x71, 0x8a, 0xf4, 0x02, 0x88, 0x4e, 0x00, 0x36, 0x01,
+0x06, 0xa8, 0x00, 0x44, 0x5f, 0x10, 0x08, 0x40, 0xac, 0x00, 0x33, 0xc3, 0x15, 0x53, 0xb0, 0x00,
+0x8f, 0x1e, 0x02, 0x11, 0x94, 0x49, 0x8a, 0xc1, 0x60, 0x06, 0x00, 0x21, 0x60, 0x27, 0x01, 0x09,
+0x94, 0x51, 0x8a, 0x3e, 0x00, 0x0f, 0x08, 0x00, 0x33, 0x02, 0xc4, 0x00, 0x48, 0x01, 0x03, 0x61,
+0x8a, 0xc2, 0x00, 0x02, 0xa2, 0x01, 0x42, 0x66, 0x11, 0x42, 0xe0, 0xf6, 0x01, 0xc0, 0x40, 0x10,
+0x03, 0x14, 0x11, 0x14, 0x82, 0x7e, 0xd1, 0x10, 0x10, 0x01, 0xe2, 0x00, 0x04, 0x20, 0x00, 0x00,
+0x1a, 0x02, 0xf8, 0x07, 0xc2, 0x0c, 0xc2, 0x65, 0xe2, 0x40, 0x81, 0x10, 0x40, 0x14, 0xa1, 0x18,
+0xc2, 0x7e, 0x21, 0x10, 0xdf, 0x09, 0xd8, 0x2c, 0x85, 0x15, 0xf4, 0x01, 0x01, 0xcc, 0x4a, 0x90,
+0x40, 0x26, 0x02, 0x26, 0x10, 0xc0, 0x17, 0x2a, 0x40, 0xba, 0x01, 0xe0, 0xe2, 0x40, 0xc0, 0x67,
+0x2c, 0x40, 0xc0, 0x0a, 0x1f, 0x10, 0x08, 0x40, 0x06, 0x01, 0x18, 0x00, 0xf3, 0x30, 0x08, 0x40,
+0x15, 0x03, 0x1f, 0x0a, 0x08, 0x40, 0x48, 0x8a, 0x70, 0x8a, 0x54, 0x00, 0x70, 0x8a, 0xa8, 0x00,
+0x70, 0x8a, 0xfc, 0x00, 0x70, 0x8a, 0x50, 0x01, 0x70, 0x8a, 0xa4, 0x01, 0x70, 0x8a, 0xf8, 0x01,
+0x70, 0x8a, 0x4c, 0x02, 0x70, 0x8a, 0xa0, 0x02, 0x70, 0x8a, 0xf4, 0x02, 0x80, 0x15, 0x87, 0x00,
+0x56, 0x20, 0x54, 0x20, 0x2d, 0x20, 0x20, 0x35, 0x20, 0x32, 0x20, 0x20, 0x20, 0x0e, 0x00, 0xb0,
+0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x20, 0x00, 0x31, 0x20, 0x35, 0x1c, 0x00, 0x31, 0xb8, 0x20,
+0xcd, 0x1c, 0x00, 0x40, 0x32, 0x2e, 0x37, 0x20, 0x01, 0x00, 0xf0, 0x08, 0x46, 0x6f, 0x6e, 0x74,
+0x20, 0x3a, 0x20, 0x00, 0x1b, 0x5b, 0x3f, 0x6c, 0x3b, 0x30, 0x63, 0x00, 0x1b, 0x2f, 0x5a, 0x00,
+0x1b, 0x5b, 0x30, 0x01, 0x00, 0x61, 0x7a, 0x00, 0x42, 0x20, 0x20, 0x65, 0x03, 0x00, 0x40, 0x70,
+0x20, 0x20, 0x2e, 0x02, 0x00, 0xf1, 0x09, 0x00, 0x05, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
+0x0e, 0x0f, 0x18, 0x17, 0x1b, 0xff, 0x44, 0x25, 0x50, 0x2a, 0x6e, 0x25, 0xa6, 0x25, 0xc0, 0x02,
+0x00, 0xf1, 0x10, 0x9e, 0x25, 0x1e, 0x25, 0x34, 0x25, 0xf6, 0x24, 0x0c, 0x25, 0xfc, 0x24, 0x5b,
+0x23, 0x28, 0x29, 0x44, 0x45, 0x4d, 0x37, 0x38, 0x48, 0x63, 0x3d, 0x3e, 0x5a, 0x57, 0xff, 0x46,
+0x25, 0x4c, 0x02, 0x00, 0xf0, 0x2f, 0xc0, 0x25, 0xbc, 0x25, 0xe0, 0x25, 0x70, 0x26, 0x7a, 0x26,
+0x8c, 0x26, 0x9c, 0x26, 0xfc, 0x26, 0x04, 0x27, 0x1a, 0x2a, 0x46, 0x29, 0x41, 0x42, 0x43, 0x44,
+0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x59, 0x5a, 0x3d, 0x3e, 0x3c, 0xff, 0x5e, 0x25, 0x7e, 0x25,
+0x8e, 0x25, 0x6e, 0x25, 0x3c, 0x2a, 0x3c, 0x2a, 0x86, 0x28, 0xe0, 0x25, 0x48, 0x26, 0x0e, 0x26,
+0x52, 0x25, 0x1a, 0x2a, 0x30, 0x00, 0x20, 0x2c, 0x2a, 0x2e, 0x00, 0xf2, 0x87, 0x48, 0x66, 0x6d,
+0x4b, 0x4a, 0x71, 0x72, 0x67, 0x68, 0x6c, 0x6e, 0x63, 0x58, 0x59, 0x5a, 0xff, 0x0c, 0x27, 0x1e,
+0x27, 0x30, 0x27, 0x42, 0x27, 0x54, 0x27, 0x54, 0x27, 0xbc, 0x27, 0x20, 0x26, 0x30, 0x26, 0x16,
+0x28, 0x18, 0x28, 0x5e, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0x50, 0x29, 0x14, 0x2a, 0x1a, 0x29, 0x10,
+0x29, 0x04, 0x29, 0xc0, 0x25, 0x7f, 0x00, 0x42, 0x03, 0x17, 0x20, 0x20, 0x00, 0x09, 0x86, 0xdf,
+0x09, 0x6a, 0x22, 0xc1, 0x15, 0x02, 0x23, 0xc2, 0x15, 0x10, 0x23, 0xdf, 0x09, 0xd8, 0x2a, 0x33,
+0x01, 0xc7, 0x67, 0x26, 0x40, 0x05, 0x01, 0x33, 0x01, 0x46, 0x01, 0x63, 0x01, 0x74, 0x01, 0x7c,
+0x01, 0xc1, 0x97, 0xe0, 0x40, 0x06, 0x03, 0xc0, 0x8b, 0x04, 0x81, 0x17, 0x20, 0x60, 0x00, 0x01,
+0x87, 0x40, 0x40, 0xc1, 0x17, 0x02, 0x40, 0x04, 0x07, 0x00, 0x9c, 0x54, 0x2b, 0xc0, 0x45, 0x00,
+0xff, 0xc1, 0x17, 0x2a, 0x40, 0xc2, 0x17, 0x2c, 0x40, 0x9f, 0x20, 0x38, 0x40, 0x0a, 0x03, 0x9f,
+0x0a, 0x2c, 0x40, 0xd6, 0x01, 0x00, 0x8e, 0x5d, 0xe0, 0x36, 0x21, 0x5f, 0x00, 0x8e, 0x20, 0xdf,
+0x09, 0x8e, 0x20, 0xdf, 0x35, 0x80, 0x00, 0x12, 0x03, 0xf0, 0x09, 0xdf, 0x09, 0xbc, 0x25, 0x5f,
+0x00, 0x4a, 0x22, 0xdf, 0x0b, 0x26, 0x40, 0xfb, 0x03, 0x87, 0x00, 0x1f, 0x90, 0x0d, 0x40, 0x1f,
+0x0a, 0x26, 0x40, 0x5c, 0x31, 0xf1, 0x06, 0x28, 0x40, 0x05, 0x02, 0xc1, 0x15, 0x58, 0x23, 0xc2,
+0x15, 0x68, 0x23, 0x04, 0x01, 0xc1, 0x15, 0x2a, 0x23, 0xc2, 0x15, 0x3a, 0x96, 0x00, 0xf0, 0x07,
+0xe8, 0x01, 0x3f, 0x90, 0x92, 0x1b, 0x9f, 0x0a, 0x0a, 0x40, 0x17, 0x20, 0x40, 0x00, 0xe4, 0x83,
+0x17, 0x20, 0x5b, 0x00, 0x06, 0x87, 0x90, 0x00, 0x80, 0xde, 0x83, 0x17, 0x20, 0x7b, 0x00, 0xdb,
+0x86, 0x44, 0x00, 0xf0, 0x03, 0xc1, 0x15, 0x86, 0x23, 0xc2, 0x15, 0x9a, 0x23, 0xc4, 0x15, 0x0e,
+0x40, 0xc5, 0x17, 0x0a, 0x40, 0x40, 0x99, 0x3c, 0x00, 0x21, 0xca, 0x01, 0x1c, 0x00, 0xf1, 0x07,
+0x97, 0x0d, 0x40, 0xc2, 0x15, 0x4e, 0x2a, 0xc1, 0x25, 0x23, 0x00, 0x07, 0x03, 0xc2, 0x15, 0x3e,
+0x2a, 0xc1, 0x25, 0x28, 0x00, 0x02, 0x0a, 0x00, 0xf1, 0x06, 0xca, 0x09, 0xb8, 0x01, 0xdf, 0x15,
+0x0a, 0x00, 0x26, 0x40, 0xc0, 0xe5, 0x1f, 0x00, 0x03, 0x10, 0xdf, 0x09, 0x82, 0x27, 0xb2, 0x36,
+0x00, 0x04, 0x10, 0x00, 0x31, 0xa8, 0x27, 0xa7, 0x10, 0x00, 0x10, 0x87, 0x8e, 0x52, 0xb0, 0x00,
+0x26, 0x40, 0xdf, 0x15, 0x0e, 0x40, 0x0a, 0x40, 0xd6, 0x0b, 0x10, 0x00, 0x60, 0xff, 0xff, 0x02,
+0x40, 0xdf, 0x45, 0xbe, 0x00, 0xf0, 0x05, 0xdf, 0x09, 0x70, 0x2a, 0x87, 0x00, 0xdf, 0x0b, 0x02,
+0x40, 0x04, 0x03, 0xdf, 0x15, 0x54, 0x2b, 0x02, 0x40, 0x0c, 0x01, 0x16, 0x5e, 0x40, 0xe0, 0x40,
+0x08, 0x01, 0x16, 0x00, 0x22, 0x03, 0x03, 0x2e, 0x00, 0xf0, 0x03, 0x1f, 0x8a, 0xe0, 0x40, 0x87,
+0x00, 0xc0, 0x15, 0x04, 0x00, 0x05, 0x01, 0xc0, 0x15, 0x06, 0x00, 0x02, 0x01, 0x60, 0x38, 0x32,
+0x1f, 0x10, 0x26, 0x52, 0x00, 0xb0, 0x27, 0x2a, 0x40, 0x3c, 0x40, 0x03, 0x03, 0xdf, 0x0a, 0x2a,
+0x40, 0x06, 0x32, 0x51, 0xdf, 0x27, 0x2c, 0x40, 0x36, 0x10, 0x00, 0x13, 0x2c, 0x10, 0x00, 0x77,
+0x2a, 0x40, 0x3e, 0x40, 0x03, 0x03, 0x9f, 0x20, 0x00, 0x11, 0x38, 0x10, 0x00, 0x03, 0x20, 0x00,
+0x50, 0x17, 0x36, 0x40, 0x2c, 0x40, 0x1e, 0x05, 0xf0, 0x03, 0x8e, 0x25, 0x07, 0x86, 0xc0, 0x17,
+0x2c, 0x40, 0xc0, 0xe7, 0x36, 0x40, 0xf0, 0x8b, 0x40, 0x40, 0xf6, 0x03, 0x16, 0x00, 0xf0, 0x09,
+0x9e, 0x25, 0xdf, 0x09, 0x7e, 0x25, 0x08, 0x87, 0xc1, 0x17, 0x3c, 0x40, 0xdf, 0x09, 0xfc, 0x25,
+0xc2, 0x17, 0x3e, 0x40, 0xdf, 0x09, 0xf8, 0x21, 0xb6, 0x01, 0x40, 0x28, 0x40, 0xe0, 0x02, 0x24,
+0x00, 0x51, 0x5e, 0x25, 0xfc, 0x87, 0xc1, 0x18, 0x00, 0x22, 0xfc, 0x25, 0x28, 0x00, 0x40, 0x18,
+0x22, 0x87, 0x00, 0xea, 0x01, 0xf0, 0x03, 0x42, 0x10, 0xdf, 0x09, 0x00, 0x20, 0x87, 0x00, 0xc2,
+0x17, 0x36, 0x40, 0xc3, 0x17, 0x2c, 0x40, 0x04, 0x01, 0xfc, 0x01, 0x40, 0xc3, 0x17, 0x38, 0x40,
+0x1e, 0x00, 0x40, 0xdf, 0x09, 0x56, 0x20, 0x40, 0x00, 0xb1, 0xe4, 0x2a, 0xf4, 0x03, 0xc3, 0x0a,
+0xed, 0x03, 0xc3, 0x0a, 0xe5, 0x74, 0x00, 0xf0, 0x0b, 0xe4, 0x2a, 0x09, 0x03, 0xc3, 0x0a, 0x0f,
+0x03, 0xc3, 0x0a, 0x18, 0x02, 0xc1, 0x17, 0x30, 0x40, 0xc2, 0x17, 0x32, 0x40, 0x11, 0x01, 0xdf,
+0x09, 0x0e, 0x26, 0x36, 0x00, 0x00, 0x0e, 0x00, 0x82, 0x81, 0x0a, 0x07, 0x01, 0xdf, 0x09, 0x04,
+0x26, 0x1e, 0x00, 0x82, 0x2a, 0x40, 0xc2, 0x0a, 0x42, 0x20, 0x02, 0x82, 0x6c, 0x00, 0x80, 0xc0,
+0x15, 0x28, 0x40, 0xc1, 0x15, 0x1e, 0x40, 0x14, 0x02, 0x82, 0x28, 0x40, 0xc0, 0x15, 0x1e, 0x40,
+0x11, 0x14, 0x02, 0x00, 0x25, 0x87, 0x00, 0xe0, 0x00, 0x40, 0x95, 0xff, 0x00, 0x40, 0xf6, 0x00,
+0xf0, 0x06, 0x95, 0x1b, 0x00, 0x0c, 0x40, 0xc1, 0x15, 0x01, 0x00, 0xc2, 0x15, 0x18, 0x00, 0xc3,
+0x15, 0x50, 0x00, 0xc5, 0x15, 0x26, 0x40, 0x2e, 0x47, 0x80, 0x84, 0x00, 0x55, 0x10, 0x55, 0x10,
+0x15, 0x0a, 0xa8, 0x3b, 0x80, 0x95, 0x10, 0x55, 0x10, 0xd5, 0x10, 0xd5, 0x10, 0x0c, 0x00, 0xf0,
+0x0b, 0x00, 0x0a, 0xc4, 0x15, 0xa0, 0x00, 0xc0, 0x35, 0x07, 0x00, 0x03, 0x02, 0xd5, 0x95, 0xff,
+0x00, 0x01, 0x01, 0x15, 0x8a, 0x80, 0x0a, 0x09, 0x7f, 0x15, 0x8a, 0x76, 0x04, 0x22, 0x01, 0x0a,
+0x20, 0x01, 0x23, 0x00, 0x20, 0xde, 0x01, 0x40, 0x55, 0x00, 0x04, 0x28, 0x68, 0x00, 0x13, 0x45,
+0x08, 0x00, 0x70, 0x09, 0xe4, 0x2a, 0x01, 0x02, 0x83, 0x0a, 0x34, 0x01, 0x42, 0x01, 0x86, 0xc4,
+0x7e, 0xfe, 0x00, 0x02, 0x12, 0x00, 0x1d, 0x7e, 0x12, 0x00, 0x1d, 0x8e, 0x12, 0x00, 0x17, 0x6e,
+0x12, 0x00, 0xc0, 0x05, 0x21, 0x0a, 0x02, 0xcc, 0xa5, 0x3b, 0x00, 0x07, 0x03, 0xc3, 0x0b, 0x84,
+0x02, 0x20, 0x03, 0x0a, 0x7a, 0x02, 0x00, 0xbe, 0x5e, 0x00, 0x42, 0x01, 0x00, 0x12, 0x00, 0x22,
+0x83, 0x10, 0x12, 0x00, 0x00, 0x60, 0x00, 0xf0, 0x03, 0xc1, 0x17, 0x32, 0x40, 0xdf, 0x35, 0x40,
+0x00, 0x28, 0x40, 0x05, 0x03, 0xc3, 0x67, 0x3c, 0x40, 0xc3, 0x0a, 0xb2, 0x01, 0xa2, 0xc1, 0x20,
+0x01, 0x83, 0x43, 0x10, 0xdf, 0x10, 0x2a, 0x40, 0x26, 0x00, 0x60, 0xdf, 0x20, 0x38, 0x40, 0x02,
+0x83, 0xa0, 0x01, 0x20, 0xdf, 0x10, 0x16, 0x02, 0xc0, 0x02, 0x0a, 0x05, 0x21, 0x22, 0x03, 0x05,
+0x21, 0x1c, 0x03, 0x82, 0x0a, 0x56, 0x00, 0xf0, 0x0a, 0x02, 0x02, 0x26, 0x0a, 0xf8, 0x01, 0xc0,
+0x15, 0x00, 0x10, 0xd7, 0x20, 0x01, 0x00, 0x0f, 0x03, 0xc0, 0x15, 0x00, 0x20, 0xd7, 0x20, 0x04,
+0x00, 0x0a, 0x0a, 0x00, 0x60, 0x40, 0xd7, 0x20, 0x05, 0x00, 0x05, 0x0a, 0x00, 0xf2, 0x14, 0x80,
+0xd7, 0x20, 0x07, 0x00, 0xe4, 0x02, 0x26, 0x10, 0xe2, 0x01, 0xc2, 0x0a, 0x09, 0x81, 0x80, 0x15,
+0x04, 0x02, 0xdf, 0x45, 0x00, 0xf0, 0x28, 0x40, 0xf8, 0x01, 0x1f, 0x50, 0x28, 0x40, 0xf5, 0x01,
+0x87, 0x00, 0xfa, 0x00, 0x00, 0x96, 0x00, 0x60, 0x05, 0x21, 0x07, 0x02, 0xc3, 0x0b, 0xa4, 0x00,
+0x60, 0x42, 0x10, 0xc1, 0x20, 0x10, 0x83, 0xc2, 0x00, 0x20, 0x01, 0x02, 0x3a, 0x02, 0x02, 0x1a,
+0x01, 0x02, 0xa4, 0x00, 0xf0, 0x01, 0x81, 0x20, 0x01, 0x83, 0x42, 0x10, 0xc2, 0x20, 0x06, 0x86,
+0xdf, 0x10, 0x3c, 0x40, 0x9f, 0x10, 0x86, 0x02, 0x22, 0x86, 0x28, 0x46, 0x00, 0x24, 0x07, 0x02,
+0xd8, 0x01, 0xe0, 0x30, 0x8a, 0x40, 0x40, 0x87, 0x00, 0xd7, 0x20, 0x03, 0x00, 0x06, 0x02, 0xc0,
+0x15, 0x7c, 0x04, 0x50, 0x3a, 0x40, 0x10, 0x8a, 0x42, 0x68, 0x01, 0x01, 0xe8, 0x02, 0x53, 0xdf,
+0x17, 0x30, 0x40, 0x2a, 0x08, 0x01, 0x60, 0x03, 0x03, 0xdf, 0x17, 0x3c, 0x40, 0xfa, 0x00, 0x20,
+0x02, 0x90, 0x6c, 0x00, 0xf0, 0x0d, 0x2c, 0x03, 0xd7, 0x20, 0x14, 0x00, 0x01, 0x02, 0x03, 0x0a,
+0xd7, 0x20, 0x0a, 0x00, 0x25, 0x82, 0xc0, 0x15, 0x01, 0x00, 0x03, 0x74, 0x97, 0x20, 0x68, 0x00,
+0x03, 0x02, 0xb6, 0x00, 0xf0, 0x01, 0x05, 0x01, 0x97, 0x20, 0x6c, 0x00, 0x19, 0x02, 0x1f, 0x40,
+0x28, 0x40, 0xc3, 0x25, 0x06, 0x00, 0x14, 0x4a, 0xa2, 0x86, 0x28, 0x11, 0x01, 0xc3, 0x25, 0x02,
+0x00, 0x09, 0x02, 0x92, 0x04, 0x60, 0x02, 0x03, 0x1f, 0x0a, 0x02, 0x40, 0xfc, 0x01, 0xb3, 0x05,
+0x01, 0xc3, 0x25, 0x05, 0x00, 0x02, 0x02, 0xdf, 0x09, 0x88, 0xe4, 0x02, 0x80, 0xdf, 0x10, 0x90,
+0xe2, 0x5f, 0x00, 0x70, 0x2a, 0x6c, 0x00, 0x62, 0xdf, 0x90, 0x30, 0x2b, 0x0e, 0x01, 0x0a, 0x00,
+0x22, 0x3f, 0x2b, 0x08, 0x00, 0xf2, 0x07, 0x37, 0x2b, 0xdf, 0x90, 0x3b, 0x2b, 0xdf, 0x90, 0x3d,
+0x2b, 0xdf, 0x90, 0x3e, 0x2b, 0xc0, 0x15, 0x2c, 0x2b, 0xc8, 0x15, 0x12, 0x00, 0xba, 0x66, 0x00,
+0xd6, 0x02, 0x50, 0x01, 0x00, 0x1f, 0x78, 0x2e, 0x4c, 0x02, 0xf3, 0x18, 0x09, 0xe4, 0x2a, 0xc3,
+0x25, 0x09, 0x00, 0x26, 0x02, 0xc3, 0x15, 0xe9, 0x22, 0xc0, 0x15, 0x30, 0x00, 0x01, 0x10, 0xc2,
+0x17, 0x28, 0x40, 0xc2, 0x35, 0x00, 0x20, 0x01, 0x03, 0x80, 0x0a, 0x13, 0x90, 0x40, 0x10, 0xc2,
+0x0b, 0x01, 0x80, 0x0a, 0x00, 0x00, 0xfc, 0x57, 0x04, 0x16, 0x00, 0x25, 0x35, 0x80, 0x0c, 0x00,
+0x42, 0xdf, 0x0b, 0x2e, 0x40, 0x2e, 0x00, 0xf2, 0x14, 0xc3, 0x15, 0xe7, 0x22, 0x25, 0x01, 0xc3,
+0xe5, 0x06, 0x00, 0x0a, 0x03, 0x83, 0x0a, 0x23, 0x02, 0xc3, 0x15, 0x0e, 0x40, 0xd3, 0x95, 0x30,
+0x00, 0xd3, 0x95, 0x6e, 0x00, 0x13, 0x8a, 0x16, 0x01, 0xc2, 0x15, 0x0e, 0xae, 0x03, 0x01, 0x3e,
+0x02, 0xf0, 0x04, 0x03, 0x03, 0xc1, 0x67, 0x3c, 0x40, 0xc1, 0x0a, 0xdf, 0x09, 0xf8, 0x29, 0xd2,
+0x95, 0x3b, 0x00, 0xc1, 0x17, 0x2c, 0x10, 0x04, 0xf0, 0x00, 0x29, 0xd2, 0x95, 0x52, 0x00, 0x12,
+0x8a, 0xc3, 0x15, 0x0c, 0x40, 0xdf, 0x10, 0x48, 0xf8, 0xb2, 0x00, 0xf2, 0x0b, 0x26, 0x0a, 0x00,
+0x0a, 0x17, 0x72, 0x0a, 0x00, 0xc1, 0x65, 0x30, 0x00, 0x66, 0x10, 0x01, 0x10, 0xf8, 0x02, 0x80,
+0x15, 0x02, 0x03, 0x12, 0x90, 0xfc, 0x01, 0xb6, 0x01, 0x62, 0xfc, 0x02, 0xc3, 0x15, 0xdb, 0x22,
+0x38, 0x01, 0x81, 0xe5, 0x02, 0xc3, 0x15, 0xe3, 0x22, 0xe2, 0x01, 0x3e, 0x01, 0x16, 0x55, 0x1e,
+0x05, 0x20, 0x87, 0x00, 0xfe, 0x04, 0x62, 0x17, 0xa0, 0x40, 0x00, 0x03, 0x82, 0x1c, 0x05, 0xf1,
+0x17, 0x87, 0x00, 0xe6, 0x17, 0x28, 0x40, 0xdf, 0x55, 0x00, 0xa0, 0x28, 0x40, 0xc2, 0x15, 0x3c,
+0x00, 0xc3, 0x15, 0xf0, 0x22, 0xdf, 0x09, 0xc4, 0x2a, 0x97, 0x0a, 0x00, 0x00, 0xfd, 0x02, 0x9f,
+0x15, 0x28, 0x40, 0x01, 0x0a, 0x02, 0x0a, 0x82, 0x03, 0x01, 0x4c, 0x05, 0x08, 0x2e, 0x00, 0x53,
+0x01, 0x00, 0xc3, 0x15, 0xae, 0x72, 0x00, 0x60, 0x07, 0x02, 0xc3, 0x15, 0xa0, 0x22, 0x68, 0x05,
+0x51, 0x02, 0x03, 0xc3, 0x15, 0xbc, 0x44, 0x00, 0x33, 0xc3, 0x15, 0xca, 0x08, 0x00, 0x20, 0x06,
+0x02, 0x54, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x80, 0x00, 0x80, 0x87, 0x00, 0x01, 0x0a, 0x00, 0x0a,
+0xc0, 0xd4, 0x6a, 0x3e, 0xf0, 0x53, 0x8e, 0x20, 0x82, 0x0a, 0xf9, 0x01, 0x87, 0x00, 0xd2, 0x0b,
+0x43, 0x94, 0x03, 0x81, 0x03, 0xa0, 0xfb, 0x02, 0x87, 0x12, 0x87, 0x00, 0x03, 0x0a, 0xe6, 0x15,
+0xff, 0xff, 0x05, 0x21, 0x09, 0x03, 0x40, 0x99, 0xc0, 0xe5, 0x30, 0x00, 0x05, 0x05, 0x17, 0x20,
+0x09, 0x00, 0x02, 0x06, 0x26, 0x10, 0xf5, 0x01, 0x80, 0x15, 0x04, 0x81, 0xd7, 0x70, 0x0a, 0x00,
+0x03, 0x60, 0xfa, 0x01, 0xc3, 0x0b, 0x87, 0x00, 0x74, 0xff, 0xbf, 0xff, 0x80, 0x00, 0x00, 0x05,
+0x30, 0x00, 0x34, 0x00, 0x80, 0x00, 0x76, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xec, 0x2b,
+0xff, 0xff, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x40, 0x3f, 0x2d, 0x12, 0x00, 0x33, 0x31, 0x50, 0x02,
+0x00, 0x02, 0x02, 0xff, 0x7e, 0x52, 0x02, 0x14, 0x00, 0xf5, 0x02, 0x28, 0x00, 0x24, 0x01, 0x03,
+0x00, 0x17, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x58, 0x08, 0xf5, 0x02,
+0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+0x20, 0xa7, 0x61, 0xc0, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+0x60, 0x60, 0xf1, 0x37, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0xee, 0xd0, 0xd1, 0xe6, 0xd4, 0xd5,
+0xe4, 0xd3, 0xe5, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xef, 0xe0, 0xe1, 0xe2, 0xe3,
+0xd6, 0xd2, 0xec, 0xeb, 0xd7, 0xe8, 0xed, 0xe9, 0xe7, 0xea, 0xce, 0xb0, 0xb1, 0xc6, 0xb4, 0xb5,
+0xc4, 0xb3, 0xc5, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0xcf, 0xc0, 0xc1, 0xc2, 0xc3,
+0xb6, 0xb2, 0xcc, 0xcb, 0xb7, 0xc8, 0xcd, 0xc9, 0xc7, 0xca, 0xa2, 0x00, 0x07, 0x02, 0x00, 0x04,
+0xb2, 0x4c, 0xf0, 0x0b, 0xdf, 0x15, 0xbc, 0x2d, 0xba, 0x2d, 0xc0, 0x17, 0x76, 0xcf, 0x1f, 0x0a,
+0x76, 0xcf, 0xc0, 0x35, 0x00, 0xff, 0x03, 0x02, 0x1f, 0x10, 0xbc, 0x2d, 0x26, 0x01, 0x28, 0x55,
+0x4e, 0xdf, 0x15, 0xd4, 0x2b, 0xbc, 0x4c, 0x40, 0x1f, 0x1c, 0xd4, 0x2b, 0xbe, 0x3b, 0x20, 0xd6,
+0x2b, 0xbe, 0x3b, 0xf2, 0x37, 0xbc, 0x2d, 0xc3, 0x15, 0x80, 0x00, 0x40, 0x94, 0x08, 0x03, 0x02,
+0x06, 0x03, 0xa0, 0x09, 0x03, 0x12, 0x90, 0x86, 0x20, 0xf8, 0x87, 0x22, 0x8a, 0x05, 0x01, 0xd2,
+0x95, 0x0a, 0x00, 0xd2, 0x95, 0x0d, 0x00, 0x12, 0x8a, 0xdf, 0x17, 0x04, 0x40, 0x98, 0xe2, 0xdf,
+0x17, 0x06, 0x40, 0x9a, 0xe2, 0x00, 0x0a, 0xc0, 0xdf, 0x56, 0x01, 0x07, 0x03, 0xdf, 0x09, 0xc0,
+0x23, 0x9f, 0x0a, 0xba, 0x2d, 0xc6, 0x27, 0xba, 0x2d, 0xf5, 0x87, 0x42, 0x36, 0x60, 0xdf, 0x17,
+0x8a, 0xe2, 0x9a, 0xe2, 0xf6, 0x04, 0xf0, 0x0b, 0x74, 0xcf, 0xae, 0x03, 0xc5, 0x15, 0x6e, 0x80,
+0xdf, 0x55, 0x08, 0x00, 0x1e, 0x80, 0x40, 0x13, 0xa7, 0x02, 0xc0, 0x17, 0x66, 0x80, 0x0d, 0x10,
+0x35, 0x1c, 0x5c, 0x01, 0xf0, 0x05, 0x78, 0x11, 0x02, 0x00, 0x70, 0x11, 0x02, 0x00, 0x9c, 0x01,
+0xc0, 0x97, 0x3f, 0x2b, 0xc1, 0x97, 0x37, 0x2b, 0x1f, 0x90, 0x04, 0x00, 0xdd, 0x3b, 0x2b, 0x1f,
+0x90, 0x3d, 0x2b, 0x1f, 0x90, 0x3e, 0x2b, 0x5f, 0x90, 0x3f, 0x92, 0x03, 0xff, 0x1f, 0xc5, 0x15,
+0x1c, 0x41, 0xc4, 0x15, 0xe2, 0x40, 0xe6, 0x15, 0x19, 0x00, 0xc2, 0x17, 0x94, 0xe2, 0xc2, 0xe5,
+0x40, 0x00, 0xc2, 0x57, 0x2e, 0x2b, 0xc0, 0x15, 0x54, 0x00, 0x03, 0x15, 0xd5, 0x10, 0xc1, 0x10,
+0xc1, 0x45, 0xff, 0x0f, 0xc1, 0x00, 0x81, 0x60, 0x55, 0x10, 0x03, 0x60, 0x10, 0x00, 0x7d, 0xf5,
+0x0c, 0xce, 0x0a, 0xad, 0x02, 0xd6, 0x0b, 0xc0, 0x15, 0x40, 0x41, 0x01, 0x10, 0x15, 0x14, 0x15,
+0x14, 0x55, 0x14, 0x55, 0x14, 0xc0, 0x15, 0x14, 0x41, 0xc8, 0x15, 0x00, 0x74, 0x04, 0xb1, 0x07,
+0x0a, 0xc6, 0x15, 0x00, 0x40, 0xdf, 0x15, 0x00, 0x30, 0x6a, 0xdc, 0x01, 0x11, 0x08, 0x48, 0x50,
+0xf0, 0x01, 0xc1, 0x15, 0x94, 0xe2, 0x11, 0x10, 0xc5, 0x15, 0x00, 0x40, 0xd5, 0x15, 0x00, 0x00,
+0x15, 0x0a, 0x02, 0x6a, 0x02, 0x08, 0x6a, 0x42, 0x11, 0x10, 0x15, 0x10, 0x0e, 0x00, 0xf3, 0x66,
+0x15, 0x10, 0x11, 0x0a, 0xc5, 0x15, 0x18, 0x41, 0xd5, 0x15, 0xfc, 0x00, 0xcd, 0x15, 0x54, 0x00,
+0xc5, 0x15, 0xe2, 0x40, 0xc3, 0x15, 0x0c, 0x45, 0xc0, 0x15, 0x19, 0x00, 0xd5, 0x10, 0xc3, 0x65,
+0x48, 0x03, 0x04, 0x7e, 0xc1, 0x15, 0xda, 0x2e, 0x5f, 0x10, 0x86, 0xf8, 0xa0, 0x00, 0x42, 0x10,
+0x83, 0x14, 0x43, 0x0a, 0xfd, 0x03, 0xc4, 0x15, 0xba, 0x2e, 0x03, 0x35, 0xfe, 0x03, 0x22, 0x59,
+0x5f, 0x10, 0x84, 0xf8, 0xa0, 0x00, 0xc0, 0x17, 0x90, 0xe2, 0xc0, 0x65, 0x10, 0x00, 0xdf, 0x15,
+0x01, 0x00, 0x7c, 0xf8, 0xa0, 0x00, 0x00, 0x0a, 0xc1, 0x15, 0x00, 0x01, 0xc2, 0x15, 0x14, 0x02,
+0x90, 0x10, 0xc2, 0x67, 0x00, 0x02, 0x44, 0x7e, 0xc0, 0x15, 0xda, 0x2e, 0xc8, 0x15, 0x1a, 0x00,
+0xf0, 0x17, 0x90, 0xe2, 0x02, 0x2c, 0x05, 0x91, 0x1f, 0x0a, 0x2a, 0x2b, 0xdf, 0x15, 0x10, 0x2b,
+0x70, 0xb4, 0x00, 0x11, 0x1e, 0x08, 0x00, 0x02, 0x4e, 0x05, 0x13, 0x0e, 0x22, 0x00, 0x00, 0x5a,
+0x0c, 0xa4, 0xdf, 0x17, 0x16, 0x41, 0x44, 0x2b, 0xc0, 0x15, 0x40, 0x2b, 0x14, 0x00, 0x28, 0x9c,
+0x26, 0x36, 0x02, 0xf0, 0x00, 0x5f, 0x00, 0xe4, 0x2b, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00,
+0x10, 0x00, 0x08, 0x00, 0x85, 0x03, 0x1b, 0x01, 0x0f, 0x00, 0x9f, 0x00, 0x1a, 0x00, 0xa0, 0x00,
+0xff, 0x01, 0xfe, 0xff, 0x01, 0x00, 0x05, 0x07, 0x21, 0x03, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0x00,
+0x11, 0x02, 0x00, 0x00, 0x58, 0x00, 0xd0, 0x2a, 0xba, 0x2a, 0x84, 0x00, 0xfa, 0x26, 0xaa, 0xd6,
+0x45, 0xb4, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20,
+0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x06, 0x00, 0x00, 0x82, 0xeb, 0x20, 0x0f,
+0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xac, 0x84, 0xa4, 0x2d, 0x04, 0x20, 0x80, 0x2d, 0x24, 0x2d, 0x07, 0xc0,
+0xf0, 0x05, 0x2b, 0x01, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x16, 0x29, 0x00, 0x01, 0x00, 0x00,
+0x10, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x00, 0x20, 0x00, 0x60, 0x28, 0x29, 0x00, 0x00,
+0x6c, 0x20, 0x06, 0x00, 0x06, 0x02, 0x00, 0x26, 0x6c, 0x20, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x0f,
+0x10, 0x00, 0x05, 0x00, 0x18, 0x00, 0x55, 0x18, 0x20, 0x38, 0x2d, 0x94, 0x6a, 0x00, 0x0f, 0x02,
+0x00, 0x5f, 0x5f, 0x0e, 0x29, 0x2c, 0x29, 0x48, 0x80, 0x00, 0x68, 0x30, 0x00, 0x00, 0xff, 0x05,
+0x00, 0x0f, 0x02, 0x00, 0x02, 0x0f, 0x1a, 0x00, 0x18, 0x14, 0x04, 0x01, 0x00, 0x0d, 0x34, 0x00,
+0x04, 0x19, 0x00, 0x0f, 0x1a, 0x00, 0x19, 0x05, 0x02, 0x00, 0x0d, 0x34, 0x00, 0x05, 0x02, 0x00,
+0x0f, 0x1a, 0x00, 0x3e, 0x1f, 0x02, 0x01, 0x00, 0x01, 0x01, 0x68, 0x00, 0x0f, 0x19, 0x00, 0x01,
+0x0f, 0x1a, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x0f, 0x02, 0x00, 0x04, 0x0f, 0xce,
+0x06, 0x08, 0xf6, 0x00, 0xff, 0x0e, 0x29, 0x01, 0x00, 0x01, 0x00, 0x34, 0x00, 0x04, 0x02, 0x80,
+0x00, 0x87, 0x81, 0x41, 0x00, 0x50, 0x80, 0x02, 0x2c, 0x20, 0xa0, 0x0c, 0x09, 0xf1, 0xff, 0xff,
+0xff, 0xe0, 0x00, 0xfc, 0x00, 0x54, 0x00, 0x0c, 0x05, 0x90, 0x42, 0x60, 0x05, 0x90, 0x42, 0xb4,
+0x05, 0x90, 0x42, 0x08, 0x06, 0x90, 0x42, 0x5c, 0x06, 0x90, 0x42, 0xb0, 0x06, 0x90, 0x42, 0x04,
+0x07, 0x90, 0x42, 0x58, 0x07, 0x90, 0x42, 0xac, 0x07, 0x90, 0x42, 0x00, 0x08, 0x90, 0x42, 0x54,
+0x08, 0x90, 0x42, 0xa8, 0x08, 0x90, 0x42, 0xfc, 0x08, 0x90, 0x42, 0x50, 0x09, 0x90, 0x42, 0xa4,
+0x09, 0x90, 0x42, 0xf8, 0x09, 0x90, 0x42, 0x4c, 0x0a, 0x90, 0x42, 0xa0, 0x0a, 0x90, 0x42, 0xf4,
+0x0a, 0x90, 0x42, 0x48, 0x0b, 0x90, 0x42, 0x9c, 0x0b, 0x90, 0x42, 0xf0, 0x0b, 0x90, 0x42, 0x44,
+0x0c, 0x90, 0x42, 0x98, 0x0c, 0x90, 0x42, 0xec, 0x0c, 0x90, 0x42, 0x40, 0x0d, 0x90, 0x42, 0x94,
+0x0d, 0x90, 0x42, 0xe8, 0x0d, 0x90, 0x42, 0x3c, 0x0e, 0x90, 0x42, 0x90, 0x0e, 0x90, 0x42, 0xe4,
+0x0e, 0x90, 0x42, 0x38, 0x0f, 0x90, 0x42, 0x8c, 0x0f, 0x90, 0x42, 0xe0, 0x0f, 0x90, 0x42, 0x34,
+0x00, 0xa0, 0x42, 0x88, 0x00, 0xa0, 0x42, 0xdc, 0x00, 0xa0, 0x42, 0x30, 0x01, 0xa0, 0x42, 0x84,
+0x01, 0xa0, 0x42, 0xd8, 0x01, 0xa0, 0x42, 0x2c, 0x02, 0xa0, 0x42, 0x80, 0x02, 0xa0, 0x42, 0xd4,
+0x02, 0xa0, 0x42, 0x28, 0x03, 0xa0, 0x42, 0x7c, 0x03, 0xa0, 0x42, 0xd0, 0x03, 0xa0, 0x42, 0x24,
+0x04, 0xa0, 0x42, 0x78, 0x04, 0xa0, 0x42, 0xcc, 0x04, 0xa0, 0x42, 0x20, 0x05, 0xa0, 0x42, 0x74,
+0x05, 0xa0, 0x42, 0xc8, 0x05, 0xa0, 0x42, 0x1c, 0x06, 0xa0, 0x42, 0x70, 0x06, 0xa0, 0x42, 0xc4,
+0x06, 0xa0, 0x42, 0x18, 0x07, 0xa0, 0x42, 0x6c, 0x07, 0xa0, 0x42, 0xc0, 0x07, 0xa0, 0x42, 0x14,
+0x08, 0xa0, 0x42, 0x68, 0x08, 0xa0, 0x42, 0xbc, 0x08, 0xa0, 0x42, 0x10, 0x09, 0xa0, 0x42, 0x64,
+0x09, 0xa0, 0x42, 0xb8, 0x09, 0xa0, 0x42, 0x0c, 0x0a, 0xa0, 0x42, 0x60, 0x0a, 0xa0, 0x42, 0xb4,
+0x0a, 0xa0, 0x42, 0x08, 0x0b, 0xa0, 0x42, 0x5c, 0x0b, 0xa0, 0x42, 0xb0, 0x0b, 0xa0, 0x42, 0x04,
+0x0c, 0xa0, 0x42, 0x58, 0x0c, 0xa0, 0x42, 0xac, 0x0c, 0xa0, 0x42, 0x00, 0x0d, 0xa0, 0x42, 0x54,
+0x0d, 0xa0, 0x42, 0xa8, 0x0d, 0xa0, 0x42, 0xfc, 0x0d, 0xa0, 0x42, 0x50, 0x0e, 0xa0, 0x42, 0xa4,
+0x0e, 0xa0, 0x42, 0xf8, 0x0e, 0xa0, 0x42, 0x4c, 0x0f, 0xa0, 0x42, 0xa0, 0x0f, 0xa0, 0x42, 0xf4,
+0x0f, 0xa0, 0x42, 0x48, 0x00, 0xb0, 0x42, 0x9c, 0x00, 0xb0, 0x42, 0xf0, 0x00, 0xb0, 0x42, 0x44,
+0x01, 0xb0, 0x42, 0x98, 0x01, 0xb0, 0x42, 0xec, 0x01, 0xb0, 0x42, 0x40, 0x02, 0xb0, 0x42, 0x94,
+0x02, 0xb0, 0x42, 0xe8, 0x02, 0xb0, 0x42, 0x3c, 0x03, 0xb0, 0x42, 0x90, 0x03, 0xb0, 0x42, 0xe4,
+0x03, 0xb0, 0x42, 0x38, 0x04, 0xb0, 0x42, 0x8c, 0x04, 0xb0, 0x42, 0xe0, 0x04, 0xb0, 0x42, 0x34,
+0x05, 0xb0, 0x42, 0x88, 0x05, 0xb0, 0x42, 0xdc, 0x05, 0xb0, 0x42, 0x30, 0x06, 0xb0, 0x42, 0x84,
+0x06, 0xb0, 0x42, 0xd8, 0x06, 0xb0, 0x42, 0x2c, 0x07, 0xb0, 0x42, 0x80, 0x07, 0xb0, 0x42, 0xd4,
+0x07, 0xb0, 0x42, 0x28, 0x08, 0xb0, 0x42, 0x7c, 0x08, 0xb0, 0x42, 0xd0, 0x08, 0xb0, 0x42, 0x24,
+0x09, 0xb0, 0x42, 0x78, 0x09, 0xb0, 0x42, 0xcc, 0x09, 0xb0, 0x42, 0x20, 0x0a, 0xb0, 0x42, 0x74,
+0x0a, 0xb0, 0x42, 0xc8, 0x0a, 0xb0, 0x42, 0x1c, 0x0b, 0xb0, 0x42, 0x70, 0x0b, 0xb0, 0x42, 0xc4,
+0x0b, 0xb0, 0x42, 0x18, 0x0c, 0xb0, 0x42, 0x6c, 0x0c, 0xb0, 0x42, 0xc0, 0x0c, 0xb0, 0x42, 0x14,
+0x0d, 0xb0, 0x42, 0x68, 0x0d, 0xb0, 0x42, 0xbc, 0x0d, 0xb0, 0x42, 0x10, 0x0e, 0xb0, 0x42, 0x64,
+0x0e, 0xb0, 0x42, 0xb8, 0x0e, 0xb0, 0x42, 0x0c, 0x0f, 0xb0, 0x42, 0x60, 0x0f, 0xb0, 0x42, 0xb4,
+0x0f, 0xb0, 0x42, 0x08, 0x00, 0xc0, 0x42, 0x5c, 0x00, 0xc0, 0x42, 0xb0, 0x00, 0xc0, 0x42, 0x04,
+0x01, 0xc0, 0x42, 0x58, 0x01, 0xc0, 0x42, 0xac, 0x01, 0xc0, 0x42, 0x00, 0x02, 0xc0, 0x42, 0x54,
+0x02, 0xc0, 0x42, 0xa8, 0x02, 0xc0, 0x42, 0xfc, 0x02, 0xc0, 0x42, 0x50, 0x03, 0xc0, 0x42, 0xa4,
+0x03, 0xc0, 0x42, 0xf8, 0x03, 0xc0, 0x42, 0x4c, 0x04, 0xc0, 0x42, 0xa0, 0x04, 0xc0, 0x42, 0xf4,
+0x04, 0xc0, 0x42, 0x48, 0x05, 0xc0, 0x42, 0x9c, 0x05, 0xc0, 0x42, 0xf0, 0x05, 0xc0, 0x42, 0x44,
+0x06, 0xc0, 0x42, 0x98, 0x06, 0xc0, 0x42, 0xec, 0x06, 0xc0, 0x42, 0x40, 0x07, 0xc0, 0x42, 0x94,
+0x07, 0xc0, 0x42, 0xe8, 0x07, 0xc0, 0x42, 0x3c, 0x08, 0xc0, 0x42, 0x90, 0x08, 0xc0, 0x42, 0xe4,
+0x08, 0xc0, 0x42, 0x38, 0x09, 0xc0, 0x42, 0x8c, 0x09, 0xc0, 0x42, 0xe0, 0x09, 0xc0, 0x42, 0x34,
+0x0a, 0xc0, 0x42, 0x88, 0x0a, 0xc0, 0x42, 0xdc, 0x0a, 0xc0, 0x42, 0x30, 0x0b, 0xc0, 0x42, 0x84,
+0x0b, 0xc0, 0x42, 0xd8, 0x0b, 0xc0, 0x42, 0x2c, 0x0c, 0xc0, 0x42, 0x80, 0x0c, 0xc0, 0x42, 0xd4,
+0x0c, 0xc0, 0x42, 0x28, 0x0d, 0xc0, 0x42, 0x7c, 0x0d, 0xc0, 0x42, 0xd0, 0x0d, 0xc0, 0x42, 0x24,
+0x0e, 0xc0, 0x42, 0x78, 0x0e, 0xc0, 0x42, 0xcc, 0x0e, 0xc0, 0x42, 0x20, 0x0f, 0xc0, 0x42, 0x74,
+0x0f, 0xc0, 0x42, 0xc8, 0x0f, 0xc0, 0x42, 0x1c, 0x00, 0xd0, 0x42, 0x70, 0x00, 0xd0, 0x42, 0xc4,
+0x00, 0xd0, 0x42, 0x18, 0x01, 0xd0, 0x42, 0x6c, 0x01, 0xd0, 0x42, 0xc0, 0x01, 0xd0, 0x42, 0x14,
+0x02, 0xd0, 0x42, 0x68, 0x02, 0xd0, 0x42, 0xbc, 0x02, 0xd0, 0x42, 0x10, 0x03, 0xd0, 0x42, 0x64,
+0x03, 0xd0, 0x42, 0xb8, 0x03, 0xd0, 0x42, 0x0c, 0x04, 0xd0, 0x42, 0x60, 0x04, 0xd0, 0x42, 0xb4,
+0x04, 0xd0, 0x42, 0x08, 0x05, 0xd0, 0x42, 0x5c, 0x05, 0xd0, 0x42, 0xb0, 0x05, 0xd0, 0x42, 0x04,
+0x06, 0xd0, 0x42, 0x58, 0x06, 0xd0, 0x42, 0xac, 0x06, 0xd0, 0x42, 0x00, 0x07, 0xd0, 0x42, 0x54,
+0x07, 0xd0, 0x42, 0xa8, 0x07, 0xd0, 0x42, 0xfc, 0x07, 0xd0, 0x42, 0x50, 0x08, 0xd0, 0x42, 0xa4,
+0x08, 0xd0, 0x42, 0xf8, 0x08, 0xd0, 0x42, 0x4c, 0x09, 0xd0, 0x42, 0xa0, 0x09, 0xd0, 0x42, 0xf4,
+0x09, 0xd0, 0x42, 0x48, 0x0a, 0xd0, 0x42, 0x9c, 0x0a, 0xd0, 0x42, 0xf0, 0x0a, 0xd0, 0x42, 0x44,
+0x0b, 0xd0, 0x42, 0x98, 0x0b, 0xd0, 0x42, 0xec, 0x0b, 0xd0, 0x42, 0x40, 0x0c, 0xd0, 0x42, 0x94,
+0x0c, 0xd0, 0x42, 0xe8, 0x0c, 0xd0, 0x42, 0x3c, 0x0d, 0xd0, 0x42, 0x90, 0x0d, 0xd0, 0x42, 0xe4,
+0x0d, 0xd0, 0x42, 0x38, 0x0e, 0xd0, 0x42, 0x8c, 0x0e, 0xd0, 0x42, 0xe0, 0x0e, 0xd0, 0x42, 0x34,
+0x0f, 0xd0, 0x42, 0x88, 0x0f, 0xd0, 0x42, 0xdc, 0x0f, 0xd0, 0x42, 0x30, 0x00, 0xe0, 0x42, 0x84,
+0x00, 0xe0, 0x42, 0xd8, 0x00, 0xe0, 0x42, 0x2c, 0x01, 0xe0, 0x42, 0x80, 0x01, 0xe0, 0x42, 0xd4,
+0x01, 0xe0, 0x42, 0x28, 0x02, 0xe0, 0x42, 0x7c, 0x02, 0xe0, 0x42, 0xd0, 0x02, 0xe0, 0x42, 0x24,
+0x03, 0xe0, 0x42, 0x78, 0x03, 0xe0, 0x42, 0xcc, 0x03, 0xe0, 0x42, 0x20, 0x04, 0xe0, 0x42, 0x74,
+0x04, 0xe0, 0x42, 0xc8, 0x04, 0xe0, 0x42, 0x1c, 0x05, 0xe0, 0x42, 0x70, 0x05, 0xe0, 0x42, 0xc4,
+0x05, 0xe0, 0x42, 0x18, 0x06, 0xe0, 0x42, 0x6c, 0x06, 0xe0, 0x42, 0xc0, 0x06, 0xe0, 0xc4, 0x03,
+0x00, 0xc8, 0x03, 0x00, 0x22, 0x0d, 0x11, 0x02, 0x0d, 0x04, 0xf1, 0x04, 0x28, 0x00, 0x23, 0x01,
+0x03, 0x00, 0x17, 0x00, 0x01, 0x02, 0x34, 0x29, 0x01, 0x02, 0x06, 0x00, 0x02, 0x02, 0x28, 0x18,
+0x00, 0x00, 0x02, 0x00, 0x91, 0x0c, 0x00, 0x0c, 0x00, 0x28, 0x00, 0x68, 0x06, 0x00, 0x04, 0x00,
+0x93, 0x00, 0x05, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x50, 0x04, 0x00, 0x93, 0x78, 0x05, 0x00,
+0x00, 0xa0, 0x05, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x22, 0xf0, 0x05, 0x28, 0x00, 0x50, 0x24, 0x2d,
+0x04, 0x20, 0x04, 0x3f, 0x00, 0x60, 0x00, 0x08, 0x00, 0x13, 0x00, 0x11, 0x7c, 0x0d, 0xa1, 0x02,
+0x50, 0x2d, 0x01, 0x02, 0x22, 0x00, 0x02, 0x04, 0x08, 0x18, 0x00, 0x0f, 0x02, 0x00, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0x78, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x02, 0x00, 0x01, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x91, 0x11, 0x00, 0x00, 0xda, 0xaa, 0xfd, 0x7d, 0x40, 0x80, 0x20, 0x00,
+0x00, 0x04, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x88, 0x81, 0x00, 0x00, 0xa2, 0x81, 0x00,
+0x00, 0xbc, 0x81, 0x00, 0x00, 0xd6, 0x81, 0x00, 0x00, 0xf0, 0x81, 0x00, 0x00, 0x0a, 0x82, 0x00,
+0x00, 0x24, 0x82, 0x00, 0x00, 0x3e, 0x82, 0x00, 0x00, 0x58, 0x82, 0x00, 0x00, 0x72, 0x82, 0x00,
+0x00, 0x8c, 0x82, 0x00, 0x00, 0xa6, 0x82, 0x00, 0x00, 0xc0, 0x82, 0x00, 0x00, 0xda, 0x82, 0x00,
+0x00, 0xf4, 0x82, 0x00, 0x00, 0x0e, 0x83, 0x00, 0x00, 0x28, 0x83, 0x00, 0x00, 0x42, 0x83, 0x00,
+0x00, 0x5c, 0x83, 0x00, 0x00, 0x76, 0x83, 0x00, 0x00, 0x90, 0x83, 0x00, 0x00, 0xaa, 0x83, 0x00,
+0x00, 0xc4, 0x83, 0x00, 0x00, 0xde, 0x83, 0x00, 0x00, 0xf8, 0x83, 0x00, 0x00, 0x12, 0x84, 0x00,
+0x00, 0x2c, 0x84, 0x00, 0x00, 0x46, 0x84, 0x00, 0x00, 0x60, 0x84, 0x00, 0x00, 0x7a, 0x84, 0x00,
+0x00, 0x94, 0x84, 0x00, 0x00, 0xae, 0x84, 0x00, 0x00, 0xc8, 0x84, 0x00, 0x00, 0xe2, 0x84, 0x00,
+0x00, 0xfc, 0x84, 0x00, 0x00, 0x16, 0x85, 0x00, 0x00, 0x30, 0x85, 0x00, 0x00, 0x4a, 0x85, 0x00,
+0x00, 0x64, 0x85, 0x00, 0x00, 0x7e, 0x85, 0x00, 0x00, 0x98, 0x85, 0x00, 0x00, 0xb2, 0x85, 0x00,
+0x00, 0xcc, 0x85, 0x00, 0x00, 0xe6, 0x85, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x1a, 0x86, 0x00,
+0x00, 0x34, 0x86, 0x00, 0x00, 0x4e, 0x86, 0x00, 0x00, 0x68, 0x86, 0x00, 0x00, 0x82, 0x86, 0x00,
+0x00, 0x9c, 0x86, 0x00, 0x00, 0xb6, 0x86, 0x00, 0x00, 0xd0, 0x86, 0x00, 0x00, 0xea, 0x86, 0x00,
+0x00, 0x04, 0x87, 0x00, 0x00, 0x1e, 0x87, 0x00, 0x00, 0x38, 0x87, 0x00, 0x00, 0x52, 0x87, 0x00,
+0x00, 0x6c, 0x87, 0x00, 0x00, 0x86, 0x87, 0x00, 0x00, 0xa0, 0x87, 0x00, 0x00, 0xba, 0x87, 0x00,
+0x00, 0xd4, 0x87, 0x00, 0x00, 0xee, 0x87, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x22, 0x88, 0x00,
+0x00, 0x3c, 0x88, 0x00, 0x00, 0x56, 0x88, 0x00, 0x00, 0x70, 0x88, 0x00, 0x00, 0x8a, 0x88, 0x00,
+0x00, 0xa4, 0x88, 0x00, 0x00, 0xbe, 0x88, 0x00, 0x00, 0xd8, 0x88, 0x00, 0x00, 0xf2, 0x88, 0x00,
+0x00, 0x0c, 0x89, 0x00, 0x00, 0x26, 0x89, 0x00, 0x00, 0x40, 0x89, 0x00, 0x00, 0x5a, 0x89, 0x00,
+0x00, 0x74, 0x89, 0x00, 0x00, 0x8e, 0x89, 0x00, 0x00, 0xa8, 0x89, 0x00, 0x00, 0xc2, 0x89, 0x00,
+0x00, 0xdc, 0x89, 0x00, 0x00, 0xf6, 0x89, 0x00, 0x00, 0x10, 0x8a, 0x00, 0x00, 0x2a, 0x8a, 0x00,
+0x00, 0x44, 0x8a, 0x00, 0x00, 0x5e, 0x8a, 0x00, 0x00, 0x78, 0x8a, 0x00, 0x00, 0x92, 0x8a, 0x00,
+0x00, 0xac, 0x8a, 0x00, 0x00, 0xc6, 0x8a, 0x00, 0x00, 0xe0, 0x8a, 0x00, 0x00, 0xfa, 0x8a, 0x00,
+0x00, 0x14, 0x8b, 0x00, 0x00, 0x2e, 0x8b, 0x00, 0x00, 0x48, 0x8b, 0x00, 0x00, 0x62, 0x8b, 0x00,
+0x00, 0x7c, 0x8b, 0x00, 0x00, 0x96, 0x8b, 0x00, 0x00, 0xb0, 0x8b, 0x00, 0x00, 0xca, 0x8b, 0x00,
+0x00, 0xe4, 0x8b, 0x00, 0x00, 0xfe, 0x8b, 0x00, 0x00, 0x18, 0x8c, 0x00, 0x00, 0x32, 0x8c, 0x00,
+0x00, 0x4c, 0x8c, 0x00, 0x00, 0x66, 0x8c, 0x00, 0x00, 0x80, 0x8c, 0x00, 0x00, 0x9a, 0x8c, 0x00,
+0x00, 0xb4, 0x8c, 0x00, 0x00, 0xce, 0x8c, 0x00, 0x00, 0xe8, 0x8c, 0x00, 0x00, 0x02, 0x8d, 0x00,
+0x00, 0x1c, 0x8d, 0x00, 0x00, 0x36, 0x8d, 0x00, 0x00, 0x50, 0x8d, 0x00, 0x00, 0x6a, 0x8d, 0x00,
+0x00, 0x84, 0x8d, 0x00, 0x00, 0x9e, 0x8d, 0x00, 0x00, 0xb8, 0x8d, 0x00, 0x00, 0xd2, 0x8d, 0x00,
+0x00, 0xec, 0x8d, 0x00, 0x00, 0x06, 0x8e, 0x00, 0x00, 0x20, 0x8e, 0x00, 0x00, 0x3a, 0x8e, 0x00,
+0x00, 0x54, 0x8e, 0x00, 0x00, 0x6e, 0x8e, 0x00, 0x00, 0x88, 0x8e, 0x00, 0x00, 0xa2, 0x8e, 0x00,
+0x00, 0xbc, 0x8e, 0x00, 0x00, 0xd6, 0x8e, 0x00, 0x00, 0xf0, 0x8e, 0x00, 0x00, 0x0a, 0x8f, 0x00,
+0x00, 0x24, 0x8f, 0x00, 0x00, 0x3e, 0x8f, 0x00, 0x00, 0x58, 0x8f, 0x00, 0x00, 0x72, 0x8f, 0x00,
+0x00, 0x8c, 0x8f, 0x00, 0x00, 0xa6, 0x8f, 0x00, 0x00, 0xc0, 0x8f, 0x00, 0x00, 0xda, 0x8f, 0x00,
+0x00, 0xf4, 0x8f, 0x00, 0x00, 0x0e, 0x90, 0x00, 0x00, 0x28, 0x90, 0x00, 0x00, 0x42, 0x90, 0x00,
+0x00, 0x5c, 0x90, 0x00, 0x00, 0x76, 0x90, 0x00, 0x00, 0x90, 0x90, 0x00, 0x00, 0xaa, 0x90, 0x00,
+0x00, 0xc4, 0x90, 0x00, 0x00, 0xde, 0x90, 0x00, 0x00, 0xf8, 0x90, 0x00, 0x00, 0x12, 0x91, 0x00,
+0x00, 0x2c, 0x91, 0x00, 0x00, 0x46, 0x91, 0x00, 0x00, 0x60, 0x91, 0x00, 0x00, 0x7a, 0x91, 0x00,
+0x00, 0x94, 0x91, 0x00, 0x00, 0xae, 0x91, 0x00, 0x00, 0xc8, 0x91, 0x00, 0x00, 0xe2, 0x91, 0x00,
+0x00, 0xfc, 0x91, 0x00, 0x00, 0x16, 0x92, 0x00, 0x00, 0x30, 0x92, 0x00, 0x00, 0x4a, 0x92, 0x00,
+0x00, 0x64, 0x92, 0x00, 0x00, 0x7e, 0x92, 0x00, 0x00, 0x98, 0x92, 0x00, 0x00, 0xb2, 0x92, 0x00,
+0x00, 0xcc, 0x92, 0x00, 0x00, 0xe6, 0x92, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x1a, 0x93, 0x00,
+0x00, 0x34, 0x93, 0x00, 0x00, 0x4e, 0x93, 0x00, 0x00, 0x68, 0x93, 0x00, 0x00, 0x82, 0x93, 0x00,
+0x00, 0x9c, 0x93, 0x00, 0x00, 0xb6, 0x93, 0x00, 0x00, 0xd0, 0x93, 0x00, 0x00, 0xea, 0x93, 0x00,
+0x00, 0x04, 0x94, 0x00, 0x00, 0x1e, 0x94, 0x00, 0x00, 0x38, 0x94, 0x00, 0x00, 0x52, 0x94, 0x00,
+0x00, 0x6c, 0x94, 0x00, 0x00, 0x86, 0x94, 0x00, 0x00, 0xa0, 0x94, 0x00, 0x00, 0xba, 0x94, 0x00,
+0x00, 0xd4, 0x94, 0x00, 0x00, 0xee, 0x94, 0x00, 0x00, 0x08, 0x95, 0x00, 0x00, 0x22, 0x95, 0x00,
+0x00, 0x3c, 0x95, 0x00, 0x00, 0x56, 0x95, 0x00, 0x00, 0x70, 0x95, 0x00, 0x00, 0x8a, 0x95, 0x00,
+0x00, 0xa4, 0x95, 0x00, 0x00, 0xbe, 0x95, 0x00, 0x00, 0xd8, 0x95, 0x00, 0x00, 0xf2, 0x95, 0x00,
+0x00, 0x0c, 0x96, 0x00, 0x00, 0x26, 0x96, 0x00, 0x00, 0x40, 0x96, 0x00, 0x00, 0x5a, 0x96, 0x00,
+0x00, 0x74, 0x96, 0x00, 0x00, 0x8e, 0x96, 0x00, 0x00, 0xa8, 0x96, 0x00, 0x00, 0xc2, 0x96, 0x00,
+0x00, 0xdc, 0x96, 0x00, 0x00, 0xf6, 0x96, 0x00, 0x00, 0x10, 0x97, 0x00, 0x00, 0x2a, 0x97, 0x00,
+0x00, 0x44, 0x97, 0x00, 0x00, 0x5e, 0x97, 0x00, 0x00, 0x78, 0x97, 0x00, 0x00, 0x92, 0x97, 0x00,
+0x00, 0xac, 0x97, 0x00, 0x00, 0xc6, 0x97, 0x00, 0x00, 0xe0, 0x97, 0x00, 0x00, 0xfa, 0x97, 0x00,
+0x00, 0x14, 0x98, 0x00, 0x00, 0x2e, 0x98, 0x00, 0x00, 0x48, 0x98, 0x00, 0x00, 0x62, 0x98, 0x00,
+0x00, 0x7c, 0x98, 0x00, 0x00, 0x96, 0x98, 0x00, 0x00, 0xb0, 0x98, 0x00, 0x00, 0xca, 0x98, 0x00,
+0x00, 0xe4, 0x98, 0x00, 0x00, 0xfe, 0x98, 0x00, 0x00, 0x18, 0x99, 0x00, 0x00, 0x32, 0x99, 0x00,
+0x00, 0x4c, 0x99, 0x00, 0x00, 0x66, 0x99, 0x00, 0x00, 0x80, 0x99, 0x00, 0x00, 0x9a, 0x99, 0x00,
+0x00, 0xb4, 0x99, 0x00, 0x00, 0xce, 0x99, 0x00, 0x00, 0xe8, 0x99, 0x00, 0x00, 0x02, 0x9a, 0x00,
+0x00, 0x1c, 0x9a, 0x00, 0x00, 0x36, 0x9a, 0x00, 0x00, 0x50, 0x9a, 0x00, 0x00, 0x6a, 0x9a, 0x00,
+0x00, 0x84, 0x9a, 0x00, 0x00, 0x9e, 0x9a, 0x00, 0x00, 0xb8, 0x9a, 0x00, 0x00, 0xd2, 0x9a, 0x00,
+0x00, 0xec, 0x9a, 0x00, 0x00, 0x06, 0x9b, 0x00, 0x00, 0x20, 0x9b, 0x00, 0x00, 0x3a, 0x9b, 0x00,
+0x00, 0x54, 0x9b, 0x00, 0x00, 0x6e, 0x9b, 0x00, 0x00, 0x88, 0x9b, 0x00, 0x00, 0xa2, 0x9b, 0x00,
+0x00, 0xbc, 0x9b, 0x00, 0x00, 0xd6, 0x9b, 0x00, 0x00, 0xf0, 0x9b, 0x00, 0x00, 0x0a, 0x9c, 0x00,
+0x00, 0x24, 0x9c, 0x00, 0x00, 0x3e, 0x9c, 0x00, 0x00, 0x58, 0x9c, 0x00, 0x00, 0x72, 0x9c, 0x00,
+0x00, 0x8c, 0x9c, 0x00, 0x00, 0xa6, 0x9c, 0x00, 0x00, 0xc0, 0x9c, 0x00, 0x00, 0xda, 0x9c, 0x00,
+0x00, 0xf4, 0x9c, 0x00, 0x00, 0x0e, 0x9d, 0x00, 0x00, 0x28, 0x9d, 0x00, 0x00, 0x42, 0x9d, 0x00,
+0x00, 0x5c, 0x9d, 0x00, 0x00, 0x76, 0x9d, 0x00, 0x00, 0x90, 0x9d, 0x00, 0x00, 0xaa, 0x9d, 0x00,
+0x00, 0xc4, 0x9d, 0x00, 0x00, 0xde, 0x9d, 0x00, 0x00, 0xf8, 0x9d, 0x00, 0x00, 0x12, 0x9e, 0x00,
+0x00, 0x2c, 0x9e, 0x00, 0x00, 0x46, 0x9e, 0x00, 0x00, 0x60, 0x9e, 0x00, 0x00, 0x7a, 0x9e, 0x00,
+0x00, 0x94, 0x9e, 0x00, 0x00, 0xae, 0x9e, 0x00, 0x00, 0xc8, 0x9e, 0x00, 0x00, 0xe2, 0x9e, 0x00,
+0x00, 0xfc, 0x9e, 0x00, 0x00, 0x16, 0x9f, 0x00, 0x00, 0x30, 0x9f, 0x00, 0x00, 0x4a, 0x9f, 0x00,
+0x00, 0x64, 0x9f, 0x00, 0x00, 0x7e, 0x9f, 0x00, 0x00, 0x98, 0x9f, 0x00, 0x00, 0xb2, 0x9f, 0x00,
+0x00, 0xcc, 0x9f, 0x00, 0x00, 0xe6, 0x9f, 0x00, 0x00, 0xb8, 0x04, 0x00, 0xbc, 0x04, 0x0f, 0x04,
+0x00, 0xff, 0x46, 0x8f, 0x8e, 0x20, 0x00, 0x01, 0x81, 0x20, 0x00, 0x01, 0x60, 0x01, 0x11, 0x0f,
+0x02, 0x00, 0x2d, 0x00, 0x68, 0x00, 0x0f, 0x44, 0x00, 0x2d, 0x0f, 0x02, 0x00, 0x11, 0x0f, 0x68,
+0x00, 0xff, 0xff, 0x62, 0x2f, 0x3d, 0x96, 0xdc, 0x02, 0x50, 0x8f, 0x81, 0x20, 0x00, 0x3d, 0x9a,
+0x01, 0x00, 0x02, 0x04, 0x03, 0x11, 0x0f, 0x02, 0x00, 0x29, 0x00, 0x68, 0x00, 0x1f, 0x40, 0x68,
+0x00, 0x54, 0x1f, 0x4a, 0x68, 0x00, 0x54, 0x1f, 0x54, 0x68, 0x00, 0xbc, 0x1f, 0x5e, 0xd0, 0x00,
+0x54, 0x1f, 0x68, 0x68, 0x00, 0x54, 0x1f, 0x72, 0x68, 0x00, 0xbc, 0x1f, 0x7c, 0xd0, 0x00, 0x54,
+0x0f, 0x78, 0x04, 0x54, 0x1f, 0x01, 0x50, 0x04, 0x29, 0x0f, 0x02, 0x00, 0x15, 0x0f, 0xb8, 0x07,
+0xff, 0xff, 0x62, 0x0f, 0xd8, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x6f, 0x75, 0x43, 0xa5,
+0x10, 0x2e, 0x8d, 0x50, 0x05, 0x4c, 0x5f, 0x81, 0x20, 0x00, 0x75, 0x58, 0x68, 0x00, 0x54, 0x1f,
+0x6d, 0x68, 0x00, 0x54, 0x1f, 0x82, 0x68, 0x00, 0x54, 0x1f, 0x97, 0x68, 0x00, 0x54, 0x1f, 0xac,
+0x68, 0x00, 0x54, 0x1f, 0xc1, 0x68, 0x00, 0x54, 0x1f, 0xd6, 0x68, 0x00, 0x54, 0x1f, 0xeb, 0x68,
+0x00, 0x54, 0x2f, 0x00, 0xa6, 0xa8, 0x03, 0x53, 0x1f, 0x15, 0x68, 0x00, 0x54, 0x1f, 0x2a, 0x68,
+0x00, 0x54, 0x1f, 0x3f, 0x68, 0x00, 0x54, 0x1f, 0x54, 0x68, 0x00, 0x54, 0x1f, 0x69, 0x68, 0x00,
+0x54, 0x1f, 0x7e, 0x68, 0x00, 0x54, 0x1f, 0x93, 0x68, 0x00, 0x54, 0x1f, 0xa8, 0x68, 0x00, 0x54,
+0x1f, 0xbd, 0x68, 0x00, 0x54, 0x1f, 0xd2, 0x68, 0x00, 0x54, 0x1f, 0xe7, 0x68, 0x00, 0x54, 0x1f,
+0xfc, 0x68, 0x00, 0x54, 0x2f, 0x11, 0xa7, 0x48, 0x05, 0x53, 0x1f, 0x26, 0x68, 0x00, 0x54, 0x1f,
+0x3b, 0x68, 0x00, 0x54, 0x1f, 0x50, 0x68, 0x00, 0x54, 0x1f, 0x65, 0x68, 0x00, 0x54, 0x1f, 0x7a,
+0x68, 0x00, 0x54, 0x1f, 0x8f, 0x68, 0x00, 0x54, 0x1f, 0xa4, 0x68, 0x00, 0x54, 0x1f, 0xb9, 0x68,
+0x00, 0x54, 0x1f, 0xce, 0x68, 0x00, 0x54, 0x1f, 0xe3, 0x68, 0x00, 0x54, 0x1f, 0xf8, 0x68, 0x00,
+0x54, 0x2f, 0x0d, 0xa8, 0xe0, 0x04, 0x53, 0x1f, 0x22, 0x68, 0x00, 0x54, 0x1f, 0x37, 0x68, 0x00,
+0x54, 0x1f, 0x4c, 0x68, 0x00, 0x54, 0x1f, 0x61, 0x68, 0x00, 0x54, 0x1f, 0x76, 0x68, 0x00, 0x54,
+0x1f, 0x8b, 0x68, 0x00, 0x54, 0x1f, 0xa0, 0x68, 0x00, 0x54, 0x1f, 0xb5, 0x68, 0x00, 0x54, 0x1f,
+0xca, 0x68, 0x00, 0x54, 0x1f, 0xdf, 0x68, 0x00, 0x54, 0x1f, 0xf4, 0x68, 0x00, 0x54, 0x2f, 0x09,
+0xa9, 0xe0, 0x04, 0x53, 0x1f, 0x1e, 0x68, 0x00, 0x54, 0x1f, 0x33, 0x68, 0x00, 0x54, 0x1f, 0x48,
+0x68, 0x00, 0x54, 0x1f, 0x5d, 0x68, 0x00, 0x54, 0x1f, 0x72, 0x68, 0x00, 0x54, 0x1f, 0x87, 0x68,
+0x00, 0x54, 0x1f, 0x9c, 0x68, 0x00, 0x54, 0x1f, 0xb1, 0x68, 0x00, 0x54, 0x1f, 0xc6, 0x68, 0x00,
+0x54, 0x1f, 0xdb, 0x68, 0x00, 0x54, 0x1f, 0xf0, 0x68, 0x00, 0x54, 0x2f, 0x05, 0xaa, 0xe0, 0x04,
+0x53, 0x1f, 0x1a, 0x68, 0x00, 0x54, 0x1f, 0x2f, 0x68, 0x00, 0x54, 0x1f, 0x44, 0x68, 0x00, 0x54,
+0x1f, 0x59, 0x68, 0x00, 0x54, 0x1f, 0x6e, 0x68, 0x00, 0x54, 0x1f, 0x83, 0x68, 0x00, 0x54, 0x1f,
+0x98, 0x68, 0x00, 0x54, 0x1f, 0xad, 0x68, 0x00, 0x54, 0x1f, 0xc2, 0x68, 0x00, 0x54, 0x1f, 0xd7,
+0x68, 0x00, 0x54, 0x1f, 0xec, 0x68, 0x00, 0x54, 0x2f, 0x01, 0xab, 0xe0, 0x04, 0x53, 0x1f, 0x16,
+0x68, 0x00, 0x54, 0x1f, 0x2b, 0x68, 0x00, 0x54, 0x1f, 0x40, 0x68, 0x00, 0x54, 0x1f, 0x55, 0x68,
+0x00, 0x54, 0x1f, 0x6a, 0x68, 0x00, 0x54, 0x1f, 0x7f, 0x68, 0x00, 0x54, 0x1f, 0x94, 0x68, 0x00,
+0x54, 0x1f, 0xa9, 0x68, 0x00, 0x54, 0x1f, 0xbe, 0x68, 0x00, 0x54, 0x1f, 0xd3, 0x68, 0x00, 0x54,
+0x1f, 0xe8, 0x68, 0x00, 0x54, 0x1f, 0xfd, 0x68, 0x00, 0x54, 0x2f, 0x12, 0xac, 0x48, 0x05, 0x53,
+0x1f, 0x27, 0x68, 0x00, 0x54, 0x1f, 0x3c, 0x68, 0x00, 0x54, 0x1f, 0x51, 0x68, 0x00, 0x54, 0x1f,
+0x66, 0x68, 0x00, 0x54, 0x1f, 0x7b, 0x68, 0x00, 0x54, 0x1f, 0x90, 0x68, 0x00, 0x54, 0x1f, 0xa5,
+0x68, 0x00, 0x54, 0x1f, 0xba, 0x68, 0x00, 0x54, 0x1f, 0xcf, 0x68, 0x00, 0x54, 0x1f, 0xe4, 0x68,
+0x00, 0x54, 0x1f, 0xf9, 0x68, 0x00, 0x54, 0x2f, 0x0e, 0xad, 0xe0, 0x04, 0x53, 0x1f, 0x23, 0x68,
+0x00, 0x54, 0x1f, 0x38, 0x68, 0x00, 0x54, 0x1f, 0x4d, 0x68, 0x00, 0x54, 0x1f, 0x62, 0x68, 0x00,
+0x54, 0x1f, 0x77, 0x68, 0x00, 0x54, 0x1f, 0x8c, 0x68, 0x00, 0x54, 0x1f, 0xa1, 0x68, 0x00, 0x54,
+0x1f, 0xb6, 0x68, 0x00, 0x54, 0x1f, 0xcb, 0x68, 0x00, 0x54, 0x1f, 0xe0, 0x68, 0x00, 0x54, 0x1f,
+0xf5, 0x68, 0x00, 0x54, 0x2f, 0x0a, 0xae, 0xe0, 0x04, 0x53, 0x1f, 0x1f, 0x68, 0x00, 0x54, 0x1f,
+0x34, 0x68, 0x00, 0x54, 0x1f, 0x49, 0x68, 0x00, 0x54, 0x1f, 0x5e, 0x68, 0x00, 0x54, 0x1f, 0x73,
+0x68, 0x00, 0x54, 0x1f, 0x88, 0x68, 0x00, 0x54, 0x1f, 0x9d, 0x68, 0x00, 0x54, 0x1f, 0xb2, 0x68,
+0x00, 0x54, 0x1f, 0xc7, 0x68, 0x00, 0x54, 0x1f, 0xdc, 0x68, 0x00, 0x54, 0x1f, 0xf1, 0x68, 0x00,
+0x54, 0x2f, 0x06, 0xaf, 0xe0, 0x04, 0x53, 0x1f, 0x1b, 0x68, 0x00, 0x54, 0x1f, 0x30, 0x68, 0x00,
+0x54, 0x1f, 0x45, 0x68, 0x00, 0x54, 0x1f, 0x5a, 0x68, 0x00, 0x54, 0x1f, 0x6f, 0x68, 0x00, 0x54,
+0x1f, 0x84, 0x68, 0x00, 0x54, 0x1f, 0x99, 0x68, 0x00, 0x54, 0x1f, 0xae, 0x68, 0x00, 0x54, 0x1f,
+0xc3, 0x68, 0x00, 0x54, 0x1f, 0xd8, 0x68, 0x00, 0x54, 0x1f, 0xed, 0x68, 0x00, 0x54, 0x2f, 0x02,
+0xb0, 0xe0, 0x04, 0x53, 0x1f, 0x17, 0x68, 0x00, 0x54, 0x1f, 0x2c, 0x68, 0x00, 0x54, 0x1f, 0x41,
+0x68, 0x00, 0x54, 0x1f, 0x56, 0x68, 0x00, 0x54, 0x1f, 0x6b, 0x68, 0x00, 0x54, 0x1f, 0x80, 0x68,
+0x00, 0x54, 0x1f, 0x95, 0x68, 0x00, 0x54, 0x1f, 0xaa, 0x68, 0x00, 0x54, 0x1f, 0xbf, 0x68, 0x00,
+0x54, 0x1f, 0xd4, 0x68, 0x00, 0x54, 0x1f, 0xe9, 0x68, 0x00, 0x54, 0x1f, 0xfe, 0x68, 0x00, 0x54,
+0x2f, 0x13, 0xb1, 0x48, 0x05, 0x53, 0x1f, 0x28, 0x68, 0x00, 0x54, 0x1f, 0x3d, 0x68, 0x00, 0x54,
+0x1f, 0x52, 0x68, 0x00, 0x54, 0x1f, 0x67, 0x68, 0x00, 0x54, 0x1f, 0x7c, 0x68, 0x00, 0x54, 0x1f,
+0x91, 0x68, 0x00, 0x54, 0x1f, 0xa6, 0x68, 0x00, 0x54, 0x1f, 0xbb, 0x68, 0x00, 0x54, 0x1f, 0xd0,
+0x68, 0x00, 0x54, 0x1f, 0xe5, 0x68, 0x00, 0x54, 0x1f, 0xfa, 0x68, 0x00, 0x54, 0x2f, 0x0f, 0xb2,
+0xe0, 0x04, 0x53, 0x1f, 0x24, 0x68, 0x00, 0x54, 0x1f, 0x39, 0x68, 0x00, 0x54, 0x1f, 0x4e, 0x68,
+0x00, 0x54, 0x1f, 0x63, 0x68, 0x00, 0x54, 0x1f, 0x78, 0x68, 0x00, 0x54, 0x1f, 0x8d, 0x68, 0x00,
+0x54, 0x1f, 0xa2, 0x68, 0x00, 0x54, 0x1f, 0xb7, 0x68, 0x00, 0x54, 0x1f, 0xcc, 0x68, 0x00, 0x54,
+0x1f, 0xe1, 0x68, 0x00, 0x54, 0x1f, 0xf6, 0x68, 0x00, 0x54, 0x2f, 0x0b, 0xb3, 0xe0, 0x04, 0x53,
+0x1f, 0x20, 0x68, 0x00, 0x54, 0x1f, 0x35, 0x68, 0x00, 0x54, 0x1f, 0x4a, 0x68, 0x00, 0x54, 0x1f,
+0x5f, 0x68, 0x00, 0x54, 0x1f, 0x74, 0x68, 0x00, 0x54, 0x1f, 0x89, 0x68, 0x00, 0x54, 0x1f, 0x9e,
+0x68, 0x00, 0x54, 0x1f, 0xb3, 0x68, 0x00, 0x54, 0x1f, 0xc8, 0x68, 0x00, 0x54, 0x1f, 0xdd, 0x68,
+0x00, 0x54, 0x1f, 0xf2, 0x68, 0x00, 0x54, 0x2f, 0x07, 0xb4, 0xe0, 0x04, 0x53, 0x1f, 0x1c, 0x68,
+0x00, 0x54, 0x1f, 0x31, 0x68, 0x00, 0x54, 0x1f, 0x46, 0x68, 0x00, 0x54, 0x1f, 0x5b, 0x68, 0x00,
+0x54, 0x1f, 0x70, 0x68, 0x00, 0x54, 0x1f, 0x85, 0x68, 0x00, 0x54, 0x1f, 0x9a, 0x68, 0x00, 0x54,
+0x1f, 0xaf, 0x68, 0x00, 0x54, 0x1f, 0xc4, 0x68, 0x00, 0x54, 0x1f, 0xd9, 0x68, 0x00, 0x54, 0x1f,
+0xee, 0x68, 0x00, 0x54, 0x2f, 0x03, 0xb5, 0xe0, 0x04, 0x53, 0x1f, 0x18, 0x68, 0x00, 0x54, 0x1f,
+0x2d, 0x68, 0x00, 0x54, 0x1f, 0x42, 0x68, 0x00, 0x54, 0x1f, 0x57, 0x68, 0x00, 0x54, 0x1f, 0x6c,
+0x68, 0x00, 0x54, 0x1f, 0x81, 0x68, 0x00, 0x54, 0x1f, 0x96, 0x68, 0x00, 0x54, 0x1f, 0xab, 0x68,
+0x00, 0x54, 0x1f, 0xc0, 0x68, 0x00, 0x54, 0x1f, 0xd5, 0x68, 0x00, 0x54, 0x1f, 0xea, 0x68, 0x00,
+0x54, 0x1f, 0xff, 0x68, 0x00, 0x54, 0x2f, 0x14, 0xb6, 0x48, 0x05, 0x53, 0x1f, 0x29, 0x68, 0x00,
+0x54, 0x1f, 0x3e, 0x68, 0x00, 0x54, 0x1f, 0x53, 0x68, 0x00, 0x54, 0x1f, 0x68, 0x68, 0x00, 0x54,
+0x1f, 0x7d, 0x68, 0x00, 0x54, 0x1f, 0x92, 0x68, 0x00, 0x54, 0x1f, 0xa7, 0x68, 0x00, 0x54, 0x1f,
+0xbc, 0x68, 0x00, 0x54, 0x1f, 0xd1, 0x68, 0x00, 0x54, 0x1f, 0xe6, 0x68, 0x00, 0x54, 0x1f, 0xfb,
+0x68, 0x00, 0x54, 0x2f, 0x10, 0xb7, 0xe0, 0x04, 0x53, 0x1f, 0x25, 0x68, 0x00, 0x54, 0x1f, 0x3a,
+0x68, 0x00, 0x54, 0x1f, 0x4f, 0x68, 0x00, 0x54, 0x1f, 0x64, 0x68, 0x00, 0x54, 0x1f, 0x79, 0x68,
+0x00, 0x54, 0x1f, 0x8e, 0x68, 0x00, 0x54, 0x1f, 0xa3, 0x68, 0x00, 0x54, 0x1f, 0xb8, 0x68, 0x00,
+0x54, 0x1f, 0xcd, 0x68, 0x00, 0x54, 0x1f, 0xe2, 0x68, 0x00, 0x54, 0x1f, 0xf7, 0x68, 0x00, 0x54,
+0x2f, 0x0c, 0xb8, 0xe0, 0x04, 0x53, 0x1f, 0x21, 0x68, 0x00, 0x54, 0x1f, 0x36, 0x68, 0x00, 0x54,
+0x1f, 0x4b, 0x68, 0x00, 0x54, 0x1f, 0x60, 0x68, 0x00, 0x54, 0x1f, 0x75, 0x68, 0x00, 0x54, 0x1f,
+0x8a, 0x68, 0x00, 0x54, 0x1f, 0x9f, 0x68, 0x00, 0x54, 0x1f, 0xb4, 0x68, 0x00, 0x54, 0x1f, 0xc9,
+0x68, 0x00, 0x54, 0x1f, 0xde, 0x68, 0x00, 0x54, 0x1f, 0xf3, 0x68, 0x00, 0x54, 0x2f, 0x08, 0xb9,
+0xe0, 0x04, 0x53, 0x1f, 0x1d, 0x68, 0x00, 0x54, 0x1f, 0x32, 0x68, 0x00, 0x54, 0x1f, 0x47, 0x68,
+0x00, 0x54, 0x1f, 0x5c, 0x68, 0x00, 0x54, 0x1f, 0x71, 0x68, 0x00, 0x54, 0x1f, 0x86, 0x68, 0x00,
+0x54, 0x1f, 0x9b, 0x68, 0x00, 0x54, 0x1f, 0xb0, 0x68, 0x00, 0x54, 0x0f, 0xe8, 0x61, 0x55, 0x0f,
+0x68, 0x00, 0x54, 0x0f, 0xa8, 0x6b, 0xff, 0xff, 0xff, 0x2d, 0x0b, 0x02, 0x00, 0x13, 0xaa, 0x41,
+0x76, 0x00, 0x07, 0x00, 0x5b, 0x02, 0x00, 0x02, 0x02, 0xff, 0x20, 0x00, 0x0f, 0x02, 0x00, 0x01,
+0xdf, 0x49, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x18, 0x49, 0xfa, 0x18, 0xfe, 0x21, 0x00,
+0x01, 0x0f, 0x02, 0x00, 0x0a, 0xef, 0x51, 0x1c, 0x9c, 0x89, 0xa0, 0xf0, 0x77, 0x03, 0xa3, 0xdc,
+0x1f, 0x5e, 0xf3, 0x92, 0x70, 0x00, 0x11, 0x0a, 0x02, 0x00, 0x0f, 0x40, 0x00, 0x2d, 0x0f, 0x02,
+0x00, 0xff, 0xff, 0xef, 0xff, 0xef, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a,
+0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a,
+0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a,
+0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
+0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a,
+0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba,
+0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca,
+0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+0xeb, 0xec, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa,
+0xfb, 0xfc, 0xfd, 0xfe, 0x70, 0x04, 0x1f, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xca, 0x30, 0xd0, 0x02, 0xf0, 0xf0, 0x0f, 0x2f, 0x00, 0x1b, 0xdc, 0x0a,
+0x08, 0x31, 0x84, 0x00, 0x01, 0xc5, 0x86, 0xb1, 0x01, 0x00, 0x18, 0x00, 0x18, 0x00, 0x01, 0x00,
+0x50, 0x00, 0x50, 0x0c, 0x00, 0x04, 0x41, 0x0b, 0x0f, 0x08, 0x00, 0x85, 0xf0, 0x25, 0x00, 0x00,
+0x0c, 0x45, 0x54, 0x48, 0x9c, 0x4b, 0xe4, 0x4e, 0x2c, 0x52, 0x74, 0x55, 0xbc, 0x58, 0x04, 0x5c,
+0x4c, 0x5f, 0x94, 0x62, 0xdc, 0x65, 0x24, 0x69, 0x6c, 0x6c, 0xb4, 0x6f, 0xfc, 0x72, 0x44, 0x76,
+0x8c, 0x79, 0xd4, 0x7c, 0x1c, 0x80, 0x64, 0x83, 0xac, 0x86, 0xf4, 0x89, 0x3c, 0x8d, 0x84, 0x90,
+0xcc, 0x93, 0xfb, 0x10, 0xf1, 0xff, 0xff, 0xff, 0xdf, 0xfc, 0x00, 0x54, 0x00, 0x0c, 0x45, 0x90,
+0x42, 0x60, 0x45, 0x90, 0x42, 0xb4, 0x45, 0x90, 0x42, 0x08, 0x46, 0x90, 0x42, 0x5c, 0x46, 0x90,
+0x42, 0xb0, 0x46, 0x90, 0x42, 0x04, 0x47, 0x90, 0x42, 0x58, 0x47, 0x90, 0x42, 0xac, 0x47, 0x90,
+0x42, 0x00, 0x48, 0x90, 0x42, 0x54, 0x48, 0x90, 0x42, 0xa8, 0x48, 0x90, 0x42, 0xfc, 0x48, 0x90,
+0x42, 0x50, 0x49, 0x90, 0x42, 0xa4, 0x49, 0x90, 0x42, 0xf8, 0x49, 0x90, 0x42, 0x4c, 0x4a, 0x90,
+0x42, 0xa0, 0x4a, 0x90, 0x42, 0xf4, 0x4a, 0x90, 0x42, 0x48, 0x4b, 0x90, 0x42, 0x9c, 0x4b, 0x90,
+0x42, 0xf0, 0x4b, 0x90, 0x42, 0x44, 0x4c, 0x90, 0x42, 0x98, 0x4c, 0x90, 0x42, 0xec, 0x4c, 0x90,
+0x42, 0x40, 0x4d, 0x90, 0x42, 0x94, 0x4d, 0x90, 0x42, 0xe8, 0x4d, 0x90, 0x42, 0x3c, 0x4e, 0x90,
+0x42, 0x90, 0x4e, 0x90, 0x42, 0xe4, 0x4e, 0x90, 0x42, 0x38, 0x4f, 0x90, 0x42, 0x8c, 0x4f, 0x90,
+0x42, 0xe0, 0x4f, 0x90, 0x42, 0x34, 0x50, 0xa0, 0x42, 0x88, 0x50, 0xa0, 0x42, 0xdc, 0x50, 0xa0,
+0x42, 0x30, 0x51, 0xa0, 0x42, 0x84, 0x51, 0xa0, 0x42, 0xd8, 0x51, 0xa0, 0x42, 0x2c, 0x52, 0xa0,
+0x42, 0x80, 0x52, 0xa0, 0x42, 0xd4, 0x52, 0xa0, 0x42, 0x28, 0x53, 0xa0, 0x42, 0x7c, 0x53, 0xa0,
+0x42, 0xd0, 0x53, 0xa0, 0x42, 0x24, 0x54, 0xa0, 0x42, 0x78, 0x54, 0xa0, 0x42, 0xcc, 0x54, 0xa0,
+0x42, 0x20, 0x55, 0xa0, 0x42, 0x74, 0x55, 0xa0, 0x42, 0xc8, 0x55, 0xa0, 0x42, 0x1c, 0x56, 0xa0,
+0x42, 0x70, 0x56, 0xa0, 0x42, 0xc4, 0x56, 0xa0, 0x42, 0x18, 0x57, 0xa0, 0x42, 0x6c, 0x57, 0xa0,
+0x42, 0xc0, 0x57, 0xa0, 0x42, 0x14, 0x58, 0xa0, 0x42, 0x68, 0x58, 0xa0, 0x42, 0xbc, 0x58, 0xa0,
+0x42, 0x10, 0x59, 0xa0, 0x42, 0x64, 0x59, 0xa0, 0x42, 0xb8, 0x59, 0xa0, 0x42, 0x0c, 0x5a, 0xa0,
+0x42, 0x60, 0x5a, 0xa0, 0x42, 0xb4, 0x5a, 0xa0, 0x42, 0x08, 0x5b, 0xa0, 0x42, 0x5c, 0x5b, 0xa0,
+0x42, 0xb0, 0x5b, 0xa0, 0x42, 0x04, 0x5c, 0xa0, 0x42, 0x58, 0x5c, 0xa0, 0x42, 0xac, 0x5c, 0xa0,
+0x42, 0x00, 0x5d, 0xa0, 0x42, 0x54, 0x5d, 0xa0, 0x42, 0xa8, 0x5d, 0xa0, 0x42, 0xfc, 0x5d, 0xa0,
+0x42, 0x50, 0x5e, 0xa0, 0x42, 0xa4, 0x5e, 0xa0, 0x42, 0xf8, 0x5e, 0xa0, 0x42, 0x4c, 0x5f, 0xa0,
+0x42, 0xa0, 0x5f, 0xa0, 0x42, 0xf4, 0x5f, 0xa0, 0x42, 0x48, 0x60, 0xb0, 0x42, 0x9c, 0x60, 0xb0,
+0x42, 0xf0, 0x60, 0xb0, 0x42, 0x44, 0x61, 0xb0, 0x42, 0x98, 0x61, 0xb0, 0x42, 0xec, 0x61, 0xb0,
+0x42, 0x40, 0x62, 0xb0, 0x42, 0x94, 0x62, 0xb0, 0x42, 0xe8, 0x62, 0xb0, 0x42, 0x3c, 0x63, 0xb0,
+0x42, 0x90, 0x63, 0xb0, 0x42, 0xe4, 0x63, 0xb0, 0x42, 0x38, 0x64, 0xb0, 0x42, 0x8c, 0x64, 0xb0,
+0x42, 0xe0, 0x64, 0xb0, 0x42, 0x34, 0x65, 0xb0, 0x42, 0x88, 0x65, 0xb0, 0x42, 0xdc, 0x65, 0xb0,
+0x42, 0x30, 0x66, 0xb0, 0x42, 0x84, 0x66, 0xb0, 0x42, 0xd8, 0x66, 0xb0, 0x42, 0x2c, 0x67, 0xb0,
+0x42, 0x80, 0x67, 0xb0, 0x42, 0xd4, 0x67, 0xb0, 0x42, 0x28, 0x68, 0xb0, 0x42, 0x7c, 0x68, 0xb0,
+0x42, 0xd0, 0x68, 0xb0, 0x42, 0x24, 0x69, 0xb0, 0x42, 0x78, 0x69, 0xb0, 0x42, 0xcc, 0x69, 0xb0,
+0x42, 0x20, 0x6a, 0xb0, 0x42, 0x74, 0x6a, 0xb0, 0x42, 0xc8, 0x6a, 0xb0, 0x42, 0x1c, 0x6b, 0xb0,
+0x42, 0x70, 0x6b, 0xb0, 0x42, 0xc4, 0x6b, 0xb0, 0x42, 0x18, 0x6c, 0xb0, 0x42, 0x6c, 0x6c, 0xb0,
+0x42, 0xc0, 0x6c, 0xb0, 0x42, 0x14, 0x6d, 0xb0, 0x42, 0x68, 0x6d, 0xb0, 0x42, 0xbc, 0x6d, 0xb0,
+0x42, 0x10, 0x6e, 0xb0, 0x42, 0x64, 0x6e, 0xb0, 0x42, 0xb8, 0x6e, 0xb0, 0x42, 0x0c, 0x6f, 0xb0,
+0x42, 0x60, 0x6f, 0xb0, 0x42, 0xb4, 0x6f, 0xb0, 0x42, 0x08, 0x70, 0xc0, 0x42, 0x5c, 0x70, 0xc0,
+0x42, 0xb0, 0x70, 0xc0, 0x42, 0x04, 0x71, 0xc0, 0x42, 0x58, 0x71, 0xc0, 0x42, 0xac, 0x71, 0xc0,
+0x42, 0x00, 0x72, 0xc0, 0x42, 0x54, 0x72, 0xc0, 0x42, 0xa8, 0x72, 0xc0, 0x42, 0xfc, 0x72, 0xc0,
+0x42, 0x50, 0x73, 0xc0, 0x42, 0xa4, 0x73, 0xc0, 0x42, 0xf8, 0x73, 0xc0, 0x42, 0x4c, 0x74, 0xc0,
+0x42, 0xa0, 0x74, 0xc0, 0x42, 0xf4, 0x74, 0xc0, 0x42, 0x48, 0x75, 0xc0, 0x42, 0x9c, 0x75, 0xc0,
+0x42, 0xf0, 0x75, 0xc0, 0x42, 0x44, 0x76, 0xc0, 0x42, 0x98, 0x76, 0xc0, 0x42, 0xec, 0x76, 0xc0,
+0x42, 0x40, 0x77, 0xc0, 0x42, 0x94, 0x77, 0xc0, 0x42, 0xe8, 0x77, 0xc0, 0x42, 0x3c, 0x78, 0xc0,
+0x42, 0x90, 0x78, 0xc0, 0x42, 0xe4, 0x78, 0xc0, 0x42, 0x38, 0x79, 0xc0, 0x42, 0x8c, 0x79, 0xc0,
+0x42, 0xe0, 0x79, 0xc0, 0x42, 0x34, 0x7a, 0xc0, 0x42, 0x88, 0x7a, 0xc0, 0x42, 0xdc, 0x7a, 0xc0,
+0x42, 0x30, 0x7b, 0xc0, 0x42, 0x84, 0x7b, 0xc0, 0x42, 0xd8, 0x7b, 0xc0, 0x42, 0x2c, 0x7c, 0xc0,
+0x42, 0x80, 0x7c, 0xc0, 0x42, 0xd4, 0x7c, 0xc0, 0x42, 0x28, 0x7d, 0xc0, 0x42, 0x7c, 0x7d, 0xc0,
+0x42, 0xd0, 0x7d, 0xc0, 0x42, 0x24, 0x7e, 0xc0, 0x42, 0x78, 0x7e, 0xc0, 0x42, 0xcc, 0x7e, 0xc0,
+0x42, 0x20, 0x7f, 0xc0, 0x42, 0x74, 0x7f, 0xc0, 0x42, 0xc8, 0x7f, 0xc0, 0x42, 0x1c, 0x80, 0xd0,
+0x42, 0x70, 0x80, 0xd0, 0x42, 0xc4, 0x80, 0xd0, 0x42, 0x18, 0x81, 0xd0, 0x42, 0x6c, 0x81, 0xd0,
+0x42, 0xc0, 0x81, 0xd0, 0x42, 0x14, 0x82, 0xd0, 0x42, 0x68, 0x82, 0xd0, 0x42, 0xbc, 0x82, 0xd0,
+0x42, 0x10, 0x83, 0xd0, 0x42, 0x64, 0x83, 0xd0, 0x42, 0xb8, 0x83, 0xd0, 0x42, 0x0c, 0x84, 0xd0,
+0x42, 0x60, 0x84, 0xd0, 0x42, 0xb4, 0x84, 0xd0, 0x42, 0x08, 0x85, 0xd0, 0x42, 0x5c, 0x85, 0xd0,
+0x42, 0xb0, 0x85, 0xd0, 0x42, 0x04, 0x86, 0xd0, 0x42, 0x58, 0x86, 0xd0, 0x42, 0xac, 0x86, 0xd0,
+0x42, 0x00, 0x87, 0xd0, 0x42, 0x54, 0x87, 0xd0, 0x42, 0xa8, 0x87, 0xd0, 0x42, 0xfc, 0x87, 0xd0,
+0x42, 0x50, 0x88, 0xd0, 0x42, 0xa4, 0x88, 0xd0, 0x42, 0xf8, 0x88, 0xd0, 0x42, 0x4c, 0x89, 0xd0,
+0x42, 0xa0, 0x89, 0xd0, 0x42, 0xf4, 0x89, 0xd0, 0x42, 0x48, 0x8a, 0xd0, 0x42, 0x9c, 0x8a, 0xd0,
+0x42, 0xf0, 0x8a, 0xd0, 0x42, 0x44, 0x8b, 0xd0, 0x42, 0x98, 0x8b, 0xd0, 0x42, 0xec, 0x8b, 0xd0,
+0x42, 0x40, 0x8c, 0xd0, 0x42, 0x94, 0x8c, 0xd0, 0x42, 0xe8, 0x8c, 0xd0, 0x42, 0x3c, 0x8d, 0xd0,
+0x42, 0x90, 0x8d, 0xd0, 0x42, 0xe4, 0x8d, 0xd0, 0x42, 0x38, 0x8e, 0xd0, 0x42, 0x8c, 0x8e, 0xd0,
+0x42, 0xe0, 0x8e, 0xd0, 0x42, 0x34, 0x8f, 0xd0, 0x42, 0x88, 0x8f, 0xd0, 0x42, 0xdc, 0x8f, 0xd0,
+0x42, 0x30, 0x90, 0xe0, 0x42, 0x84, 0x90, 0xe0, 0x42, 0xd8, 0x90, 0xe0, 0x42, 0x2c, 0x91, 0xe0,
+0x42, 0x80, 0x91, 0xe0, 0x42, 0xd4, 0x91, 0xe0, 0x42, 0x28, 0x92, 0xe0, 0x42, 0x7c, 0x92, 0xe0,
+0x42, 0xd0, 0x92, 0xe0, 0x42, 0x24, 0x93, 0xe0, 0x42, 0x78, 0x93, 0xe0, 0x42, 0xcc, 0x93, 0xe0,
+0x42, 0x20, 0x94, 0xe0, 0x42, 0x74, 0x94, 0xe0, 0x42, 0xc8, 0x94, 0xe0, 0x42, 0x1c, 0x95, 0xe0,
+0x42, 0x70, 0x95, 0xe0, 0x42, 0xc4, 0x95, 0xe0, 0x42, 0x18, 0x96, 0xe0, 0x42, 0x6c, 0x96, 0xe0,
+0x42, 0xc0, 0x96, 0xe0, 0xc4, 0x03, 0x00, 0x04, 0x00, 0x1f, 0xff, 0x01, 0x00, 0x14, 0x00, 0x56,
+0x04, 0x0f, 0x02, 0x00, 0x15, 0xf1, 0x00, 0x9c, 0xff, 0x81, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xc3,
+0xff, 0xc3, 0xff, 0xff, 0x9c, 0xc3, 0x0e, 0x00, 0xff, 0x05, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf3,
+0xff, 0xff, 0xff, 0xc1, 0xf3, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7, 0xbf, 0x80, 0x9c, 0x50, 0x00,
+0x15, 0x00, 0x02, 0x00, 0xf0, 0x02, 0x9c, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x99, 0xff,
+0x99, 0xff, 0xff, 0x9c, 0x99, 0xff, 0x9d, 0x53, 0x00, 0x20, 0xff, 0xb9, 0x54, 0x00, 0xcf, 0xe7,
+0xff, 0x9c, 0xf3, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xcf, 0x9f, 0xb9, 0x54, 0x00, 0x1a, 0x31, 0xc9,
+0xff, 0xe7, 0xa8, 0x00, 0x01, 0x54, 0x00, 0x41, 0xc9, 0xcf, 0xff, 0x9f, 0x54, 0x00, 0xf0, 0x03,
+0xe9, 0xc3, 0xc4, 0xe1, 0xff, 0xe7, 0xff, 0xf8, 0xe1, 0xe1, 0xc4, 0xc1, 0xe1, 0xc4, 0xc1, 0xcf,
+0xe9, 0xc9, 0x80, 0x00, 0x0f, 0x02, 0x00, 0x15, 0x0a, 0x54, 0x00, 0x10, 0xe7, 0x97, 0x00, 0x62,
+0xff, 0xff, 0xff, 0xe1, 0x99, 0x99, 0xfc, 0x00, 0x9f, 0xcf, 0x99, 0xcc, 0xcf, 0x99, 0xcc, 0xe7,
+0xe1, 0xe3, 0x50, 0x00, 0x15, 0x00, 0x02, 0x00, 0x54, 0xe3, 0xff, 0xe7, 0xff, 0x81, 0xa8, 0x00,
+0x23, 0xe3, 0xf3, 0x54, 0x00, 0x12, 0xe9, 0x54, 0x00, 0x9f, 0x8f, 0xf3, 0xc1, 0x99, 0xcc, 0xc1,
+0xf9, 0xcc, 0xf3, 0xa8, 0x00, 0x1b, 0x00, 0x54, 0x00, 0x00, 0xa4, 0x01, 0x01, 0xfc, 0x00, 0x30,
+0xe3, 0xb9, 0xe7, 0x0e, 0x00, 0xff, 0x04, 0xff, 0xff, 0xf9, 0x99, 0x99, 0x93, 0xff, 0xe7, 0xff,
+0x9c, 0x93, 0xcc, 0x99, 0xcc, 0xcc, 0xf9, 0xcc, 0xf9, 0xf9, 0x50, 0x01, 0x1a, 0x10, 0xf7, 0xf0,
+0x01, 0x22, 0xff, 0x81, 0xf8, 0x01, 0x23, 0xf7, 0x81, 0x54, 0x00, 0xff, 0x02, 0xf0, 0xc3, 0x99,
+0xc7, 0xff, 0xe7, 0xff, 0xc1, 0xc7, 0x91, 0x99, 0x91, 0x91, 0xf0, 0x91, 0xfd, 0xf0, 0x54, 0x00,
+0x1a, 0x00, 0x96, 0x00, 0x0f, 0x02, 0x00, 0x11, 0x00, 0x28, 0x01, 0x0f, 0x02, 0x00, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x0d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x49, 0x4e, 0x44, 0x58, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+0xe2, 0x24, 0x1e, 0x91, 0x42, 0x4f, 0x52, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+0x43, 0x50, 0x55, 0x20, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x48, 0x44, 0x42, 0x46,
+0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x46, 0x44, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00,
+0xf0, 0x00, 0x00, 0x00, 0x52, 0x4f, 0x4d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20,
+0x01, 0x00, 0x00, 0x00, 0x6c, 0x3e, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x02, 0x00, 0x00, 0x00,
+0x98, 0x44, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x03, 0x00, 0x00, 0x00, 0x40, 0x56, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x04, 0x00, 0x00, 0x00, 0x60, 0x57, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20,
+0x05, 0x00, 0x00, 0x00, 0x80, 0x58, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x06, 0x00, 0x00, 0x00,
+0xa0, 0x59, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x5a, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x08, 0x00, 0x00, 0x00, 0xe0, 0x5b, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20,
+0x09, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x0a, 0x00, 0x00, 0x00,
+0x20, 0x5e, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x0b, 0x00, 0x00, 0x00, 0x40, 0x5f, 0x00, 0x00,
+0x52, 0x41, 0x4d, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20,
+0x0d, 0x00, 0x00, 0x00, 0x80, 0x61, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x0e, 0x00, 0x00, 0x00,
+0xa0, 0x62, 0x00, 0x00, 0x52, 0x41, 0x4d, 0x20, 0x0f, 0x00, 0x00, 0x00, 0xc0, 0x63, 0x00, 0x00,
+};
@@ -15,6 +15,9 @@ NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
 #include "Emubase.h"
 #include "Board.h"
 #include <ctime>
+#ifdef EMUBASE_MMAP
+#include <sys/mman.h>
+#endif
 
 void TraceInstruction(const CProcessor* pProc, const CMotherboard* pBoard, uint16_t address);
 
@@ -25,6 +28,30 @@ void TraceInstruction(const CProcessor* pProc, const CMotherboard* pBoard, uint1
 
 //////////////////////////////////////////////////////////////////////
 
+// Board RAM, zeroed. On the POSIX builds it is an anonymous mapping, the system takes the memory for a page
+// on its first write: the board with the chunks pending, see CMotherboard::Clone(), gets it chunk by chunk.
+// The other builds take the whole RAM at once.
+static uint8_t* Board_AllocRAM(uint32_t size)
+{
+#ifdef EMUBASE_MMAP
+    void* pRAM = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return (pRAM != MAP_FAILED) ? static_cast<uint8_t*>(pRAM) : nullptr;
+#else
+    return static_cast<uint8_t*>(::calloc(size, 1));
+#endif
+}
+
+static void Board_FreeRAM(uint8_t* pRAM, uint32_t size)
+{
+#ifdef EMUBASE_MMAP
+    if (pRAM != nullptr)
+        ::munmap(pRAM, size);
+#else
+    (void)size;
+    ::free(pRAM);
+#endif
+}
+
 CMotherboard::CMotherboard()
 {
     // Create devices
@@ -33,8 +60,14 @@ CMotherboard::CMotherboard()
     m_pHardDrive = nullptr;
 
     m_dwTrace = 0;
+    m_CPUbps = nullptr;
+    m_okScratch = false;
+    m_okFastDisk = false;
+    m_ticks = 0;
+    m_soundBrasErr = 0;
     m_SoundGenCallback = nullptr;
     m_SerialOutCallback = nullptr;
+    m_SerialOutParam = nullptr;
     m_ParallelOutCallback = nullptr;
 
     ::memset(m_HR, 0, sizeof(m_HR));
@@ -43,8 +76,17 @@ CMotherboard::CMotherboard()
     // Allocate memory
     m_nRamSizeBytes = 0;
     m_pRAM = nullptr;  // RAM allocation in SetConfiguration() method
-    m_pROM = static_cast<uint8_t*>(::calloc(16 * 1024, 1));
+    m_RAMPendingMask = 0;
+    m_RAMChunkCallback = nullptr;
+    m_RAMChunkParam = nullptr;
+    m_RAMReadChunks = nullptr;
+    m_okRAMLoadFailed = false;
+    SetRAMDirtyMap();
+    m_pROMOwn = static_cast<uint8_t*>(::calloc(16 * 1024, 1));
+    m_pROM = m_pROMOwn;
     m_pHDbuff = static_cast<uint8_t*>(::calloc(4 * 512, 1));
+    m_pDiskCopy = nullptr;
+    m_nDiskCopySize = 0;
 
     m_PPIAwr = m_PPIArd = m_PPIBwr = 0;
     m_PPIBrd = 11;  // IHLT EF1 EF0 - инверсные
@@ -67,6 +109,9 @@ CMotherboard::CMotherboard()
     m_keyint = false;
     m_keypos = 0;
     m_mousest = m_mousedx = m_mousedy = 0;
+    m_rtcfixedtime = 0;
+    m_serialin = 0;
+    m_serialinready = false;
 
     SetConfiguration(0);  // Default configuration
 
@@ -85,9 +130,11 @@ CMotherboard::~CMotherboard()
     delete m_pHardDrive;
 
     // Free memory
-    ::free(m_pRAM);
-    ::free(m_pROM);
+    SetRAMChunkSource(0, nullptr, nullptr);
+    Board_FreeRAM(m_pRAM, m_nRamSizeBytes);
+    ::free(m_pROMOwn);
     ::free(m_pHDbuff);
+    ::free(m_pDiskCopy);
 }
 
 void CMotherboard::SetConfiguration(uint16_t conf)
@@ -95,13 +142,12 @@ void CMotherboard::SetConfiguration(uint16_t conf)
     m_Configuration = conf;
 
     // Allocate RAM; clean RAM/ROM
-    ::free(m_pRAM);
-    uint32_t nRamSizeKbytes = conf & NEON_COPT_RAMSIZE_MASK;
-    if (nRamSizeKbytes == 0)
-        nRamSizeKbytes = 512;
-    m_nRamSizeBytes = nRamSizeKbytes * 1024;
-    m_pRAM = static_cast<uint8_t*>(::calloc(m_nRamSizeBytes, 1));
-    ::memset(m_pROM, 0, 16 * 1024);
+    SetRAMChunkSource(0, nullptr, nullptr);
+    Board_FreeRAM(m_pRAM, m_nRamSizeBytes);
+    m_nRamSizeBytes = GetRamSizeForConfiguration(conf);
+    m_pRAM = Board_AllocRAM(m_nRamSizeBytes);
+    SetRAMDirtyMap();
+    ::memset(GetOwnROM(), 0, 16 * 1024);
 
     //// Pre-fill RAM with "uninitialized" values
     //uint16_t * pMemory = (uint16_t *) m_pRAM;
@@ -117,6 +163,222 @@ void CMotherboard::SetConfiguration(uint16_t conf)
     //}
 }
 
+// Source of the lazy loaded RAM chunks, taken over by the cloned boards, see SetRAMChunkSource()
+struct BoardRAMLoader
+{
+    std::atomic<int> refcount;  // Shared RAM blocks using it
+    RAMCHUNKCALLBACK callback;
+    void* param;
+};
+
+// RAM shared by the cloned boards: pending chunks are read in place, and copied to the board RAM on the first write;
+// the chunks not loaded from the image yet are loaded by every board on its own
+struct BoardSharedRAM
+{
+    std::atomic<int> refcount;  // Boards using it as the RAM chunk source
+    const uint8_t* chunks[64];  // Chunk data; nullptr if the chunk is to load by pLoader
+    CSharedData* owners[64];    // RAM buffers holding the chunks
+    BoardRAMLoader* pLoader;    // Lazy loaded image, or nullptr
+};
+
+static bool CALLBACK Board_LoadSharedRAMChunk(void* param, int chunk, uint8_t* pDest)
+{
+    BoardSharedRAM* pShared = static_cast<BoardSharedRAM*>(param);
+    if (chunk >= 0)
+    {
+        if (pShared->chunks[chunk] == nullptr)
+            return (*pShared->pLoader->callback)(pShared->pLoader->param, chunk, pDest);
+        ::memcpy(pDest, pShared->chunks[chunk], NEONIMAGE_RAM_CHUNK_SIZE);
+        return true;
+    }
+
+    if (--pShared->refcount == 0)
+    {
+        for (int i = 0; i < 64; i++)
+        {
+            if (pShared->owners[i] != nullptr)
+                pShared->owners[i]->Release();
+        }
+        if (pShared->pLoader != nullptr && --pShared->pLoader->refcount == 0)
+        {
+            (*pShared->pLoader->callback)(pShared->pLoader->param, -1, nullptr);
+            delete pShared->pLoader;
+        }
+        delete pShared;
+    }
+    return true;
+}
+
+CMotherboard* CMotherboard::Clone()
+{
+    if (m_pRAM == nullptr)
+        return nullptr;
+
+#ifdef EMUBASE_MMAP
+    // Both boards get fresh RAM with all the chunks pending, see Board_AllocRAM(); the clone keeps its own if it fits
+    uint8_t* pRAM = Board_AllocRAM(m_nRamSizeBytes);
+#else
+    // Fresh RAM is taken in full here, so this board keeps its RAM, and the clone gets a copy of the loaded chunks
+    uint8_t* pRAM = m_pRAM;
+#endif
+    CMotherboard* pClone = new CMotherboard();
+    if (pClone->m_nRamSizeBytes != m_nRamSizeBytes)
+    {
+        Board_FreeRAM(pClone->m_pRAM, pClone->m_nRamSizeBytes);
+        pClone->m_pRAM = Board_AllocRAM(m_nRamSizeBytes);
+        pClone->m_nRamSizeBytes = m_nRamSizeBytes;
+    }
+    CFloppyController* pCloneFloppyCtl = m_pFloppyCtl->Clone(pClone);
+    CHardDrive* pCloneHardDrive = nullptr;
+    if (m_pHardDrive != nullptr && pCloneFloppyCtl != nullptr)
+        pCloneHardDrive = m_pHardDrive->Clone(pClone);
+    if (pRAM == nullptr || pClone->m_pRAM == nullptr || pCloneFloppyCtl == nullptr ||
+        (m_pHardDrive != nullptr && pCloneHardDrive == nullptr))
+    {
+        if (pRAM != m_pRAM)
+            Board_FreeRAM(pRAM, m_nRamSizeBytes);
+        delete pCloneHardDrive;
+        delete pCloneFloppyCtl;
+        delete pClone;
+        return nullptr;
+    }
+
+    // The chunks shared before and not written since stay shared; the lazy loaded image is taken over
+    BoardSharedRAM* pShared = new BoardSharedRAM();
+    pShared->refcount = 2;
+    ::memset(pShared->chunks, 0, sizeof(pShared->chunks));
+    ::memset(pShared->owners, 0, sizeof(pShared->owners));
+    pShared->pLoader = nullptr;
+    const BoardSharedRAM* pPrevious = nullptr;
+    if (m_RAMChunkCallback == Board_LoadSharedRAMChunk)
+    {
+        pPrevious = static_cast<const BoardSharedRAM*>(m_RAMChunkParam);
+        pShared->pLoader = pPrevious->pLoader;
+        if (pShared->pLoader != nullptr)
+            pShared->pLoader->refcount++;
+    }
+    else if (m_RAMChunkCallback != nullptr)
+    {
+        pShared->pLoader = new BoardRAMLoader();
+        pShared->pLoader->refcount = 1;
+        pShared->pLoader->callback = m_RAMChunkCallback;
+        pShared->pLoader->param = m_RAMChunkParam;
+        m_RAMChunkCallback = nullptr;  // Not released by SetRAMChunkSource() below
+    }
+    int chunkCount = (int)(m_nRamSizeBytes / NEONIMAGE_RAM_CHUNK_SIZE);
+    uint64_t allMask = (chunkCount >= 64) ? ~(uint64_t)0 : (((uint64_t)1) << chunkCount) - 1;
+    for (int chunk = 0; chunk < chunkCount; chunk++)
+    {
+        if ((m_RAMPendingMask & (((uint64_t)1) << chunk)) == 0)
+            continue;
+        if (pPrevious != nullptr)
+        {
+            pShared->chunks[chunk] = pPrevious->chunks[chunk];
+            pShared->owners[chunk] = pPrevious->owners[chunk];
+            if (pShared->owners[chunk] != nullptr)
+                pShared->owners[chunk]->AddRef();
+        }
+        else if (m_RAMReadChunks != nullptr)
+            pShared->chunks[chunk] = m_RAMReadChunks[chunk];
+    }
+#ifdef EMUBASE_MMAP
+    // The current RAM becomes read-only and shared, all the chunks are pending on both boards
+    uint64_t sharedMask = allMask;
+    CSharedData* pOwner = CSharedData::Create(m_pRAM, true, m_nRamSizeBytes);
+    for (int chunk = 0; chunk < chunkCount; chunk++)
+    {
+        if ((m_RAMPendingMask & (((uint64_t)1) << chunk)) != 0)
+            continue;
+        pShared->chunks[chunk] = pOwner->pData + chunk * NEONIMAGE_RAM_CHUNK_SIZE;
+        pShared->owners[chunk] = pOwner;
+        pOwner->AddRef();
+    }
+    pOwner->Release();
+#else
+    uint64_t sharedMask = m_RAMPendingMask & allMask;
+    for (uint32_t offset = 0; offset < m_nRamSizeBytes; offset += NEONIMAGE_RAM_CHUNK_SIZE)
+    {
+        if ((sharedMask & (((uint64_t)1) << (offset / NEONIMAGE_RAM_CHUNK_SIZE))) == 0)
+            ::memcpy(pClone->m_pRAM + offset, m_pRAM + offset, NEONIMAGE_RAM_CHUNK_SIZE);
+    }
+#endif
+
+    // Devices and plain state
+    delete pClone->m_pCPU;
+    pClone->m_pCPU = m_pCPU->Clone(pClone);
+    delete pClone->m_pFloppyCtl;
+    pClone->m_pFloppyCtl = pCloneFloppyCtl;
+    pClone->m_pHardDrive = pCloneHardDrive;
+    pClone->CopyStateFrom(this);
+
+    m_pRAM = pRAM;
+    SetRAMChunkSource(sharedMask, Board_LoadSharedRAMChunk, pShared, pShared->chunks);
+    pClone->SetRAMChunkSource(sharedMask, Board_LoadSharedRAMChunk, pShared, pShared->chunks);
+
+    return pClone;
+}
+
+void CMotherboard::CopyStateFrom(const CMotherboard* pSource)
+{
+    m_Configuration = pSource->m_Configuration;
+    if (pSource->m_pROMOwn != nullptr)
+        ::memcpy(GetOwnROM(), pSource->m_pROM, 16 * 1024);
+    else  // Shared ROM stays shared
+        SetSharedROM(pSource->m_pROM);
+    ::memcpy(m_HR, pSource->m_HR, sizeof(m_HR));
+    ::memcpy(m_UR, pSource->m_UR, sizeof(m_UR));
+    ::memcpy(m_pHDbuff, pSource->m_pHDbuff, 4 * 512);
+    ::memcpy(m_RAMDirty, pSource->m_RAMDirty, sizeof(m_RAMDirty));
+    ::memcpy(m_RAMShadowDirty, pSource->m_RAMShadowDirty, sizeof(m_RAMShadowDirty));
+
+    m_PICflags = pSource->m_PICflags;
+    m_PICRR = pSource->m_PICRR;
+    m_PICMR = pSource->m_PICMR;
+    m_PPIAwr = pSource->m_PPIAwr;  m_PPIArd = pSource->m_PPIArd;
+    m_PPIBwr = pSource->m_PPIBwr;  m_PPIBrd = pSource->m_PPIBrd;
+    m_PPIC = pSource->m_PPIC;
+    m_hdsdh = pSource->m_hdsdh;
+    m_hdscnt = pSource->m_hdscnt;
+    m_hdsnum = pSource->m_hdsnum;
+    m_hdcnum = pSource->m_hdcnum;
+    m_hdint = pSource->m_hdint;
+    m_nHDbuff = pSource->m_nHDbuff;
+    m_nHDbuffpos = pSource->m_nHDbuffpos;
+    m_HDbuffdir = pSource->m_HDbuffdir;
+    ::memcpy(m_keymatrix, pSource->m_keymatrix, sizeof(m_keymatrix));
+    m_keypos = pSource->m_keypos;
+    m_keyint = pSource->m_keyint;
+    m_mousedx = pSource->m_mousedx;  m_mousedy = pSource->m_mousedy;  m_mousest = pSource->m_mousest;
+    m_snd = pSource->m_snd;
+    m_snl = pSource->m_snl;
+    m_rtcalarmsec = pSource->m_rtcalarmsec;
+    m_rtcalarmmin = pSource->m_rtcalarmmin;
+    m_rtcalarmhour = pSource->m_rtcalarmhour;
+    ::memcpy(m_rtcmemory, pSource->m_rtcmemory, sizeof(m_rtcmemory));
+    m_rtcfixedtime = pSource->m_rtcfixedtime;
+    m_serialin = pSource->m_serialin;
+    m_serialinready = pSource->m_serialinready;
+
+    m_CPUbps = pSource->m_CPUbps;
+    m_okScratch = pSource->m_okScratch;
+    m_okFastDisk = pSource->m_okFastDisk;
+    m_dwTrace = pSource->m_dwTrace;
+    m_ticks = pSource->m_ticks;
+    m_soundBrasErr = pSource->m_soundBrasErr;
+    m_SoundGenCallback = pSource->m_SoundGenCallback;
+    m_SerialOutCallback = nullptr;  // The serial link is per machine, see SetSerialOutCallback()
+    m_SerialOutParam = nullptr;
+    m_ParallelOutCallback = pSource->m_ParallelOutCallback;
+}
+
+uint32_t CMotherboard::GetRamSizeForConfiguration(uint16_t conf)
+{
+    uint32_t nRamSizeKbytes = conf & NEON_COPT_RAMSIZE_MASK;
+    if (nRamSizeKbytes == 0)
+        nRamSizeKbytes = 512;
+    return nRamSizeKbytes * 1024;
+}
+
 void CMotherboard::SetTrace(uint32_t dwTrace)
 {
     m_dwTrace = dwTrace;
@@ -143,23 +405,56 @@ void CMotherboard::Reset()
 
     m_rtcalarmsec = m_rtcalarmmin = m_rtcalarmhour = 0;
 
+    m_serialinready = false;
+
     ResetDevices();
 
     m_pCPU->SetDCLOPin(false);
     m_pCPU->SetACLOPin(false);
 }
 
+void CMotherboard::SetScratchMode(bool okScratch)
+{
+    if (okScratch == m_okScratch)
+        return;
+
+    m_okScratch = okScratch;
+    m_pFloppyCtl->SetScratchMode(okScratch);
+    if (m_pHardDrive != nullptr)
+        m_pHardDrive->SetScratchMode(okScratch);
+}
+
 // Load 16 KB ROM image from the buffer
 void CMotherboard::LoadROM(const uint8_t* pBuffer)
 {
-    ::memcpy(m_pROM, pBuffer, 16384);
+    ::memcpy(GetOwnROM(), pBuffer, 16384);
+}
+
+void CMotherboard::SetSharedROM(const uint8_t* pROM)
+{
+    ::free(m_pROMOwn);  m_pROMOwn = nullptr;
+    m_pROM = pROM;
+}
+
+uint8_t* CMotherboard::GetOwnROM()
+{
+    if (m_pROMOwn == nullptr)
+    {
+        m_pROMOwn = static_cast<uint8_t*>(::malloc(16 * 1024));
+        ::memcpy(m_pROMOwn, m_pROM, 16 * 1024);
+        m_pROM = m_pROMOwn;
+    }
+    return m_pROMOwn;
 }
 
 void CMotherboard::LoadRAMBank(int bank, const void* buffer)
 {
     if (bank < 0 || bank > (int)(m_nRamSizeBytes / 8192))
         return;
+    if (m_RAMPendingMask != 0) LoadRAMChunk(bank * 8192);
     memcpy(m_pRAM + bank * 8192, buffer, 8192);
+    m_RAMDirty[bank / 8] |= ((uint64_t)0xff) << ((bank & 7) * 8);
+    m_RAMShadowDirty[bank / 8] |= ((uint64_t)0xff) << ((bank & 7) * 8);
 }
 
 
@@ -188,6 +483,23 @@ bool CMotherboard::AttachFloppyImage(int slot, LPCTSTR sFileName)
     return m_pFloppyCtl->AttachImage(slot, sFileName);
 }
 
+bool CMotherboard::AttachFloppyImageMapped(int slot, LPCTSTR sFileName, bool okPersistent)
+{
+    ASSERT(slot >= 0 && slot < 2);
+    return m_pFloppyCtl->AttachImageMapped(slot, sFileName, okPersistent);
+}
+uint8_t* CMotherboard::AttachFloppyStream(int slot, uint32_t* pSize)
+{
+    ASSERT(slot >= 0 && slot < 2);
+    return m_pFloppyCtl->AttachStreamImage(slot, pSize);
+}
+
+void CMotherboard::SetFloppyStreamLoaded(int slot, uint32_t loadedSize, bool okDone)
+{
+    ASSERT(slot >= 0 && slot < 2);
+    m_pFloppyCtl->SetStreamLoaded(slot, loadedSize, okDone);
+}
+
 void CMotherboard::DetachFloppyImage(int slot)
 {
     ASSERT(slot >= 0 && slot < 2);
@@ -214,6 +526,37 @@ bool CMotherboard::FillHDBuffer(const uint8_t* data)
     return true;
 }
 
+bool CMotherboard::ReadPortBlock(uint16_t port, uint16_t address, bool okHaltMode, int count, uint8_t* pLast)
+{
+    uint32_t offset;
+    if (port != 0161040 || m_HDbuffdir || count <= 0 || count > 0160000 - address)
+        return false;
+
+    // Check the memory first, by the 8 KB pages of the memory dispatcher
+    for (uint32_t page = address; page < (uint32_t)address + count; page = (page + 020000) & ~017777)
+    {
+        if (TranslateAddress((uint16_t)page, okHaltMode, false, &offset) != ADDRTYPE_RAM)
+            return false;
+    }
+
+    // The same as the port reads one by one, see GetPortWord()
+    int index = m_nHDbuff * 512 + m_nHDbuffpos;
+    uint8_t byte = 0;
+    for (int done = 0; done < count; done++)
+    {
+        if (done == 0 || ((address + done) & 017777) == 0)
+            TranslateAddress((uint16_t)(address + done), okHaltMode, false, &offset);
+        byte = m_pHDbuff[index];
+        SetRAMByte(offset++, byte);
+        index = (index + 1) & (4 * 512 - 1);
+    }
+    m_nHDbuff = (uint8_t)(index / 512);
+    m_nHDbuffpos = (uint16_t)(index % 512);
+
+    *pLast = byte;
+    return true;
+}
+
 const uint8_t* CMotherboard::GetHDBuffer()
 {
     if (m_hdscnt == 0)
@@ -239,9 +582,26 @@ bool CMotherboard::IsHardImageReadOnly() const
     return pHardDrive->IsReadOnly();
 }
 
+bool CMotherboard::AttachFloppyBuffer(int slot, uint8_t* pData, uint32_t size, bool okTakeOwnership)
+{
+    ASSERT(slot >= 0 && slot < 2);
+    return m_pFloppyCtl->AttachImageBuffer(slot, pData, size, okTakeOwnership);
+}
+const uint8_t* CMotherboard::TakeFloppyDirtyRange(int slot, uint32_t* pStart, uint32_t* pEnd)
+{
+    ASSERT(slot >= 0 && slot < 2);
+    if (!m_pFloppyCtl->TakeDirtyRange(slot, pStart, pEnd))
+        return nullptr;
+    if (m_pFloppyCtl->IsImageBufferCurrent(slot))
+        return m_pFloppyCtl->GetImageBuffer(slot) + *pStart;
+    uint8_t* pCopy = GetDiskCopy(*pEnd - *pStart);
+    if (pCopy != nullptr)
+        m_pFloppyCtl->ReadImageData(slot, *pStart, *pEnd, pCopy);
+    return pCopy;
+}
 bool CMotherboard::AttachHardImage(LPCTSTR sFileName)
 {
-    m_pHardDrive = new CHardDrive();
+    m_pHardDrive = new CHardDrive(this);
     bool success = m_pHardDrive->AttachImage(sFileName);
     if (success)
     {
@@ -250,6 +610,44 @@ bool CMotherboard::AttachHardImage(LPCTSTR sFileName)
 
     return success;
 }
+bool CMotherboard::AttachHardBuffer(uint8_t* pData, uint32_t size, bool okTakeOwnership)
+{
+    CHardDrive* pHardDrive = new CHardDrive(this);
+    if (!pHardDrive->AttachImageBuffer(pData, size, okTakeOwnership))
+    {
+        delete pHardDrive;
+        return false;
+    }
+    delete m_pHardDrive;
+    m_pHardDrive = pHardDrive;
+    m_pHardDrive->Reset();
+
+    return true;
+}
+const uint8_t* CMotherboard::TakeHardDirtyRange(uint32_t* pStart, uint32_t* pEnd)
+{
+    if (m_pHardDrive == nullptr || !m_pHardDrive->TakeDirtyRange(pStart, pEnd))
+        return nullptr;
+    if (m_pHardDrive->IsImageBufferCurrent())
+        return m_pHardDrive->GetImageBuffer() + *pStart;
+    uint8_t* pCopy = GetDiskCopy(*pEnd - *pStart);
+    if (pCopy != nullptr)
+        m_pHardDrive->ReadImageData(*pStart, *pEnd, pCopy);
+    return pCopy;
+}
+
+uint8_t* CMotherboard::GetDiskCopy(uint32_t size)
+{
+    if (size > m_nDiskCopySize)
+    {
+        uint8_t* pCopy = static_cast<uint8_t*>(::realloc(m_pDiskCopy, size));
+        if (pCopy == nullptr)
+            return nullptr;
+        m_pDiskCopy = pCopy;
+        m_nDiskCopySize = size;
+    }
+    return m_pDiskCopy;
+}
 void CMotherboard::DetachHardImage()
 {
     delete m_pHardDrive;
@@ -278,25 +676,99 @@ void CMotherboard::SetHardPortWord(uint16_t port, uint16_t data)
 uint16_t CMotherboard::GetRAMWord(uint32_t offset) const
 {
     ASSERT(offset < m_nRamSizeBytes);
+    if (m_RAMPendingMask != 0) return *((const uint16_t*)GetPendingRAM(offset));
     return *((uint16_t*)(m_pRAM + offset));
 }
 uint8_t CMotherboard::GetRAMByte(uint32_t offset) const
 {
+    if (m_RAMPendingMask != 0) return *GetPendingRAM(offset);
     return m_pRAM[offset];
 }
 void CMotherboard::SetRAMWord(uint32_t offset, uint16_t word)
 {
+    if (m_RAMPendingMask != 0) LoadRAMChunk(offset);
     *((uint16_t*)(m_pRAM + offset)) = word;
+    uint64_t page = ((uint64_t)1) << ((offset / NEONIMAGE_RAM_PAGE_SIZE) & 63);
+    m_RAMDirty[offset / NEONIMAGE_RAM_CHUNK_SIZE] |= page;
+    m_RAMShadowDirty[offset / NEONIMAGE_RAM_CHUNK_SIZE] |= page;
 }
 void CMotherboard::SetRAMByte(uint32_t offset, uint8_t byte)
 {
+    if (m_RAMPendingMask != 0) LoadRAMChunk(offset);
     m_pRAM[offset] = byte;
+    uint64_t page = ((uint64_t)1) << ((offset / NEONIMAGE_RAM_PAGE_SIZE) & 63);
+    m_RAMDirty[offset / NEONIMAGE_RAM_CHUNK_SIZE] |= page;
+    m_RAMShadowDirty[offset / NEONIMAGE_RAM_CHUNK_SIZE] |= page;
+}
+
+void CMotherboard::SetRAMChunkSource(uint64_t pendingMask, RAMCHUNKCALLBACK callback, void* param,
+        const uint8_t* const* pReadChunks)
+{
+    if (m_RAMChunkCallback != nullptr)  // Release the previous source
+        (*m_RAMChunkCallback)(m_RAMChunkParam, -1, nullptr);
+
+    m_RAMPendingMask = (callback != nullptr) ? pendingMask : 0;
+    m_RAMChunkCallback = (m_RAMPendingMask != 0) ? callback : nullptr;
+    m_RAMChunkParam = (m_RAMPendingMask != 0) ? param : nullptr;
+    m_RAMReadChunks = (m_RAMPendingMask != 0) ? pReadChunks : nullptr;
+    m_okRAMLoadFailed = false;
+    if (m_RAMChunkCallback == nullptr && callback != nullptr)  // Nothing pending, release the new source
+        (*callback)(param, -1, nullptr);
+}
+
+// Load the RAM chunk containing the offset, if it is still pending
+void CMotherboard::LoadRAMChunk(uint32_t offset) const
+{
+    int chunk = (int)(offset / NEONIMAGE_RAM_CHUNK_SIZE);
+    uint64_t chunkbit = ((uint64_t)1) << chunk;
+    if ((m_RAMPendingMask & chunkbit) == 0)
+        return;
+
+    m_RAMPendingMask &= ~chunkbit;
+    uint8_t* pChunk = m_pRAM + chunk * NEONIMAGE_RAM_CHUNK_SIZE;
+    if (!(*m_RAMChunkCallback)(m_RAMChunkParam, chunk, pChunk))
+    {
+        DebugLogFormat(_T("RAM chunk %d failed to load\n"), chunk);
+        m_okRAMLoadFailed = true;  // No guessing the RAM contents, the run stops, see SystemTicks()
+    }
+
+    if (m_RAMPendingMask == 0)  // All loaded, release the source
+    {
+        (*m_RAMChunkCallback)(m_RAMChunkParam, -1, nullptr);
+        m_RAMChunkCallback = nullptr;
+        m_RAMChunkParam = nullptr;
+        m_RAMReadChunks = nullptr;
+    }
+}
+
+// RAM to read at the offset: the chunk in place if it is pending and readable, see SetRAMChunkSource()
+const uint8_t* CMotherboard::GetPendingRAM(uint32_t offset) const
+{
+    uint32_t chunk = offset / NEONIMAGE_RAM_CHUNK_SIZE;
+    if ((m_RAMPendingMask & (((uint64_t)1) << chunk)) != 0)
+    {
+        if (m_RAMReadChunks != nullptr && m_RAMReadChunks[chunk] != nullptr)
+            return m_RAMReadChunks[chunk] + offset % NEONIMAGE_RAM_CHUNK_SIZE;
+        LoadRAMChunk(offset);
+    }
+    return m_pRAM + offset;
+}
+
+const uint8_t* CMotherboard::GetRAMChunk(uint32_t chunk) const
+{
+    return GetPendingRAM(chunk * NEONIMAGE_RAM_CHUNK_SIZE);
+}
+
+void CMotherboard::LoadPendingRAMChunks() const
+{
+    for (uint32_t offset = 0; m_RAMPendingMask != 0 && offset < m_nRamSizeBytes; offset += NEONIMAGE_RAM_CHUNK_SIZE)
+        LoadRAMChunk(offset);
 }
 
 uint16_t CMotherboard::GetROMWord(uint16_t offset) const
 {
     ASSERT(offset < 1024 * 16);
-    return *((uint16_t*)(m_pROM + offset));
+    return *((const uint16_t*)(m_pROM + offset));
 }
 uint8_t CMotherboard::GetROMByte(uint16_t offset) const
 {
@@ -462,12 +934,24 @@ void CMotherboard::DebugTicks()
 * 882 тиков звука (для частоты 22050 Гц)
 */
 bool CMotherboard::SystemFrame()
+{
+    return SystemTicks(NEON_FRAME_TICKS - (int)(m_ticks % NEON_FRAME_TICKS));
+}
+
+// Run the ticks from the current position in the frame; the frame starts every NEON_FRAME_TICKS board ticks
+bool CMotherboard::SystemTicks(int ticks)
 {
     const int soundSamplesPerFrame = SOUNDSAMPLERATE / 25;
-    int soundBrasErr = 0;
+    int frameticks = (int)(m_ticks % NEON_FRAME_TICKS);
 
-    for (int frameticks = 0; frameticks < 20000; frameticks++)
+    for (; ticks > 0; ticks--)
     {
+        if (m_okRAMLoadFailed)
+            return false;
+
+        if (frameticks == 0)
+            m_soundBrasErr = 0;
+
         for (int procticks = 0; procticks < 16; procticks++)  // CPU ticks
         {
 #if !defined(PRODUCT)
@@ -492,16 +976,16 @@ bool CMotherboard::SystemFrame()
         if (frameticks % 10000 == 5000)
             Tick50();  // 1/50 timer event
 
-        if (frameticks % 32 == 0)  // FDD tick
+        // The disk devices arm their timers only when they have work to do
+        if (m_ticks >= m_pFloppyCtl->GetTimerTick())
             m_pFloppyCtl->Periodic();
+        if (m_pHardDrive != nullptr && m_ticks >= m_pHardDrive->GetTimerTick())
+            m_pHardDrive->Timeout();
 
-        if (m_pHardDrive != nullptr)
-            m_pHardDrive->Periodic();
-
-        soundBrasErr += soundSamplesPerFrame;
-        if (2 * soundBrasErr >= 20000)
+        m_soundBrasErr += soundSamplesPerFrame;
+        if (2 * m_soundBrasErr >= NEON_FRAME_TICKS)
         {
-            soundBrasErr -= 20000;
+            m_soundBrasErr -= NEON_FRAME_TICKS;
             DoSound();
         }
 
@@ -522,6 +1006,13 @@ bool CMotherboard::SystemFrame()
         //        // Now the printer waits for Strobe
         //    }
         //}
+
+        m_ticks++;
+        if (++frameticks == NEON_FRAME_TICKS)
+        {
+            frameticks = 0;
+            m_pFloppyCtl->FlushDue();  // Disk writes at the frame boundary
+        }
     }
 
     return true;
@@ -536,12 +1027,14 @@ uint8_t CMotherboard::GetRAMByteView(uint32_t offset) const
 {
     if (offset >= m_nRamSizeBytes)
         return 0;
+    if (m_RAMPendingMask != 0) return *GetPendingRAM(offset);
     return m_pRAM[offset];
 }
 uint16_t CMotherboard::GetRAMWordView(uint32_t offset) const
 {
     if (offset >= m_nRamSizeBytes - 1)
         return 0;
+    if (m_RAMPendingMask != 0) return *(const uint16_t*)GetPendingRAM(offset);
     return *(uint16_t*)(m_pRAM + offset);
 }
 uint16_t CMotherboard::GetWordView(uint16_t address, bool okHaltMode, bool okExec, int* pAddrType) const
@@ -865,10 +1358,11 @@ uint16_t CMotherboard::GetPortWord(uint16_t address)
 
     case 0161060:  // DLBUF
         DebugLogFormat(_T("%c%06ho\tGETPORT %06ho DLBUF\n"), HU_INSTRUCTION_PC, address);
-        return 0;
+        m_serialinready = false;
+        return m_serialin;
     case 0161062:  // DLCSR
         DebugLogFormat(_T("%c%06ho\tGETPORT %06ho DLCSR\n"), HU_INSTRUCTION_PC, address);
-        return (m_SerialOutCallback == nullptr) ? 0 : 1;
+        return ((m_SerialOutCallback == nullptr) ? 0 : 1) | (m_serialinready ? 0200 : 0);
 
     case 0161064:  // KBDCSR
         resb = m_keymatrix[m_keypos & 7];
@@ -1152,8 +1646,8 @@ void CMotherboard::SetPortWord(uint16_t address, uint16_t word)
 
     case 0161060:  // DLBUF
         DebugLogFormat(_T("%c%06ho\tSETPORT %06ho -> (%06ho) DLBUF\n"), HU_INSTRUCTION_PC, word, address);
-        if (m_SerialOutCallback != nullptr)
-            (*m_SerialOutCallback)(word & 0xff);
+        if (m_SerialOutCallback != nullptr && !m_okScratch)
+            (*m_SerialOutCallback)(m_SerialOutParam, word & 0xff);
         break;
     case 0161062:  // DLCSR
         DebugLogFormat(_T("%c%06ho\tSETPORT %06ho -> (%06ho) DLCSR\n"), HU_INSTRUCTION_PC, word, address);
@@ -1324,6 +1818,17 @@ void CMotherboard::UpdateInterrupts()
     m_pCPU->SetHALTPin((m_PPIBrd & 11) != 11 || ioint);  // EF0 EF1, IHLT or IOINT
 }
 
+// Current time for the Real Time Clock; localtime_r/localtime_s as the boards could run on several threads
+void CMotherboard::GetRtcTime(struct tm* ptm) const
+{
+    time_t tnow = (m_rtcfixedtime != 0) ? m_rtcfixedtime : time(0);
+#ifdef _WIN32
+    localtime_s(ptm, &tnow);
+#else
+    localtime_r(&tnow, ptm);
+#endif
+}
+
 // Get port value for Real Time Clock - ports 0161400..0161476 - КР512ВИ1 == MC146818
 uint8_t CMotherboard::ProcessRtcRead(uint16_t address) const
 {
@@ -1332,8 +1837,9 @@ uint8_t CMotherboard::ProcessRtcRead(uint16_t address) const
     if (address >= 14 && address < 64)
         return m_rtcmemory[address - 14];
 
-    time_t tnow = time(0);
-    struct tm* lnow = localtime(&tnow);
+    struct tm tmnow;
+    const struct tm* lnow = &tmnow;
+    GetRtcTime(&tmnow);
 
     switch (address)
     {
@@ -1382,6 +1888,7 @@ void CMotherboard::ProcessRtcWrite(uint16_t address, uint8_t byte)
 //    3072  16384 bytes  - ROM image 16K
 //   19456   1024 bytes  - RESERVED
 //   20480               - RAM image 512/1024/2048/4096 KB
+//  This is version 1.0 layout; version 2.0 image keeps these sections in separate chunks, see StateImage.cpp
 //
 //  Board status (400 bytes):
 //      32      4 bytes  - RAM size bytes
@@ -1401,9 +1908,10 @@ void CMotherboard::ProcessRtcWrite(uint16_t address, uint8_t byte)
 //     192     60 bytes  - PIT8253 x 2
 //     256      4 bytes  - RESERVED
 //     256     64 bytes  - Timer
-//     320     80 bytes  - RESERVED
+//     320     60 bytes  - PIT8253 x 2, in full: the Timer overwrites most of the copy above
+//     380     20 bytes  - RESERVED
 //
-void CMotherboard::SaveToImage(uint8_t* pImage)
+void CMotherboard::SaveToImage(uint8_t* pImage, bool okWithRam)
 {
     // Board data
     uint16_t* pwImage = reinterpret_cast<uint16_t*>(pImage + 32);
@@ -1450,8 +1958,9 @@ void CMotherboard::SaveToImage(uint8_t* pImage)
     pwImage += 30 / 2;
     memcpy(pwImage, m_snl.m_chan, sizeof(m_snl.m_chan));  // 30 bytes
     // Timer
-    time_t tnow = time(0);
-    struct tm* lnow = localtime(&tnow);
+    struct tm tmnow;
+    const struct tm* lnow = &tmnow;
+    GetRtcTime(&tmnow);
     uint8_t* pImageTimer = pImage + 256;
     *pImageTimer++ = (uint8_t)lnow->tm_sec;  // Seconds
     *pImageTimer++ = m_rtcalarmsec;
@@ -1468,6 +1977,10 @@ void CMotherboard::SaveToImage(uint8_t* pImage)
     *pImageTimer++ = 0;
     *pImageTimer++ = 0;
     memcpy(pImageTimer, m_rtcmemory, sizeof(m_rtcmemory));  // 50 bytes
+    // PIT8253 x 2, in full
+    uint8_t* pImagePit = pImage + 320;
+    memcpy(pImagePit, m_snd.m_chan, sizeof(m_snd.m_chan));  // 30 bytes
+    memcpy(pImagePit + 30, m_snl.m_chan, sizeof(m_snl.m_chan));  // 30 bytes
 
     // CPU status
     uint8_t* pImageCPU = pImage + 432;
@@ -1479,18 +1992,33 @@ void CMotherboard::SaveToImage(uint8_t* pImage)
     uint8_t* pImageRom = pImage + 3072;
     memcpy(pImageRom, m_pROM, 16 * 1024);
     // RAM
-    uint8_t* pImageRam = pImage + 20480;
-    memcpy(pImageRam, m_pRAM, m_nRamSizeBytes);
+    if (!okWithRam)
+        return;
+    uint8_t* pImageRam = pImage + NEONIMAGE_RAM_OFFSET;
+    if (m_RAMPendingMask == 0)
+        memcpy(pImageRam, m_pRAM, m_nRamSizeBytes);
+    else
+    {
+        for (uint32_t offset = 0; offset < m_nRamSizeBytes; offset += NEONIMAGE_RAM_CHUNK_SIZE)
+            memcpy(pImageRam + offset, GetPendingRAM(offset), NEONIMAGE_RAM_CHUNK_SIZE);
+    }
 }
-void CMotherboard::LoadFromImage(const uint8_t* pImage)
+bool CMotherboard::LoadFromImage(const uint8_t* pImage, bool okWithRam)
 {
     // Board data
     const uint16_t* pwImage = reinterpret_cast<const uint16_t*>(pImage + 32);
 
-    //TODO: If the new configuration has different memory size, re-allocate the memory
-    m_Configuration = *pwImage++;
-    memcpy(&m_nRamSizeBytes, pwImage, sizeof(m_nRamSizeBytes));  // 4 bytes
-    pwImage += sizeof(m_nRamSizeBytes) / 2;
+    // If the new configuration has different memory size, re-allocate the memory
+    uint16_t configuration = *pwImage++;
+    uint32_t nRamSizeBytes;
+    memcpy(&nRamSizeBytes, pwImage, sizeof(nRamSizeBytes));  // 4 bytes
+    pwImage += sizeof(nRamSizeBytes) / 2;
+    if (nRamSizeBytes != GetRamSizeForConfiguration(configuration))
+        return false;
+    if (nRamSizeBytes != m_nRamSizeBytes)
+        SetConfiguration(configuration);
+    m_Configuration = configuration;
+    SetRAMDirtyMap();
     m_PICflags = *pwImage++;
     m_PICRR = (uint8_t)*pwImage++;
     m_PICMR = (uint8_t)*pwImage++;
@@ -1503,6 +2031,7 @@ void CMotherboard::LoadFromImage(const uint8_t* pImage)
     memcpy(m_HR, pwImage, sizeof(m_HR));  // 32 bytes
     pwImage += sizeof(m_HR) / 2;
     memcpy(m_UR, pwImage, sizeof(m_UR));  // 32 bytes
+    pwImage += sizeof(m_UR) / 2;
     pwImage += 8 / 2;  // RESERVED
     // HDD controller
     m_hdsdh = *pwImage++;
@@ -1543,6 +2072,16 @@ void CMotherboard::LoadFromImage(const uint8_t* pImage)
     pImageTimer++;  // Year
     pImageTimer += 4;
     memcpy(m_rtcmemory, pImageTimer, sizeof(m_rtcmemory));  // 50 bytes
+    // PIT8253 x 2, in full; the images saved before have zeros here, then the copy above is used
+    const uint8_t* pImagePit = pImage + 320;
+    bool okPitSaved = false;
+    for (int i = 0; i < 60; i++)
+        okPitSaved = okPitSaved || pImagePit[i] != 0;
+    if (okPitSaved)
+    {
+        memcpy(m_snd.m_chan, pImagePit, sizeof(m_snd.m_chan));  // 30 bytes
+        memcpy(m_snl.m_chan, pImagePit + 30, sizeof(m_snl.m_chan));  // 30 bytes
+    }
 
     // CPU status
     const uint8_t* pImageCPU = pImage + 432;
@@ -1552,10 +2091,17 @@ void CMotherboard::LoadFromImage(const uint8_t* pImage)
     memcpy(m_pHDbuff, pImageBuffer2K, 2048);
     // ROM
     const uint8_t* pImageRom = pImage + 3072;
-    memcpy(m_pROM, pImageRom, 16 * 1024);
+    if (memcmp(m_pROM, pImageRom, 16 * 1024) != 0)  // Keep the shared ROM if it is the same
+        memcpy(GetOwnROM(), pImageRom, 16 * 1024);
     // RAM
-    const uint8_t* pImageRam = pImage + 20480;
-    memcpy(m_pRAM, pImageRam, m_nRamSizeBytes);
+    if (okWithRam)
+    {
+        const uint8_t* pImageRam = pImage + NEONIMAGE_RAM_OFFSET;
+        SetRAMChunkSource(0, nullptr, nullptr);  // RAM is replaced
+        memcpy(m_pRAM, pImageRam, m_nRamSizeBytes);
+    }
+
+    return true;
 }
 
 
@@ -1563,7 +2109,7 @@ void CMotherboard::LoadFromImage(const uint8_t* pImage)
 
 void CMotherboard::DoSound()
 {
-    if (m_SoundGenCallback == nullptr)
+    if (m_SoundGenCallback == nullptr || m_okScratch)
         return;
 
     uint16_t sound =
@@ -1596,9 +2142,10 @@ void CMotherboard::SetSoundGenCallback(SOUNDGENCALLBACK callback)
     }
 }
 
-void CMotherboard::SetSerialOutCallback(SERIALOUTCALLBACK outcallback)
+void CMotherboard::SetSerialOutCallback(SERIALOUTCALLBACK outcallback, void* param)
 {
     m_SerialOutCallback = outcallback;
+    m_SerialOutParam = param;
 }
 
 void CMotherboard::SetParallelOutCallback(PARALLELOUTCALLBACK outcallback)
@@ -14,6 +14,7 @@ NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
 #pragma once
 
 #include "Defines.h"
+#include <ctime>
 
 class CProcessor;
 class Motherboard;
@@ -55,7 +56,14 @@ enum NeonConfiguration
 // Emulator image constants
 #define NEONIMAGE_HEADER1 0x6E6F654E  // "Neon"
 #define NEONIMAGE_HEADER2 0x214C5442  // "BTL!"
-#define NEONIMAGE_VERSION 0x00010000  // 1.0
+#define NEONIMAGE_VERSION_1_0 0x00010000  // 1.0, fixed layout
+#define NEONIMAGE_VERSION 0x00020000  // 2.0, chunks, see StateImage.cpp
+#define NEONIMAGE_HEADER_SIZE     32  // Image header size, not compressed
+#define NEONIMAGE_RAM_OFFSET   20480  // Offset of the RAM image in the version 1.0 state image
+#define NEONIMAGE_RAM_CHUNK_SIZE 65536  // RAM chunk size for the version 2.0 image and lazy RAM loading
+#define NEONIMAGE_RAM_PAGE_SIZE   1024  // RAM page size for the write tracking and delta images, 64 pages per chunk
+
+#define NEON_FRAME_TICKS  20000  // Board ticks per frame, 25 frames per second; 16 CPU ticks per board tick
 
 // PIC 8259A flags
 #define PIC_MODE_ICW1      1  // Wait for ICW1 after RESET
@@ -70,12 +78,16 @@ enum NeonConfiguration
 // Sound generator callback function type
 typedef void (CALLBACK* SOUNDGENCALLBACK)(unsigned short L, unsigned short R);
 
-// Serial port output callback
-typedef void (CALLBACK* SERIALOUTCALLBACK)(uint8_t byte);
+// Serial port output callback; CMotherboard::GetTicks() gives the time of the byte written
+typedef void (CALLBACK* SERIALOUTCALLBACK)(void* param, uint8_t byte);
 
 // Parallel port output callback
 typedef void (CALLBACK* PARALLELOUTCALLBACK)(uint8_t byte);
 
+// Lazy RAM loading callback: chunk >= 0 - fill the RAM chunk on its first access, returns false on failure;
+// chunk < 0 - no more chunks needed, release the param
+typedef bool (CALLBACK* RAMCHUNKCALLBACK)(void* param, int chunk, uint8_t* pDest);
+
 
 //////////////////////////////////////////////////////////////////////
 
@@ -116,6 +128,13 @@ class CMotherboard
 public:  // Construct / destruct
     CMotherboard();
     ~CMotherboard();
+    // Fork the machine: a new board with the same CPU, devices and RAM, running independently from now on.
+    // RAM is shared copy-on-write, by NEONIMAGE_RAM_CHUNK_SIZE chunks; without EMUBASE_MMAP, only the chunks not
+    // loaded yet are shared, the loaded ones are copied. The attached disk images are shared: this board
+    // goes on writing its image files and buffers, the new board sees the images as of now and keeps its disk writes
+    // in its own overlay; see CDiskShare. The new board has no serial output callback, see SetSerialOutCallback().
+    // Returns nullptr on failure, this board is intact then.
+    CMotherboard* Clone();
 private:  // Devices
     uint16_t    m_Configuration;  // See NEON_COPT_Xxx flag constants
     CProcessor* m_pCPU;  // CPU device
@@ -123,13 +142,17 @@ private:  // Devices
     CHardDrive* m_pHardDrive;  // HDD control
 public:  // Getting devices
     CProcessor* GetCPU() { return m_pCPU; }
+    CFloppyController* GetFloppyCtl() { return m_pFloppyCtl; }
 private:  // Memory
-    uint8_t*    m_pROM;  // ROM, 16 KB
+    const uint8_t* m_pROM;  // ROM, 16 KB: the own copy or the shared ROM image
+    uint8_t*    m_pROMOwn;  // Own copy of the ROM, nullptr while the ROM is shared
     uint8_t*    m_pRAM;  // RAM, 512..4096 KB
     uint16_t    m_HR[8];
     uint16_t    m_UR[8];
     uint32_t    m_nRamSizeBytes;  // Actual RAM size
     uint8_t*    m_pHDbuff;  // HD buffers, 2K
+    uint8_t*    m_pDiskCopy;  // Disk data with the overlay writes, see TakeHardDirtyRange(); nullptr if none
+    uint32_t    m_nDiskCopySize;
 public:  // Memory access
     uint16_t    GetRAMWord(uint32_t offset) const;
     uint8_t     GetRAMByte(uint32_t offset) const;
@@ -138,6 +161,30 @@ public:  // Memory access
     uint16_t    GetROMWord(uint16_t offset) const;
     uint8_t     GetROMByte(uint16_t offset) const;
     uint32_t    GetRamSizeBytes() const { return m_nRamSizeBytes; }
+    // RAM as is, to read or write it without copying; loads all the pending chunks, see SetRAMChunkSource()
+    const uint8_t* GetRAMImage() const { LoadPendingRAMChunks(); return m_pRAM; }
+    uint8_t*    GetRAMImage() { LoadPendingRAMChunks(); return m_pRAM; }
+    // RAM chunk N of NEONIMAGE_RAM_CHUNK_SIZE bytes to read; a pending chunk is read in place when possible
+    const uint8_t* GetRAMChunk(uint32_t chunk) const;
+public:  // Lazy RAM loading
+    // Set the source for RAM chunks not loaded yet, bit N of pendingMask = chunk N of NEONIMAGE_RAM_CHUNK_SIZE bytes;
+    // the callback fills a chunk on the first access to it. With pReadChunks, the pending chunks are read
+    // in place from pReadChunks[N], unless it is nullptr, and loaded on the first write only.
+    void        SetRAMChunkSource(uint64_t pendingMask, RAMCHUNKCALLBACK callback, void* param,
+            const uint8_t* const* pReadChunks = nullptr);
+    void        LoadPendingRAMChunks() const;  // Load all the pending chunks right now
+    // A pending chunk failed to load: the RAM is not usable, SystemTicks() stops and returns false from now on
+    bool        IsRAMLoadFailed() const { return m_okRAMLoadFailed; }
+public:  // RAM write tracking
+    // Dirty map: one word per RAM chunk, bit N = page N of NEONIMAGE_RAM_PAGE_SIZE bytes in the chunk was written
+    const uint64_t* GetRAMDirtyMap() const { return m_RAMDirty; }
+    void        ClearRAMDirtyMap() { ::memset(m_RAMDirty, 0, sizeof(m_RAMDirty)); }
+    void        SetRAMDirtyMap()  // Mark all RAM as changed, in both maps
+        { ::memset(m_RAMDirty, 0xff, sizeof(m_RAMDirty));  ::memset(m_RAMShadowDirty, 0xff, sizeof(m_RAMShadowDirty)); }
+    void        SetRAMDirtyMap(const uint64_t* pMap) { ::memcpy(m_RAMDirty, pMap, sizeof(m_RAMDirty)); }  // 64 words
+    // Shadow map: the same for the RAM copy kept by CRunAhead, cleared apart from the dirty map used by the deltas
+    const uint64_t* GetRAMShadowMap() const { return m_RAMShadowDirty; }
+    void        ClearRAMShadowMap() { ::memset(m_RAMShadowDirty, 0, sizeof(m_RAMShadowDirty)); }
 public:  // Debug
     void        DebugTicks();  // One Debug CPU tick -- use for debug step or debug breakpoint
     void        SetCPUBreakpoints(const uint16_t* bps) { m_CPUbps = bps; } // Set CPU breakpoint list
@@ -148,16 +195,40 @@ public:  // System control
     void        SetConfiguration(uint16_t conf);
     uint16_t    GetConfiguration() const { return m_Configuration; }
     void        LoadROM(const uint8_t* pBuffer);  // Load 16 KB ROM image from the buffer
+    // Use the 16 KB ROM image in place, without copying; the image is shared by the boards and must outlive them
+    void        SetSharedROM(const uint8_t* pROM);
     void        Reset();  // Reset computer
     void        Tick50();           // Tick 50 Hz
     void        TimerTick();        // Timer Tick
     void        ResetDevices();     // INIT signal
-    bool        SystemFrame();  // Do one frame -- use for normal run
+    bool        SystemFrame();  // Do one frame, or the rest of the current frame -- use for normal run
+    // Run the given number of board ticks, the frame parts too; returns false if stopped on a breakpoint
+    bool        SystemTicks(int ticks);
+    uint64_t    GetTicks() const { return m_ticks; }  // Board ticks since the board created, NEON_FRAME_TICKS per frame
+    void        SetTicks(uint64_t ticks) { m_ticks = ticks; }  // To roll back the frames run in the scratch mode
     void        UpdateKeyboardMatrix(const uint8_t matrix[8]);
     void        MouseMove(short dx, short dy, bool btnLeft, bool btnRight);
     uint16_t    GetPrinterOutPort() const { return m_PPIBwr; }
+    // Real time clock shows the fixed time instead of the host local time, for deterministic runs; 0 = host time
+    void        SetRtcFixedTime(time_t t) { m_rtcfixedtime = t; }
+    // Serial port input: the byte goes to DLBUF and sets DLCSR bit 7 until DLBUF is read; the unread byte is lost
+    void        SerialInput(uint8_t byte) { m_serialin = byte;  m_serialinready = true; }
+    // Scratch mode, to run frames that are rolled back later: disk writes go to temporary overlays, output callbacks
+    // are not called. Leaving the mode discards the disk writes and restores the disk devices state.
+    void        SetScratchMode(bool okScratch);
+    bool        IsScratchMode() const { return m_okScratch; }
+    // Fast disk mode: the guest loops draining the FD/HD buffer port run all at once, see CProcessor::ExecuteFastReadLoop();
+    // the CPU ticks are the same, but the interrupts wait for the loop end. Off by default.
+    void        SetFastDiskMode(bool okFast) { m_okFastDisk = okFast; }
+    bool        IsFastDiskMode() const { return m_okFastDisk; }
 public:  // Floppy
     bool        AttachFloppyImage(int slot, LPCTSTR sFileName);
+    bool        AttachFloppyImageMapped(int slot, LPCTSTR sFileName, bool okPersistent);  // See CFloppyController::AttachImageMapped()
+    uint8_t*    AttachFloppyStream(int slot, uint32_t* pSize);  // See CFloppyController::AttachStreamImage()
+    void        SetFloppyStreamLoaded(int slot, uint32_t loadedSize, bool okDone);
+    bool        AttachFloppyBuffer(int slot, uint8_t* pData, uint32_t size, bool okTakeOwnership);  // See CFloppyController::AttachImageBuffer()
+    // Get the image data bytes written since the previous call; see TakeHardDirtyRange()
+    const uint8_t* TakeFloppyDirtyRange(int slot, uint32_t* pStart, uint32_t* pEnd);
     void        DetachFloppyImage(int slot);
     bool        IsFloppyImageAttached(int slot) const;
     bool        IsFloppyReadOnly(int slot) const;
@@ -166,9 +237,18 @@ public:  // Floppy
     // Fill the current HD buffer, to call from floppy controller only
     bool        FillHDBuffer(const uint8_t* data);
     const uint8_t* GetHDBuffer();
+    // Read count bytes of the port to the memory at once, for the fast disk mode; pLast gets the last byte.
+    // Returns false, doing nothing, if the port is not HD.BUFF in read mode or the memory is not RAM.
+    bool        ReadPortBlock(uint16_t port, uint16_t address, bool okHaltMode, int count, uint8_t* pLast);
 public:  // IDE HDD
     // Attach hard drive image
     bool        AttachHardImage(LPCTSTR sFileName);
+    // Attach hard drive image from the memory buffer; with okTakeOwnership the buffer is freed on detach
+    bool        AttachHardBuffer(uint8_t* pData, uint32_t size, bool okTakeOwnership);
+    // Get the image data bytes written since the previous call: returns the data of the [start, end) range of the
+    // written bytes, or nullptr if nothing written or the image is not buffer-backed. The data is in the image buffer,
+    // or copied with the writes kept in the overlay (cloned board, scratch mode), valid till the next call then.
+    const uint8_t* TakeHardDirtyRange(uint32_t* pStart, uint32_t* pEnd);
     // Detach hard drive image
     void        DetachHardImage();
     // Check if the hard drive attached
@@ -179,7 +259,7 @@ public:  // IDE HDD
     void        SetHardPortWord(uint16_t port, uint16_t data);  // To use from CMotherboard only
 public:  // Callbacks
     void        SetSoundGenCallback(SOUNDGENCALLBACK callback);
-    void        SetSerialOutCallback(SERIALOUTCALLBACK outcallback);
+    void        SetSerialOutCallback(SERIALOUTCALLBACK outcallback, void* param = nullptr);
     void        SetParallelOutCallback(PARALLELOUTCALLBACK outcallback);
 public:  // Memory
     // Read command for execution
@@ -214,8 +294,12 @@ private:  // Access to I/O ports
     uint8_t     GetPortByte(uint16_t address);
     void        SetPortByte(uint16_t address, uint8_t byte);
 public:  // Saving/loading emulator status
-    void        SaveToImage(uint8_t* pImage);
-    void        LoadFromImage(const uint8_t* pImage);
+    // Save the whole state image; okWithRam = false saves everything before NEONIMAGE_RAM_OFFSET only
+    void        SaveToImage(uint8_t* pImage, bool okWithRam = true);
+    // Load the state image; okWithRam = false loads everything before NEONIMAGE_RAM_OFFSET only.
+    // Re-allocates RAM if the image RAM size differs; returns false and keeps the state if the size is invalid.
+    bool        LoadFromImage(const uint8_t* pImage, bool okWithRam = true);
+    static uint32_t GetRamSizeForConfiguration(uint16_t conf);  // RAM size for the configuration
 private:  // Ports/devices: implementation
     uint16_t    m_PICflags;         // PIC 8259A flags, see PIC_Xxx constants
     uint8_t     m_PICRR;            // PIC interrupt request register
@@ -238,6 +322,9 @@ private:  // Ports/devices: implementation
     PIT8253     m_snd, m_snl;
     uint8_t     m_rtcalarmsec, m_rtcalarmmin, m_rtcalarmhour;
     uint8_t     m_rtcmemory[50];
+    time_t      m_rtcfixedtime;     // Fixed RTC time, or 0 to use the host time
+    uint8_t     m_serialin;         // 161060 DLBUF received byte
+    bool        m_serialinready;    // 161062 DLCSR bit 7, received byte not read yet
 private:
     void        ProcessPICWrite(bool a, uint8_t byte);
     uint8_t     ProcessPICRead(bool a);
@@ -245,17 +332,36 @@ private:
     void        UpdateInterrupts();
     uint8_t     ProcessRtcRead(uint16_t address) const;
     void        ProcessRtcWrite(uint16_t address, uint8_t byte);
+    void        GetRtcTime(struct tm* ptm) const;
     void        ProcessTimerWrite(uint16_t address, uint8_t byte);
     uint8_t     ProcessTimerRead(uint16_t address);
     void        ProcessKeyboardWrite(uint8_t byte);
     void        ProcessMouseWrite(uint8_t byte);
     void        DoSound();
+    void        LoadRAMChunk(uint32_t offset) const;
+    const uint8_t* GetPendingRAM(uint32_t offset) const;  // RAM to read, when some chunks are pending
+    uint8_t*    GetOwnROM();  // ROM to change; makes the own copy if the ROM is shared
+    uint8_t*    GetDiskCopy(uint32_t size);  // m_pDiskCopy of at least the size; nullptr if out of memory
+    void        CopyStateFrom(const CMotherboard* pSource);  // Copy the plain state, not the devices and RAM
+private:
+    mutable uint64_t m_RAMPendingMask;  // RAM chunks not loaded yet, see SetRAMChunkSource()
+    mutable RAMCHUNKCALLBACK m_RAMChunkCallback;
+    mutable void* m_RAMChunkParam;
+    mutable const uint8_t* const* m_RAMReadChunks;  // Pending chunks to read in place, or nullptr
+    mutable bool m_okRAMLoadFailed;  // See IsRAMLoadFailed()
+    uint64_t    m_RAMDirty[64];  // RAM pages written since ClearRAMDirtyMap(), 4096 KB max
+    uint64_t    m_RAMShadowDirty[64];  // RAM pages written since ClearRAMShadowMap()
 private:
     const uint16_t* m_CPUbps;  // CPU breakpoint list, ends with 177777 value
+    bool        m_okScratch;  // Scratch mode, see SetScratchMode()
+    bool        m_okFastDisk;  // Fast disk mode, see SetFastDiskMode()
     uint32_t    m_dwTrace;  // Trace flags
+    uint64_t    m_ticks;  // Board ticks done, see GetTicks()
+    int         m_soundBrasErr;  // Sound samples error accumulator for the current frame
 private:
     SOUNDGENCALLBACK m_SoundGenCallback;
     SERIALOUTCALLBACK m_SerialOutCallback;
+    void*       m_SerialOutParam;
     PARALLELOUTCALLBACK m_ParallelOutCallback;
 };
 
@@ -0,0 +1,264 @@
+﻿/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// DiskOverlay.cpp
+// Data shared by the cloned machines, and disk write overlays
+// See defines in header file Emubase.h
+
+#include "stdafx.h"
+#include "Emubase.h"
+#include <pthread.h>
+#ifdef EMUBASE_MMAP
+#include <sys/mman.h>
+#endif
+
+
+//////////////////////////////////////////////////////////////////////
+// CSharedData
+
+CSharedData* CSharedData::Create(uint8_t* pData, bool okOwned, size_t mapSize)
+{
+    CSharedData* pShared = new CSharedData();
+    pShared->refcount = 1;
+    pShared->pData = pData;
+    pShared->okOwned = okOwned;
+    pShared->mapsize = mapSize;
+    return pShared;
+}
+
+void CSharedData::Release()
+{
+    if (--refcount > 0)
+        return;
+
+#ifdef EMUBASE_MMAP
+    if (mapsize != 0)
+        ::munmap(pData, mapsize);
+    else
+#endif
+    if (okOwned)
+        ::free(pData);
+    delete this;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// CDiskOverlay
+// Open addressing hash table with linear probing, kept at most half full.
+
+#define DISK_OVERLAY_MIN_CAPACITY  64
+
+CDiskOverlay::CDiskOverlay()
+{
+    m_keys = nullptr;
+    m_sectors = nullptr;
+    m_capacity = 0;
+    m_count = 0;
+}
+
+CDiskOverlay::~CDiskOverlay()
+{
+    for (uint32_t i = 0; i < m_capacity; i++)
+        ::free(m_sectors[i]);
+    ::free(m_keys);
+    ::free(m_sectors);
+}
+
+// Slot of the sector, or the empty slot where it goes; m_capacity must be non-zero
+uint32_t CDiskOverlay::FindSlot(uint32_t sector) const
+{
+    uint32_t mask = m_capacity - 1;
+    uint32_t slot = (sector * 2654435761u) & mask;
+    while (m_keys[slot] != 0 && m_keys[slot] != sector + 1)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+const uint8_t* CDiskOverlay::Find(uint32_t sector) const
+{
+    if (m_count == 0)
+        return nullptr;
+
+    uint32_t slot = FindSlot(sector);
+    return (m_keys[slot] != 0) ? m_sectors[slot] : nullptr;
+}
+
+bool CDiskOverlay::Grow()
+{
+    uint32_t capacity = (m_capacity == 0) ? DISK_OVERLAY_MIN_CAPACITY : m_capacity * 2;
+    uint32_t* keys = static_cast<uint32_t*>(::calloc(capacity, sizeof(uint32_t)));
+    uint8_t** sectors = static_cast<uint8_t**>(::calloc(capacity, sizeof(uint8_t*)));
+    if (keys == nullptr || sectors == nullptr)
+    {
+        ::free(keys);  ::free(sectors);
+        return false;
+    }
+
+    uint32_t* oldkeys = m_keys;
+    uint8_t** oldsectors = m_sectors;
+    uint32_t oldcapacity = m_capacity;
+    m_keys = keys;
+    m_sectors = sectors;
+    m_capacity = capacity;
+    for (uint32_t i = 0; i < oldcapacity; i++)
+    {
+        if (oldkeys[i] == 0)
+            continue;
+        uint32_t slot = FindSlot(oldkeys[i] - 1);
+        m_keys[slot] = oldkeys[i];
+        m_sectors[slot] = oldsectors[i];
+    }
+    ::free(oldkeys);
+    ::free(oldsectors);
+    return true;
+}
+
+bool CDiskOverlay::Write(uint32_t sector, const uint8_t* src)
+{
+    if ((m_count + 1) * 2 > m_capacity && !Grow())
+        return false;
+
+    uint32_t slot = FindSlot(sector);
+    if (m_keys[slot] == 0)
+    {
+        uint8_t* pSector = static_cast<uint8_t*>(::malloc(DISK_OVERLAY_SECTOR_SIZE));
+        if (pSector == nullptr)
+            return false;
+        m_keys[slot] = sector + 1;
+        m_sectors[slot] = pSector;
+        m_count++;
+    }
+    ::memcpy(m_sectors[slot], src, DISK_OVERLAY_SECTOR_SIZE);
+    return true;
+}
+
+CDiskOverlay* CDiskOverlay::Clone() const
+{
+    CDiskOverlay* pClone = new CDiskOverlay();
+    for (uint32_t i = 0; i < m_capacity; i++)
+    {
+        if (m_keys[i] != 0 && !pClone->Write(m_keys[i] - 1, m_sectors[i]))
+        {
+            delete pClone;
+            return nullptr;
+        }
+    }
+    return pClone;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// CDiskShare
+// A generation starts with a Clone() after the owner wrote something; the clones made meanwhile share one.
+// A clone needs its generation and the newer ones, so the generations go from the oldest end only.
+
+struct CDiskShareGeneration
+{
+    CDiskOverlay sectors;   // Old data of the sectors the owner wrote over during the generation
+    int clones;             // Clones seeing the image as of the generation start
+    CDiskShareGeneration* pNext;  // The newer generation, nullptr for the latest
+};
+
+CDiskShare* CDiskShare::Create()
+{
+    CDiskShare* pShare = new CDiskShare();
+    pShare->m_refcount = 1;
+    pthread_mutex_t* pMutex = new pthread_mutex_t;
+    pthread_mutex_init(pMutex, nullptr);
+    pShare->m_pMutex = pMutex;
+    pShare->m_pOldest = pShare->m_pLatest = nullptr;
+    return pShare;
+}
+
+void CDiskShare::Release()
+{
+    if (--m_refcount > 0)
+        return;
+
+    while (m_pOldest != nullptr)
+    {
+        CDiskShareGeneration* pNext = m_pOldest->pNext;
+        delete m_pOldest;
+        m_pOldest = pNext;
+    }
+    pthread_mutex_t* pMutex = static_cast<pthread_mutex_t*>(m_pMutex);
+    pthread_mutex_destroy(pMutex);
+    delete pMutex;
+    delete this;
+}
+
+void CDiskShare::Lock()
+{
+    pthread_mutex_lock(static_cast<pthread_mutex_t*>(m_pMutex));
+}
+
+void CDiskShare::Unlock()
+{
+    pthread_mutex_unlock(static_cast<pthread_mutex_t*>(m_pMutex));
+}
+
+CDiskShareGeneration* CDiskShare::AddClone(CDiskShareGeneration* pFrom)
+{
+    CDiskShareGeneration* pGeneration = pFrom;
+    if (pGeneration == nullptr)
+    {
+        if (m_pLatest == nullptr || m_pLatest->sectors.GetCount() != 0)  // The owner wrote since, a new generation
+        {
+            pGeneration = new CDiskShareGeneration();
+            pGeneration->clones = 0;
+            pGeneration->pNext = nullptr;
+            if (m_pLatest != nullptr)
+                m_pLatest->pNext = pGeneration;
+            else
+                m_pOldest = pGeneration;
+            m_pLatest = pGeneration;
+        }
+        pGeneration = m_pLatest;
+    }
+    pGeneration->clones++;
+    return pGeneration;
+}
+
+void CDiskShare::RemoveClone(CDiskShareGeneration* pGeneration)
+{
+    pGeneration->clones--;
+    while (m_pOldest != nullptr && m_pOldest->clones == 0)
+    {
+        CDiskShareGeneration* pNext = m_pOldest->pNext;
+        delete m_pOldest;
+        m_pOldest = pNext;
+    }
+    if (m_pOldest == nullptr)
+        m_pLatest = nullptr;
+}
+
+bool CDiskShare::IsSectorNeeded(uint32_t sector) const
+{
+    return m_pLatest != nullptr && m_pLatest->sectors.Find(sector) == nullptr;
+}
+
+bool CDiskShare::KeepSector(uint32_t sector, const uint8_t* pOld)
+{
+    return m_pLatest->sectors.Write(sector, pOld);
+}
+
+const uint8_t* CDiskShare::FindSector(const CDiskShareGeneration* pGeneration, uint32_t sector) const
+{
+    for (; pGeneration != nullptr; pGeneration = pGeneration->pNext)
+    {
+        const uint8_t* pSector = pGeneration->sectors.Find(sector);
+        if (pSector != nullptr)
+            return pSector;
+    }
+    return nullptr;
+}
+
+
+//////////////////////////////////////////////////////////////////////
@@ -12,6 +12,7 @@ NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
 
 #pragma once
 
+#include <atomic>
 #include "Board.h"
 #include "Processor.h"
 
@@ -47,12 +48,264 @@ int Disasm_GetInstructionHint(
     LPTSTR buffer, LPTSTR buffer2);
 
 
+//////////////////////////////////////////////////////////////////////
+// Emulator state image, see StateImage.cpp
+
+#define STATEIMAGE_MAX_THREADS    16
+
+// Set the number of threads to compress/decompress RAM chunks, including the caller; 1 = no extra threads.
+// Without thread support in the build, it stays single-threaded. The images do not depend on the thread count.
+void StateImage_SetThreadCount(int count);
+
+// Register the ROM image saved in state images by hash only, instead of the 16 KB of data;
+// the image is not copied and must stay in place
+void StateImage_AddKnownRom(const uint8_t* pRom);
+
+// Get the buffer size enough for StateImage_Save() or StateImage_SaveDelta()
+uint32_t StateImage_GetMaxSize(const CMotherboard* pBoard);
+
+// Save the board state as the version 2.0 image; returns the image size, or 0 on failure
+uint32_t StateImage_Save(CMotherboard* pBoard, uint32_t uptime, uint8_t* pBuffer, uint32_t bufferSize);
+
+// Save the delta image: the state with RAM pages written since ClearRAMDirtyMap() only; the caller clears the map
+// for the next delta, see CRewindBuffer::Capture(). Returns the image size, or 0 on failure.
+uint32_t StateImage_SaveDelta(CMotherboard* pBoard, uint32_t uptime, uint8_t* pBuffer, uint32_t bufferSize);
+
+// Load the board state from the version 1.0 or 2.0 image, or apply the delta image over the state it was taken from
+//   pUptime - receives the machine uptime from the image header, could be nullptr
+//   okLazy  - for version 2.0, decompress every RAM chunk on the first access to it, from the image in place:
+//             the data must stay until the board RAM is replaced or all the chunks are loaded, see okTakeOwnership;
+//             a broken chunk is found on the access then, see CMotherboard::IsRAMLoadFailed()
+//   okTakeOwnership - pData is malloc'ed and given to the function: kept for the lazy loaded RAM chunks and freed
+//             with them, or freed at once otherwise, on failure too
+//   Return value: false if the image is wrong; the board state is kept if the failure was found before changing it
+bool StateImage_Load(CMotherboard* pBoard, const uint8_t* pData, uint32_t dataSize, uint32_t* pUptime,
+        bool okLazy, bool okTakeOwnership);
+
+
+//////////////////////////////////////////////////////////////////////
+// CRewindBuffer
+
+#define REWIND_MAX_ENTRIES     1024
+
+// Rewind buffer: the board state captured every few frames, as keyframe images followed by delta images.
+// Relies on the board RAM dirty map, so nobody else should take deltas or clear the map while it is in use.
+class CRewindBuffer
+{
+protected:
+    struct RewindEntry
+    {
+        uint8_t* pData;         // State image, see StateImage.cpp
+        uint32_t size;
+        uint32_t uptime;
+        bool     okKey;         // Keyframe, or delta over the previous entry
+    };
+    RewindEntry m_entries[REWIND_MAX_ENTRIES];  // From the oldest to the newest
+    int      m_count;           // Number of entries
+    uint32_t m_used;            // Bytes used by all the entries
+    uint32_t m_budget;          // Memory budget in bytes; 0 = rewind is off
+    int      m_interval;        // Capture every N frames
+    int      m_keyinterval;     // Keyframe after N deltas
+    int      m_framecount;      // Frames since the last capture or restore
+    int      m_deltacount;      // Deltas since the newest keyframe
+    uint8_t* m_pScratch;        // Buffer to save the image to, before it gets its exact size
+    uint32_t m_scratchsize;
+
+public:
+    CRewindBuffer();
+    ~CRewindBuffer();
+    // Set memory budget (0 = off), capture interval in frames, and number of deltas between keyframes; clears the buffer
+    void SetParams(uint32_t budget, int interval, int keyinterval);
+    // Drop all the entries; call it when the board state is replaced from outside
+    void Clear();
+    // Call it after every frame; captures the state every N frames. Returns true if captured.
+    bool Frame(CMotherboard* pBoard, uint32_t uptime);
+    // Step backwards: restore the newest captured state, or the one before if there were no frames since it.
+    // Returns false if there is nothing to restore.
+    bool StepBack(CMotherboard* pBoard, uint32_t* pUptime);
+    int  GetCount() const { return m_count; }
+    uint32_t GetUsedBytes() const { return m_used; }
+
+private:
+    bool Capture(CMotherboard* pBoard, uint32_t uptime);
+    bool Thin();                // Drop some older entries to free the memory
+    void RemoveEntries(int index, int count);
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// CRunAhead
+
+// Run-ahead: emulate a few frames ahead of the board state to present the frame with less input lag, then roll back.
+// The rollback is delta-based: RAM copy is kept in sync by the board RAM shadow map, only written pages are copied.
+class CRunAhead
+{
+protected:
+    int      m_frames;          // Frames to run ahead; 0 = off
+    uint8_t* m_pState;          // Board state without RAM, NEONIMAGE_RAM_OFFSET bytes
+    uint8_t* m_pShadow;         // RAM copy as of the last Sync()
+    uint32_t m_shadowsize;
+    bool     m_okShadowValid;   // false = copy the whole RAM on the next Sync()
+    bool     m_okAhead;         // Between Start() and Rollback()
+    uint64_t m_dirtysaved[64];  // Board RAM dirty map saved by Start()
+    uint64_t m_tickssaved;      // Board ticks saved by Start()
+
+public:
+    CRunAhead();
+    ~CRunAhead();
+    // Set number of frames to run ahead, 0 = off
+    void SetFrames(int frames);
+    int  GetFrames() const { return m_frames; }
+    // Call it when the board state is replaced from outside, not by the frames: image loaded, rewind etc.
+    void Invalidate() { m_okShadowValid = false; }
+    // Call it after every frame; takes the pages written since the previous call, and clears the board RAM shadow map
+    void Sync(CMotherboard* pBoard);
+    // Save the state and run N frames ahead in the board scratch mode; returns false if off or failed
+    bool Start(CMotherboard* pBoard);
+    // Return the board to the state saved by Start(), the board ticks and the RAM dirty map too
+    void Rollback(CMotherboard* pBoard);
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// CSerialLink
+
+// Serial link of two machines: DLBUF output of each one comes to DLBUF input of the other one, one byte per byte time.
+// Run() runs the machines on their own threads, with conservative time sync on the board ticks: a machine is never
+// ahead of the other one for more than the byte time, so every byte comes at the same tick of the receiver
+// on every run, no matter how the threads go. Without thread support in the build, the machines take turns.
+class CSerialLink
+{
+protected:
+    struct Side
+    {
+        CSerialLink* pLink;
+        CMotherboard* pBoard;
+        uint64_t tickbase;      // Board ticks when the link was made
+        uint64_t ticks;         // Link time: board ticks run since the link was made
+        uint64_t target;        // Link time to run to
+        uint64_t lastarrival;   // Arrival time of the last byte sent, the wire carries one byte at a time
+        uint64_t* pQueue;       // Bytes on the way to the other side: (arrival time << 8) | byte, by arrival time
+        int      queuehead, queuecount, queuesize;
+        bool     okStopped;     // Stopped on a breakpoint
+    };
+    Side     m_sides[2];
+    int      m_bytetime;        // Board ticks per byte, also the link delay and the max time skew
+    void*    m_pSync;           // Mutex and condition guarding the sides, see SerialLink.cpp
+
+public:
+    // Connect the serial ports of the boards; the boards should not be run by anybody else while linked
+    CSerialLink(CMotherboard* pBoard1, CMotherboard* pBoard2, int baudRate = 9600);
+    ~CSerialLink();  // Disconnect the boards; the bytes on the way are lost
+    // Run both machines for the given number of board ticks; returns false if a machine stopped on a breakpoint
+    bool Run(uint64_t ticks);
+    bool RunFrames(int frames) { return Run((uint64_t)frames * NEON_FRAME_TICKS); }
+    int  GetByteTime() const { return m_bytetime; }
+protected:
+    bool RunSide(int side, bool okWait);  // Run the side to its target; returns false if has to wait and okWait = false
+    static void CALLBACK OnSerialOutput(void* param, uint8_t byte);
+    static void* ThreadProc(void* param);
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// Data shared by the cloned machines, see CMotherboard::Clone() and DiskOverlay.cpp
+
+// Memory-mapped disk images, for the native POSIX builds; see CFloppyController::AttachImageMapped()
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#define EMUBASE_MMAP
+#endif
+
+// Read-only data block with the reference counter, freed with the last reference
+struct CSharedData
+{
+    std::atomic<int> refcount;
+    uint8_t* pData;
+    bool okOwned;  // pData is freed with the last reference
+    size_t mapsize;  // pData is the memory mapping of the size, unmapped with the last reference; 0 if not mapped
+
+public:
+    // Takes ownership of the malloc'ed data, unless okOwned is false, or of the mapping if mapSize != 0; refcount = 1
+    static CSharedData* Create(uint8_t* pData, bool okOwned = true, size_t mapSize = 0);
+    void AddRef() { refcount++; }
+    void Release();
+};
+
+#define DISK_OVERLAY_SECTOR_SIZE  512
+
+// Per-machine write overlay over a disk image shared by the cloned machines: written sectors, by sector number
+class CDiskOverlay
+{
+protected:
+    uint32_t* m_keys;           // Sector number + 1 for every slot; 0 = empty slot
+    uint8_t** m_sectors;        // Sector data for every slot
+    uint32_t  m_capacity;       // Number of slots, power of two
+    uint32_t  m_count;          // Number of sectors written
+
+public:
+    CDiskOverlay();
+    ~CDiskOverlay();
+    // Get the written sector data, or nullptr if the sector was not written
+    const uint8_t* Find(uint32_t sector) const;
+    // Store DISK_OVERLAY_SECTOR_SIZE bytes of the sector; returns false if out of memory
+    bool Write(uint32_t sector, const uint8_t* src);
+    uint32_t GetCount() const { return m_count; }
+    // Copy of the overlay, for the clone to diverge independently; nullptr if out of memory
+    CDiskOverlay* Clone() const;
+
+private:
+    uint32_t FindSlot(uint32_t sector) const;
+    bool Grow();
+};
+
+struct CDiskShareGeneration;
+
+// Disk image shared by the machine owning it and its clones. The owner keeps writing the image in place, so its
+// file or buffer stays saved; before it writes a sector over, the old data goes to the latest generation.
+// A clone sees the image as of its Clone(): its generation, the newer ones, then the image itself.
+// The owner's writes and the clones' reads of the image go under Lock(), as they could run on different threads.
+class CDiskShare
+{
+protected:
+    std::atomic<int> m_refcount;
+    void*    m_pMutex;          // Guards the generations and the image, see DiskOverlay.cpp
+    CDiskShareGeneration* m_pOldest;  // The generations a clone still sees, oldest first; nullptr if none
+    CDiskShareGeneration* m_pLatest;
+
+public:
+    static CDiskShare* Create();  // refcount = 1, for the owner
+    void AddRef() { m_refcount++; }
+    void Release();
+    void Lock();
+    void Unlock();
+    // The rest is called with the lock held.
+    // Register a clone of the owner (pFrom == nullptr) or of the clone seeing pFrom; returns the clone's generation
+    CDiskShareGeneration* AddClone(CDiskShareGeneration* pFrom);
+    void RemoveClone(CDiskShareGeneration* pGeneration);
+    // For the owner: the sector old data has to be kept before the write, see KeepSector()
+    bool IsSectorNeeded(uint32_t sector) const;
+    // Keep DISK_OVERLAY_SECTOR_SIZE bytes of the old data; returns false if out of memory, the write must fail then
+    bool KeepSector(uint32_t sector, const uint8_t* pOld);
+    // For the clone: the sector data as of the generation start, or nullptr to read the image
+    const uint8_t* FindSector(const CDiskShareGeneration* pGeneration, uint32_t sector) const;
+
+private:
+    CDiskShare() { }
+    ~CDiskShare() { }
+};
+
+
 //////////////////////////////////////////////////////////////////////
 // CFloppy
 
 class CMotherboard;
 
+#define EMUBASE_TIMER_OFF  ((uint64_t)-1)  // Device timer not armed, see CFloppyController::GetTimerTick()
+
 #define FLOPPY_MAX_TRACKS       83
+#define FLOPPY_MAX_BLOCKS       (FLOPPY_MAX_TRACKS * 2 * 10)  // 512-byte blocks on the disk
+
+#define FLOPPY_IMAGE_SIZE      64  // Floppy controller state size in the emulator image
 
 #define FLOPPY_PHASE_CMD        1
 #define FLOPPY_PHASE_EXEC       2
@@ -92,21 +345,38 @@ class CMotherboard;
 
 struct CFloppyDrive
 {
-    FILE*    fpFile;
-    uint8_t* data;          // Data image for the whole disk
+    FILE*    fpFile;        // Image file; nullptr for the cloned machine, its writes stay in the overlay
+    uint8_t* data;          // Data image for the whole disk; read-only for the cloned machine
+    bool     okOwnData;     // The data is freed on detach; false for the host buffer, see AttachImageBuffer()
+    size_t   mapsize;       // The data is the memory mapping of the size, see AttachImageMapped(); 0 if not mapped
+    uint32_t mapfilesize;   // Part of the data mapped to the file with MAP_SHARED, saved by the system; 0 if none
     uint32_t datasize;
+    uint32_t loadedsize;    // Data loaded so far while the image streams in; datasize when all loaded
     uint32_t dirtystart, dirtyend;  // Range of unsaved data; dirtyend == 0 means everything saved
-    uint16_t dirtycount;
+    uint32_t dirtymap[(FLOPPY_MAX_BLOCKS + 31) / 32];  // Unsaved blocks within the range, bit per block
+    uint64_t flushtick;     // Board tick to flush the unsaved data at, see CFloppyController::Periodic(); 0 if none
+    bool     okFlushDue;    // The delay is over, to flush at the frame end, see CFloppyController::FlushDue()
+    uint32_t hostdirtystart, hostdirtyend;  // Range written since the host took it, overlay too; 0, 0 if none
     bool     okReadOnly;    // Write protection flag
+    CSharedData* shared;    // The data shared with the cloned machines; nullptr if not shared
+    CDiskOverlay* overlay;  // Blocks written by the cloned machine, or in the scratch mode; nullptr if none
+    CDiskShare* share;      // The blocks the cloned machines see, see CDiskShare; nullptr if not shared
+    CDiskShareGeneration* sharegen;  // The data generation the cloned machine sees; nullptr for the owner
 
 public:
     CFloppyDrive();
     void Reset();           // Reset the device
 
+    void ReadBlock(uint16_t block, uint8_t* pDest) const;  // Copy 512 bytes of the block
     void WriteBlock(uint16_t block, const uint8_t* src);
+    // Share the data with the cloned machine's drive; this drive goes on writing the data in place.
+    // Returns false if out of memory, pDest gets nothing then.
+    bool CloneTo(CFloppyDrive* pDest);
 
     bool IsDirty() const { return dirtyend != 0; }  // Has unsaved data
-    void Flush();  // Save any unsaved data
+    void Flush();  // Save any unsaved data, the runs of the adjacent unsaved blocks one write each
+private:
+    void SaveRun(uint32_t start, uint32_t end);
 };
 
 // Floppy controller
@@ -124,11 +394,17 @@ protected:
     uint8_t  m_result[9];   // Buffer for command result bytes
     uint8_t  m_resultlen;
     uint8_t  m_resultpos;   // Current position in the result buffer
+    uint8_t  m_pendingcmd;  // Command waiting in the execution phase for its track to stream in; 0 if none
+    uint64_t m_timertick;   // Board tick of the next Periodic() call, see ArmTimer(); EMUBASE_TIMER_OFF if idle
     uint8_t  m_track;       // Track number: 0 to 79
     uint8_t  m_side;        // Disk side: 0 or 1
     bool     m_int;         // Interrupt flag
     bool     m_motor;       // Motor on/off
     bool     m_okTrace;     // Trace mode on/off
+    bool     m_okScratch;   // Scratch mode, see SetScratchMode()
+    CFloppyDrive m_scratchdrives[4];  // Drives saved on entering the scratch mode
+    uint64_t m_scratchticks;  // Board tick of entering the scratch mode
+    uint8_t  m_scratchimage[FLOPPY_IMAGE_SIZE];  // Controller state saved on entering the scratch mode
 
 public:
     CFloppyController(CMotherboard* pBoard);
@@ -138,10 +414,32 @@ public:
 public:
     // Attach the image to the drive - insert disk
     bool AttachImage(int drive, LPCTSTR sFileName);
+    // Attach the image mapped to memory: near-instant, the pages are read on demand and shared by all the machines
+    // using the same file. okPersistent: the writes go to the file (MAP_SHARED); otherwise the writes stay
+    // in memory (MAP_PRIVATE, copy-on-write), for the scratch or read-only runs. Reads the file as AttachImage()
+    // if the mapping is not available.
+    bool AttachImageMapped(int drive, LPCTSTR sFileName, bool okPersistent);
+    // Attach the empty image to fill in while it streams in, e.g. downloaded; returns the data buffer to write
+    // the image to, of *pSize bytes, or nullptr on failure. The commands wait for their tracks to be loaded.
+    uint8_t* AttachStreamImage(int drive, uint32_t* pSize);
+    // Attach the image in the host buffer, size bytes: the drive reads and writes the buffer in place, no file.
+    // With okTakeOwnership the malloc'ed buffer is the drive's, it could be reallocated to the disk size;
+    // otherwise the buffer should cover the whole disk and stay till detach.
+    bool AttachImageBuffer(int drive, uint8_t* pData, uint32_t size, bool okTakeOwnership);
+    // The image data of the drive, nullptr if not attached
+    const uint8_t* GetImageBuffer(int drive) const { return m_drivedata[drive].data; }
+    // The image buffer holds all the writes: none kept in the overlay, see CFloppyDrive::overlay
+    bool IsImageBufferCurrent(int drive) const { return m_drivedata[drive].overlay == nullptr; }
+    // Copy the image data of the block-aligned [start, end) range, with the writes kept in the overlay
+    void ReadImageData(int drive, uint32_t start, uint32_t end, uint8_t* pDest) const;
+    // Take the range of the image data written since the last call, to save it; returns false if none
+    bool TakeDirtyRange(int drive, uint32_t* pStart, uint32_t* pEnd);
+    // Set the size of the image data written to the buffer so far; with okDone, the rest of the image is empty
+    void SetStreamLoaded(int drive, uint32_t loadedSize, bool okDone);
     // Detach image from the drive - remove disk
     void DetachImage(int drive);
     // Check if the drive has an image attached
-    bool IsAttached(int drive) const { return (m_drivedata[drive].fpFile != nullptr); }
+    bool IsAttached(int drive) const { return (m_drivedata[drive].data != nullptr); }
     // Check if the drive's attached image is read-only
     bool IsReadOnly(int drive) const { return m_drivedata[drive].okReadOnly; }
     // Check if floppy engine now rotates
@@ -152,15 +450,29 @@ public:
     uint16_t GetStateView() const { return m_state; }  // Get status value for debugger
     void     FifoWrite(uint8_t cmd);  // Writing commands
     uint8_t  FifoRead();
-    void Periodic();            // Rotate disk; call it each 64 us - 15625 times per second
+    // Board tick to call Periodic() at: while a command waits for its track, and when a flush delay is over
+    uint64_t GetTimerTick() const { return m_timertick; }
+    void Periodic();            // Rotate disk: run the timer work that is due, arm the timer for the next one
+    // Save the data of the drives whose flush delay is over; call it at the frame end, off the guest I/O path
+    void FlushDue();
     bool CheckInterrupt() const { return m_int; }
     void SetTrace(bool okTrace) { m_okTrace = okTrace; }  // Set trace mode on/off
+public:  // Saving/loading emulator status
+    void SaveToImage(uint8_t* pImage) const;  // Save controller state, FLOPPY_IMAGE_SIZE bytes
+    void LoadFromImage(const uint8_t* pImage);
+    // Copy of the controller for the cloned board, sharing the attached images; nullptr on failure.
+    // See CMotherboard::Clone().
+    CFloppyController* Clone(CMotherboard* pBoard);
+    // Scratch mode: writes go to temporary overlays; leaving the mode drops them and restores the state
+    void SetScratchMode(bool okScratch);
 
 private:
     uint8_t CheckCommand();
+    bool IsCommandTrackLoaded() const;
     void StartCommand(uint8_t cmd);
     void ExecuteCommand(uint8_t cmd);
     void FlushChanges();  // Save all unsaved data
+    void ArmTimer(uint64_t fromTick);  // Set m_timertick for the work left, at or after the tick
 };
 
 
@@ -174,6 +486,15 @@ class CHardDrive
 {
 protected:
     FILE*   m_fpFile;           // File pointer for the attached HDD image
+    LPTSTR  m_sFileName;        // The image file name, to open it for the cloned machine
+    uint8_t* m_pData;           // The image in the host buffer instead of the file, see AttachImageBuffer()
+    uint32_t m_datasize;
+    bool    m_okOwnData;        // m_pData is freed on detach
+    CSharedData* m_pShared;     // m_pData shared with the cloned machines; nullptr if not shared
+    uint32_t m_dirtystart, m_dirtyend;  // Range of m_pData written since the host took it, overlay too; 0, 0 if none
+    CDiskOverlay* m_pOverlay;   // Sectors written by the cloned machine, or in the scratch mode; nullptr if none
+    CDiskShare* m_pShare;       // The image shared with the cloned machines; nullptr if not shared
+    CDiskShareGeneration* m_pShareGeneration;  // The image generation the cloned machine sees; nullptr for the owner
     bool    m_okReadOnly;       // Flag indicating that the HDD image file is read-only
     uint8_t m_status;           // IDE status register, see IDE_STATUS_XXX constants
     uint8_t m_error;            // IDE error register, see IDE_ERROR_XXX constants
@@ -187,28 +508,48 @@ protected:
     int     m_sectorcount;      // Sector counter for read/write operations
     uint8_t m_buffer[IDE_DISK_SECTOR_SIZE];  // Sector data buffer
     int     m_bufferoffset;     // Current offset within sector: 0..511
-    int     m_timeoutcount;     // Timeout counter to wait for the next event
+    uint64_t m_timeouttick;     // Board tick of the next event, see Timeout(); EMUBASE_TIMER_OFF if none
     int     m_timeoutevent;     // Current stage of operation, see TimeoutEvent enum
+    CHardDrive* m_pScratchSaved;  // State saved on entering the scratch mode, or nullptr
+    uint64_t m_scratchticks;    // Board tick of entering the scratch mode
+    CMotherboard* m_pBoard;
 
 public:
-    CHardDrive();
+    CHardDrive(CMotherboard* pBoard);
     ~CHardDrive();
     // Reset the device.
     void Reset();
     // Attach HDD image file to the device
     bool AttachImage(LPCTSTR sFileName);
+    // Attach the image in the host buffer, size bytes, read and written in place; see CFloppyController::AttachImageBuffer()
+    bool AttachImageBuffer(uint8_t* pData, uint32_t size, bool okTakeOwnership);
+    // The image data in the host buffer, nullptr if not attached that way
+    const uint8_t* GetImageBuffer() const { return m_pData; }
+    // The image buffer holds all the writes: none kept in the overlay
+    bool IsImageBufferCurrent() const { return m_pOverlay == nullptr; }
+    // Copy the image data of the sector-aligned [start, end) range, with the writes kept in the overlay
+    void ReadImageData(uint32_t start, uint32_t end, uint8_t* pDest);
+    // Take the range of the buffer written since the last call, to save it; returns false if none
+    bool TakeDirtyRange(uint32_t* pStart, uint32_t* pEnd);
     // Detach HDD image file from the device
     void DetachImage();
     // Check if the attached hard drive image is read-only
     bool IsReadOnly() const { return m_okReadOnly; }
+    // Copy of the device for the cloned board, sharing the image; nullptr on failure. This device goes on
+    // writing the image in place; the copy sees the image as of now, and keeps its writes in its overlay.
+    CHardDrive* Clone(CMotherboard* pBoard);
+    // Scratch mode: writes go to a temporary overlay; leaving the mode drops them and restores the state
+    void SetScratchMode(bool okScratch);
 
 public:
     // Read word from the device port
     uint16_t ReadPort(uint16_t port);
     // Write word th the device port
     void WritePort(uint16_t port, uint16_t data);
-    // Rotate disk
-    void Periodic();
+    // Board tick of the next event; the board calls Timeout() then
+    uint64_t GetTimerTick() const { return m_timeouttick; }
+    // The event armed is due: finish the current stage of operation
+    void Timeout();
 
 private:
     uint32_t CalculateOffset() const;  // Calculate sector offset in the HDD image
@@ -216,10 +557,16 @@ private:
     void ReadNextSector();
     void ReadSectorDone();
     void WriteSectorDone();
+    size_t ReadSector(uint32_t lba, uint8_t* pDest);  // Read the sector as this device sees it; returns the bytes read
+    void MarkDirty(uint32_t offset);
+    size_t ReadImageSector(uint32_t lba, uint8_t* pDest);  // Read the sector from the image itself
+    size_t WriteImageSector(uint32_t lba, const uint8_t* pSrc);  // Write the sector to the image itself
     void NextSector();          // Advance to the next sector, CHS-based
     void ContinueRead();
     void ContinueWrite();
+    void ArmTimeout(int ticks, int event);  // The event in the ticks, counting the current one
     void IdentifyDrive();       // Prepare m_buffer for the IDENTIFY DRIVE command
+    void CopyStateFrom(const CHardDrive* pSource);  // Copy the controller state, not the image
 };
 
 
@@ -16,6 +16,12 @@ NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
 #include <sys/types.h>
 #include <sys/stat.h>
 #include "Emubase.h"
+#ifdef EMUBASE_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#define FLOPPY_FLUSH_DELAY  (3 * 25 * NEON_FRAME_TICKS)  // 3 sec in board ticks, the delay after the last write
 
 
 //////////////////////////////////////////////////////////////////////
@@ -26,8 +32,18 @@ CFloppyDrive::CFloppyDrive()
     fpFile = nullptr;
     okReadOnly = false;
     data = nullptr;
-    datasize = dirtystart = dirtyend = 0;
-    dirtycount = 0;
+    okOwnData = false;
+    mapsize = 0;
+    mapfilesize = 0;
+    datasize = loadedsize = dirtystart = dirtyend = 0;
+    ::memset(dirtymap, 0, sizeof(dirtymap));
+    flushtick = 0;
+    okFlushDue = false;
+    hostdirtystart = hostdirtyend = 0;
+    shared = nullptr;
+    overlay = nullptr;
+    share = nullptr;
+    sharegen = nullptr;
 }
 
 void CFloppyDrive::Reset()
@@ -35,15 +51,56 @@ void CFloppyDrive::Reset()
     Flush();
 }
 
+void CFloppyDrive::ReadBlock(uint16_t block, uint8_t* pDest) const
+{
+    const uint8_t* pBlock = (overlay != nullptr) ? overlay->Find(block) : nullptr;
+    if (pBlock != nullptr)
+        ::memcpy(pDest, pBlock, 512);
+    else if (sharegen != nullptr)  // The cloned machine sees the data as of the clone time
+    {
+        share->Lock();
+        pBlock = share->FindSector(sharegen, block);
+        ::memcpy(pDest, (pBlock != nullptr) ? pBlock : data + (uint32_t)block * 512, 512);
+        share->Unlock();
+    }
+    else
+        ::memcpy(pDest, data + (uint32_t)block * 512, 512);
+}
+
 void CFloppyDrive::WriteBlock(uint16_t block, const uint8_t* src)
 {
     uint32_t offset = (uint32_t)block * 512;
-    //TODO: Check if offset is out of range
-    ::memcpy(data + offset, src, 512);
+    if (offset + 512 > datasize)
+        return;
+    if (overlay != nullptr)  // The cloned machine or the scratch mode, keep the data intact
+    {
+        if (!overlay->Write(block, src))
+            return;
+    }
+    else
+    {
+        if (share != nullptr)  // The cloned machines see the data as it was, keep the old data for them
+        {
+            share->Lock();
+            bool okKept = !share->IsSectorNeeded(block) || share->KeepSector(block, data + offset);
+            if (okKept)
+                ::memcpy(data + offset, src, 512);
+            share->Unlock();
+            if (!okKept)
+                return;
+        }
+        else
+            ::memcpy(data + offset, src, 512);
+    }
+    // The overlay writes count too, the scratch mode rolls the range back along with the drive
+    if (hostdirtyend == 0 || offset < hostdirtystart)
+        hostdirtystart = offset;
+    if (hostdirtyend < offset + 512) hostdirtyend = offset + 512;
     if (dirtyend == 0 || offset < dirtystart)
         dirtystart = offset;
     if (dirtyend < offset + 512) dirtyend = offset + 512;
-    dirtycount = 15625 * 3;  // 3 sec
+    dirtymap[block / 32] |= 1u << (block % 32);
+    okFlushDue = false;  // The controller sets the flush delay, see CFloppyController::ExecuteCommand()
 }
 
 void CFloppyDrive::Flush()
@@ -53,13 +110,105 @@ void CFloppyDrive::Flush()
 
     //DebugLogFormat(_T("Floppy FLUSH %lu:%lu\n"), dirtystart, dirtyend);
 
-    ::fseek(fpFile, dirtystart, SEEK_SET);
-    size_t bytesToWrite = dirtyend - dirtystart;
-    ::fwrite(data + dirtystart, 1, bytesToWrite, fpFile);
-    //TODO: check for bytes written
+    if (fpFile != nullptr)  // No file for the cloned machine, the changes stay in the overlay
+    {
+        uint32_t block = dirtystart / 512;
+        uint32_t blockend = dirtyend / 512;
+        while (block < blockend)
+        {
+            if (dirtymap[block / 32] == 0)  // Skip the clean 32 blocks at once
+            {
+                block = (block | 31) + 1;
+                continue;
+            }
+            if ((dirtymap[block / 32] & (1u << (block % 32))) == 0)
+            {
+                block++;
+                continue;
+            }
+            uint32_t runstart = block;
+            while (block < blockend && (dirtymap[block / 32] & (1u << (block % 32))) != 0)
+                block++;
+            SaveRun(runstart * 512, block * 512);
+        }
+    }
 
+    ::memset(dirtymap, 0, sizeof(dirtymap));
     dirtystart = dirtyend = 0;
-    dirtycount = 0;
+    flushtick = 0;
+    okFlushDue = false;
+}
+
+// Save the data range to the file
+void CFloppyDrive::SaveRun(uint32_t start, uint32_t end)
+{
+#ifdef EMUBASE_MMAP
+    if (start < mapfilesize)  // The mapping saves the file part by itself
+    {
+        uint32_t pagemask = (uint32_t)::sysconf(_SC_PAGESIZE) - 1;
+        uint32_t syncstart = start & ~pagemask;
+        uint32_t syncend = (end < mapfilesize) ? end : mapfilesize;
+        ::msync(data + syncstart, syncend - syncstart, MS_ASYNC);
+        start = mapfilesize;
+    }
+#endif
+    if (start >= end)
+        return;
+
+    ::fseek(fpFile, start, SEEK_SET);
+    ::fwrite(data + start, 1, end - start, fpFile);
+    //TODO: check for bytes written
+}
+
+bool CFloppyDrive::CloneTo(CFloppyDrive* pDest)
+{
+    ASSERT(pDest->data == nullptr);
+    if (data == nullptr)
+        return true;
+
+    if (mapfilesize != 0)  // The data changes with the file, so the clone gets a copy
+    {
+        uint8_t* pData = (uint8_t*)::malloc(datasize);
+        if (pData == nullptr)
+            return false;
+        for (uint32_t offset = 0; offset < datasize; offset += 512)
+            ReadBlock((uint16_t)(offset / 512), pData + offset);
+
+        pDest->fpFile = nullptr;
+        pDest->data = pData;
+        pDest->okOwnData = true;
+        pDest->datasize = datasize;
+        pDest->loadedsize = loadedsize;
+        pDest->okReadOnly = okReadOnly;
+        return true;
+    }
+
+    CDiskOverlay* pOverlay = (overlay != nullptr) ? overlay->Clone() : new CDiskOverlay();
+    if (pOverlay == nullptr)
+        return false;
+
+    if (shared == nullptr)  // The data goes with the last drive sharing it
+        shared = CSharedData::Create(data, okOwnData, mapsize);
+    shared->AddRef();
+    if (share == nullptr)
+        share = CDiskShare::Create();
+    share->AddRef();
+    share->Lock();
+    pDest->sharegen = share->AddClone(sharegen);
+    share->Unlock();
+    pDest->share = share;
+    pDest->fpFile = nullptr;
+    pDest->data = data;
+    pDest->okOwnData = okOwnData;
+    pDest->mapsize = mapsize;
+    pDest->datasize = datasize;
+    pDest->loadedsize = loadedsize;
+    pDest->dirtystart = pDest->dirtyend = 0;
+    pDest->flushtick = 0;
+    pDest->okReadOnly = okReadOnly;
+    pDest->shared = shared;
+    pDest->overlay = pOverlay;
+    return true;
 }
 
 
@@ -77,11 +226,16 @@ CFloppyController::CFloppyController(CMotherboard* pBoard)
     m_state = FLOPPY_STATE_IDLE;
     m_int = m_motor = false;
     m_commandlen = m_resultlen = m_resultpos = 0;
+    m_pendingcmd = 0;
+    m_timertick = EMUBASE_TIMER_OFF;
     m_okTrace = false;
+    m_okScratch = false;
+    m_scratchticks = 0;
 }
 
 CFloppyController::~CFloppyController()
 {
+    SetScratchMode(false);
     for (int drive = 0; drive < 4; drive++)
         DetachImage(drive);
 }
@@ -98,6 +252,8 @@ void CFloppyController::Reset()
     m_state = FLOPPY_STATE_IDLE;
     m_int = false;
     m_commandlen = m_resultlen = m_resultpos = 0;
+    m_pendingcmd = 0;
+    ArmTimer(m_pBoard->GetTicks());
 }
 
 bool CFloppyController::AttachImage(int drive, LPCTSTR sFileName)
@@ -105,7 +261,7 @@ bool CFloppyController::AttachImage(int drive, LPCTSTR sFileName)
     ASSERT(sFileName != nullptr);
 
     // If image attached - detach one first
-    if (m_drivedata[drive].fpFile != nullptr)
+    if (m_drivedata[drive].data != nullptr)
         DetachImage(drive);
 
     // Open file
@@ -121,6 +277,7 @@ bool CFloppyController::AttachImage(int drive, LPCTSTR sFileName)
 
     size_t imageSize = FLOPPY_MAX_TRACKS * 2 * 10 * 512;
     m_drivedata[drive].data = (uint8_t*)::calloc(imageSize, 1);
+    m_drivedata[drive].okOwnData = true;
 
     ::fseek(m_drivedata[drive].fpFile, 0, SEEK_END);
     size_t fileSize = (size_t)::ftell(m_drivedata[drive].fpFile);
@@ -135,26 +292,284 @@ bool CFloppyController::AttachImage(int drive, LPCTSTR sFileName)
         return false;
     }
 
+    m_drivedata[drive].datasize = m_drivedata[drive].loadedsize = imageSize;
+
+    m_side = m_track = 0;
+
+    return true;
+}
+
+bool CFloppyController::AttachImageMapped(int drive, LPCTSTR sFileName, bool okPersistent)
+{
+    ASSERT(sFileName != nullptr);
+
+#ifdef EMUBASE_MMAP
+    if (m_drivedata[drive].data != nullptr)
+        DetachImage(drive);
+
+    bool okReadOnly = false;
+    FILE* fpFile = okPersistent ? ::_tfopen(sFileName, _T("r+b")) : nullptr;
+    if (fpFile == nullptr)
+    {
+        okReadOnly = okPersistent;
+        fpFile = ::_tfopen(sFileName, _T("rb"));
+    }
+    if (fpFile == nullptr)
+        return false;
+    bool okShared = okPersistent && !okReadOnly;
+
+    // The anonymous zero mapping for the whole disk, with the file mapped over its beginning
+    uint32_t imageSize = FLOPPY_MAX_TRACKS * 2 * 10 * 512;
+    size_t pagemask = (size_t)::sysconf(_SC_PAGESIZE) - 1;
+    size_t mapSize = (imageSize + pagemask) & ~pagemask;
+    struct stat st;
+    size_t fileSize = (::fstat(::fileno(fpFile), &st) == 0) ? (size_t)st.st_size : 0;
+    if (fileSize > imageSize)
+        fileSize = imageSize;
+    void* pData = ::mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pData != MAP_FAILED && fileSize > 0 &&
+        ::mmap(pData, (fileSize + pagemask) & ~pagemask, PROT_READ | PROT_WRITE,
+               (okShared ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED, ::fileno(fpFile), 0) == MAP_FAILED)
+    {
+        ::munmap(pData, mapSize);
+        pData = MAP_FAILED;
+    }
+    if (pData == MAP_FAILED)  // Read the file then
+    {
+        ::fclose(fpFile);
+        if (!AttachImage(drive, sFileName))
+            return false;
+        if (!okPersistent)  // Keep the writes in memory
+        {
+            ::fclose(m_drivedata[drive].fpFile);
+            m_drivedata[drive].fpFile = nullptr;
+        }
+        return true;
+    }
+
+    if (!okShared)  // Nothing to save
+    {
+        ::fclose(fpFile);
+        fpFile = nullptr;
+    }
+    m_drivedata[drive].fpFile = fpFile;
+    m_drivedata[drive].data = (uint8_t*)pData;
+    m_drivedata[drive].okOwnData = true;
+    m_drivedata[drive].mapsize = mapSize;
+    m_drivedata[drive].mapfilesize = okShared ? (uint32_t)fileSize : 0;
+    m_drivedata[drive].okReadOnly = okReadOnly;
+    m_drivedata[drive].datasize = m_drivedata[drive].loadedsize = imageSize;
+
+    m_side = m_track = 0;
+
+    return true;
+#else
+    if (!AttachImage(drive, sFileName))
+        return false;
+    if (!okPersistent)  // Keep the writes in memory
+    {
+        ::fclose(m_drivedata[drive].fpFile);
+        m_drivedata[drive].fpFile = nullptr;
+    }
+    return true;
+#endif
+}
+
+uint8_t* CFloppyController::AttachStreamImage(int drive, uint32_t* pSize)
+{
+    ASSERT(pSize != nullptr);
+
+    if (m_drivedata[drive].data != nullptr)
+        DetachImage(drive);
+
+    // No file: the writes stay in the data
+    uint32_t imageSize = FLOPPY_MAX_TRACKS * 2 * 10 * 512;
+    m_drivedata[drive].data = (uint8_t*)::calloc(imageSize, 1);
+    if (m_drivedata[drive].data == nullptr)
+        return nullptr;
+    m_drivedata[drive].okOwnData = true;
+    m_drivedata[drive].okReadOnly = false;
     m_drivedata[drive].datasize = imageSize;
+    m_drivedata[drive].loadedsize = 0;
+
+    m_side = m_track = 0;
+
+    *pSize = imageSize;
+    return m_drivedata[drive].data;
+}
+
+bool CFloppyController::AttachImageBuffer(int drive, uint8_t* pData, uint32_t size, bool okTakeOwnership)
+{
+    ASSERT(pData != nullptr);
+
+    if (m_drivedata[drive].data != nullptr)
+        DetachImage(drive);
+
+    uint32_t imageSize = FLOPPY_MAX_TRACKS * 2 * 10 * 512;
+    if (size < imageSize)  // Short image, the rest of the disk is empty
+    {
+        if (!okTakeOwnership)
+            return false;
+        uint8_t* pNewData = (uint8_t*)::realloc(pData, imageSize);
+        if (pNewData == nullptr)
+            return false;
+        ::memset(pNewData + size, 0, imageSize - size);
+        pData = pNewData;
+    }
+
+    m_drivedata[drive].data = pData;
+    m_drivedata[drive].okOwnData = okTakeOwnership;
+    m_drivedata[drive].okReadOnly = false;
+    m_drivedata[drive].datasize = m_drivedata[drive].loadedsize = imageSize;
 
     m_side = m_track = 0;
 
     return true;
 }
 
+bool CFloppyController::TakeDirtyRange(int drive, uint32_t* pStart, uint32_t* pEnd)
+{
+    CFloppyDrive* pDrive = m_drivedata + drive;
+    if (pDrive->hostdirtyend == 0)
+        return false;
+
+    *pStart = pDrive->hostdirtystart;
+    *pEnd = pDrive->hostdirtyend;
+    pDrive->hostdirtystart = pDrive->hostdirtyend = 0;
+    return true;
+}
+
+void CFloppyController::ReadImageData(int drive, uint32_t start, uint32_t end, uint8_t* pDest) const
+{
+    for (uint32_t offset = start; offset < end; offset += 512)
+        m_drivedata[drive].ReadBlock((uint16_t)(offset / 512), pDest + (offset - start));
+}
+
+void CFloppyController::SetStreamLoaded(int drive, uint32_t loadedSize, bool okDone)
+{
+    CFloppyDrive* pDrive = m_drivedata + drive;
+    if (pDrive->data == nullptr)
+        return;
+
+    pDrive->loadedsize = (okDone || loadedSize > pDrive->datasize) ? pDrive->datasize : loadedSize;
+}
+
 void CFloppyController::DetachImage(int drive)
 {
-    if (m_drivedata[drive].fpFile == nullptr) return;
+    if (m_drivedata[drive].data == nullptr) return;
 
     m_drivedata[drive].Flush();
 
-    ::fclose(m_drivedata[drive].fpFile);
+    if (m_drivedata[drive].fpFile != nullptr)
+        ::fclose(m_drivedata[drive].fpFile);
     m_drivedata[drive].fpFile = nullptr;
     m_drivedata[drive].okReadOnly = false;
-    ::free(m_drivedata[drive].data);  m_drivedata[drive].data = nullptr;
+    delete m_drivedata[drive].overlay;  m_drivedata[drive].overlay = nullptr;
+    if (m_drivedata[drive].shared != nullptr)
+        m_drivedata[drive].shared->Release();
+#ifdef EMUBASE_MMAP
+    else if (m_drivedata[drive].mapsize != 0)
+        ::munmap(m_drivedata[drive].data, m_drivedata[drive].mapsize);
+#endif
+    else if (m_drivedata[drive].okOwnData)
+        ::free(m_drivedata[drive].data);
+    m_drivedata[drive].shared = nullptr;
+    if (m_drivedata[drive].share != nullptr)
+    {
+        if (m_drivedata[drive].sharegen != nullptr)
+        {
+            m_drivedata[drive].share->Lock();
+            m_drivedata[drive].share->RemoveClone(m_drivedata[drive].sharegen);
+            m_drivedata[drive].share->Unlock();
+        }
+        m_drivedata[drive].share->Release();
+    }
+    m_drivedata[drive].share = nullptr;
+    m_drivedata[drive].sharegen = nullptr;
+    m_drivedata[drive].data = nullptr;
+    m_drivedata[drive].okOwnData = false;
+    m_drivedata[drive].mapsize = 0;
+    m_drivedata[drive].mapfilesize = 0;
+    m_drivedata[drive].datasize = m_drivedata[drive].loadedsize = 0;
+    m_drivedata[drive].hostdirtystart = m_drivedata[drive].hostdirtyend = 0;
     m_drivedata[drive].Reset();
 }
 
+CFloppyController* CFloppyController::Clone(CMotherboard* pBoard)
+{
+    CFloppyController* pClone = new CFloppyController(pBoard);
+    pClone->m_drive = m_drive;
+    pClone->m_pDrive = (m_pDrive == nullptr) ? nullptr : pClone->m_drivedata + (m_pDrive - m_drivedata);
+    pClone->m_phase = m_phase;
+    pClone->m_state = m_state;
+    ::memcpy(pClone->m_command, m_command, sizeof(m_command));
+    pClone->m_commandlen = m_commandlen;
+    ::memcpy(pClone->m_result, m_result, sizeof(m_result));
+    pClone->m_resultlen = m_resultlen;
+    pClone->m_resultpos = m_resultpos;
+    pClone->m_pendingcmd = m_pendingcmd;
+    pClone->m_timertick = m_timertick;
+    pClone->m_track = m_track;
+    pClone->m_side = m_side;
+    pClone->m_int = m_int;
+    pClone->m_motor = m_motor;
+    pClone->m_okTrace = m_okTrace;
+
+    for (int drive = 0; drive < 4; drive++)
+    {
+        if (!m_drivedata[drive].CloneTo(pClone->m_drivedata + drive))
+        {
+            delete pClone;  // Detaches the drives cloned so far
+            return nullptr;
+        }
+    }
+
+    return pClone;
+}
+
+void CFloppyController::SetScratchMode(bool okScratch)
+{
+    if (okScratch == m_okScratch)
+        return;
+    m_okScratch = okScratch;
+
+    if (okScratch)
+    {
+        SaveToImage(m_scratchimage);
+        m_scratchticks = m_pBoard->GetTicks();
+        for (int drive = 0; drive < 4; drive++)
+        {
+            CFloppyDrive* pDrive = m_drivedata + drive;
+            m_scratchdrives[drive] = *pDrive;
+            if (pDrive->data == nullptr)
+                continue;
+            // No file to flush to, the writes go over the current overlay copy
+            pDrive->fpFile = nullptr;
+            pDrive->overlay = (pDrive->overlay != nullptr) ? pDrive->overlay->Clone() : nullptr;
+            if (pDrive->overlay == nullptr)
+                pDrive->overlay = new CDiskOverlay();
+        }
+    }
+    else
+    {
+        for (int drive = 0; drive < 4; drive++)
+        {
+            if (m_drivedata[drive].data != nullptr)
+                delete m_drivedata[drive].overlay;
+            // The sharing made in the scratch mode stays, the cloned machines use it
+            CSharedData* shared = m_drivedata[drive].shared;
+            CDiskShare* share = m_drivedata[drive].share;
+            m_drivedata[drive] = m_scratchdrives[drive];
+            m_drivedata[drive].shared = shared;
+            m_drivedata[drive].share = share;
+            // The board ticks went on in the scratch mode, the flush keeps its distance from the current tick
+            if (m_drivedata[drive].flushtick != 0)
+                m_drivedata[drive].flushtick += m_pBoard->GetTicks() - m_scratchticks;
+        }
+        LoadFromImage(m_scratchimage);  // Arms the timer
+    }
+}
+
 //////////////////////////////////////////////////////////////////////
 
 
@@ -295,6 +710,16 @@ uint8_t CFloppyController::CheckCommand()
     }
 }
 
+// Check if the track of the read/write command is there, for the image streaming in
+bool CFloppyController::IsCommandTrackLoaded() const
+{
+    if (m_drive == 0xff || m_pDrive == nullptr || !IsAttached(m_drive))
+        return true;  // Nothing to wait for, the command fails
+
+    uint32_t trackEnd = (uint32_t)(m_command[2] * 2 + (m_command[3] & 1) + 1) * 5120;
+    return m_pDrive->loadedsize >= trackEnd || m_pDrive->loadedsize == m_pDrive->datasize;
+}
+
 void CFloppyController::StartCommand(uint8_t cmd)
 {
     m_commandlen = 0;
@@ -302,6 +727,7 @@ void CFloppyController::StartCommand(uint8_t cmd)
     m_phase = FLOPPY_PHASE_EXEC;
 
     ExecuteCommand(cmd);
+    ArmTimer(m_pBoard->GetTicks());
 }
 
 void CFloppyController::ExecuteCommand(uint8_t cmd)
@@ -309,6 +735,11 @@ void CFloppyController::ExecuteCommand(uint8_t cmd)
     switch (cmd)
     {
     case FLOPPY_COMMAND_READ_DATA:
+        if (!IsCommandTrackLoaded())
+        {
+            m_pendingcmd = cmd;  // Stay in the execution phase, see Periodic()
+            break;
+        }
         if (m_okTrace) DebugLogFormat(_T("Floppy CMD READ_DATA C%02x H%02x R%02x N%02x EOT%02x GPL%02x DTL%02x\r\n"),
                     m_command[2], m_command[3], m_command[4], m_command[5], m_command[6], m_command[7], m_command[8]);
         //m_state = FLOPPY_STATE_READ_DATA;
@@ -336,7 +767,9 @@ void CFloppyController::ExecuteCommand(uint8_t cmd)
                 size_t offset = (m_command[2] * 2 + m_command[3]) * 5120 + sector * 512;
                 int block = offset / 512;
                 if (m_okTrace) DebugLogFormat(_T("Floppy CMD READ_DATA sent to buffer at pos 0x%06x block %d.\r\n"), offset, block);
-                bool contflag = m_pBoard->FillHDBuffer(m_pDrive->data + offset);
+                uint8_t buffer[512];
+                m_pDrive->ReadBlock((uint16_t)block, buffer);
+                bool contflag = m_pBoard->FillHDBuffer(buffer);
                 if (!contflag)
                     break;
                 sector = (sector + 1) % 10;
@@ -376,6 +809,11 @@ void CFloppyController::ExecuteCommand(uint8_t cmd)
         break;
 
     case FLOPPY_COMMAND_WRITE_DATA:
+        if (!IsCommandTrackLoaded())
+        {
+            m_pendingcmd = cmd;  // Stay in the execution phase, see Periodic()
+            break;
+        }
         if (m_okTrace) DebugLogFormat(_T("Floppy CMD WRITE_DATA C%02x H%02x R%02x N%02x EOT%02x GPL%02x DTL%02x\r\n"),
                     m_command[2], m_command[3], m_command[4], m_command[5], m_command[6], m_command[7], m_command[8]);
         //TODO: m_state = FLOPPY_STATE_WRITE_DATA;
@@ -407,6 +845,8 @@ void CFloppyController::ExecuteCommand(uint8_t cmd)
                 m_pDrive->WriteBlock(block, pBuffer);
                 sector = (sector + 1) % 10;
             }
+            if (m_pDrive->IsDirty())
+                m_pDrive->flushtick = m_pBoard->GetTicks() + FLOPPY_FLUSH_DELAY;
         }
         break;
 
@@ -415,18 +855,55 @@ void CFloppyController::ExecuteCommand(uint8_t cmd)
     }
 }
 
+// Called from CMotherboard::SystemTicks() at the tick of GetTimerTick()
 void CFloppyController::Periodic()
 {
-    // Process flush after timeout
+    uint64_t ticks = m_pBoard->GetTicks();
+
+    // Execute the command waiting for its track to stream in
+    if (m_pendingcmd != 0 && IsCommandTrackLoaded())
+    {
+        uint8_t cmd = m_pendingcmd;
+        m_pendingcmd = 0;
+        ExecuteCommand(cmd);
+    }
+
+    // The flush delay is over; the flush itself waits for the frame end
     for (int drive = 0; drive < 2; drive++)
     {
-        if (m_drivedata[drive].dirtycount > 0)
+        if (m_drivedata[drive].flushtick != 0 && ticks >= m_drivedata[drive].flushtick)
         {
-            m_drivedata[drive].dirtycount--;
-            if (m_drivedata[drive].dirtycount == 0)
-                m_drivedata[drive].Flush();
+            m_drivedata[drive].flushtick = 0;
+            m_drivedata[drive].okFlushDue = true;
         }
     }
+
+    ArmTimer(ticks + 1);
+}
+
+// The waiting command polls its track every 32 ticks, the disk rotation tick, as 625 times per frame;
+// with nothing to wait for, the timer is off and the board does not call the controller
+void CFloppyController::ArmTimer(uint64_t fromTick)
+{
+    uint64_t tick = EMUBASE_TIMER_OFF;
+    if (m_pendingcmd != 0)
+        tick = (fromTick + 31) & ~(uint64_t)31;
+    for (int drive = 0; drive < 2; drive++)
+    {
+        uint64_t flushtick = m_drivedata[drive].flushtick;
+        if (flushtick != 0 && flushtick < tick)
+            tick = flushtick;
+    }
+    m_timertick = tick;
+}
+
+void CFloppyController::FlushDue()
+{
+    for (int drive = 0; drive < 2; drive++)
+    {
+        if (m_drivedata[drive].okFlushDue)
+            m_drivedata[drive].Flush();
+    }
 }
 
 void CFloppyController::FlushChanges()
@@ -438,5 +915,59 @@ void CFloppyController::FlushChanges()
     m_drivedata[1].Flush();
 }
 
+//////////////////////////////////////////////////////////////////////
+//
+// Floppy controller state image (64 bytes)
+//       0      1 byte   - Current drive number
+//       1      1 byte   - Phase, see FLOPPY_PHASE_XXX
+//       2      1 byte   - State, see FLOPPY_STATE_XXX
+//       3      1 byte   - Command length
+//       4      9 bytes  - Command buffer
+//      13      1 byte   - Result length
+//      14      1 byte   - Result position
+//      15      9 bytes  - Result buffer
+//      24      1 byte   - Track
+//      25      1 byte   - Side
+//      26      1 byte   - Interrupt flag
+//      27      1 byte   - Motor on/off
+//      28     36 bytes  - RESERVED
+
+void CFloppyController::SaveToImage(uint8_t* pImage) const
+{
+    memset(pImage, 0, FLOPPY_IMAGE_SIZE);
+    pImage[0] = m_drive;
+    pImage[1] = m_phase;
+    pImage[2] = m_state;
+    pImage[3] = m_commandlen;
+    memcpy(pImage + 4, m_command, sizeof(m_command));
+    pImage[13] = m_resultlen;
+    pImage[14] = m_resultpos;
+    memcpy(pImage + 15, m_result, sizeof(m_result));
+    pImage[24] = m_track;
+    pImage[25] = m_side;
+    pImage[26] = m_int ? 1 : 0;
+    pImage[27] = m_motor ? 1 : 0;
+    pImage[28] = m_pendingcmd;
+}
+
+void CFloppyController::LoadFromImage(const uint8_t* pImage)
+{
+    m_drive = pImage[0];
+    m_pDrive = (m_drive < 4) ? m_drivedata + m_drive : nullptr;
+    m_phase = pImage[1];
+    m_state = pImage[2];
+    m_commandlen = pImage[3] < sizeof(m_command) ? pImage[3] : 0;
+    memcpy(m_command, pImage + 4, sizeof(m_command));
+    m_resultlen = pImage[13] <= sizeof(m_result) ? pImage[13] : 0;
+    m_resultpos = pImage[14] <= m_resultlen ? pImage[14] : 0;
+    memcpy(m_result, pImage + 15, sizeof(m_result));
+    m_track = pImage[24];
+    m_side = pImage[25];
+    m_int = pImage[26] != 0;
+    m_motor = pImage[27] != 0;
+    m_pendingcmd = pImage[28];
+    ArmTimer(m_pBoard->GetTicks());
+}
+
 
 //////////////////////////////////////////////////////////////////////
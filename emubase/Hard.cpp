@@ -75,14 +75,29 @@ static void InvertBuffer(void* buffer)
 //////////////////////////////////////////////////////////////////////
 
 
-CHardDrive::CHardDrive()
+CHardDrive::CHardDrive(CMotherboard* pBoard)
+    : m_pBoard(pBoard)
 {
+    ASSERT(pBoard != nullptr);
+
     m_fpFile = nullptr;
+    m_sFileName = nullptr;
+    m_pData = nullptr;
+    m_datasize = 0;
+    m_okOwnData = false;
+    m_pShared = nullptr;
+    m_dirtystart = m_dirtyend = 0;
+    m_pOverlay = nullptr;
+    m_pShare = nullptr;
+    m_pShareGeneration = nullptr;
+    m_pScratchSaved = nullptr;
 
     m_status = IDE_STATUS_BUSY;
     m_error = IDE_ERROR_NONE;
     m_command = 0;
-    m_timeoutcount = m_timeoutevent = 0;
+    m_timeouttick = EMUBASE_TIMER_OFF;
+    m_timeoutevent = TIMEEVT_NONE;
+    m_scratchticks = 0;
     m_sectorcount = 0;
 
     m_numsectors = m_numheads = m_numcylinders = 256;
@@ -94,6 +109,7 @@ CHardDrive::CHardDrive()
 
 CHardDrive::~CHardDrive()
 {
+    SetScratchMode(false);
     DetachImage();
 }
 
@@ -104,8 +120,7 @@ void CHardDrive::Reset()
     m_status = IDE_STATUS_BUSY;
     m_error = IDE_ERROR_NONE;
     m_command = 0;
-    m_timeoutcount = 2;
-    m_timeoutevent = TIMEEVT_RESET_DONE;
+    ArmTimeout(2, TIMEEVT_RESET_DONE);
 }
 
 bool CHardDrive::AttachImage(LPCTSTR sFileName)
@@ -122,6 +137,9 @@ bool CHardDrive::AttachImage(LPCTSTR sFileName)
     }
     if (m_fpFile == nullptr)
         return false;
+    m_sFileName = static_cast<LPTSTR>(::malloc((_tcslen(sFileName) + 1) * sizeof(TCHAR)));
+    if (m_sFileName != nullptr)
+        _tcscpy(m_sFileName, sFileName);
 
     // Check file size
     ::fseek(m_fpFile, 0, SEEK_END);
@@ -143,14 +161,197 @@ bool CHardDrive::AttachImage(LPCTSTR sFileName)
     return true;
 }
 
+bool CHardDrive::AttachImageBuffer(uint8_t* pData, uint32_t size, bool okTakeOwnership)
+{
+    ASSERT(pData != nullptr);
+
+    if (size < IDE_DISK_SECTOR_SIZE || size % IDE_DISK_SECTOR_SIZE != 0)
+        return false;
+
+    m_pData = pData;
+    m_datasize = size;
+    m_okOwnData = okTakeOwnership;
+    m_okReadOnly = false;
+    m_dirtystart = m_dirtyend = 0;
+
+    ::memcpy(m_buffer, m_pData, IDE_DISK_SECTOR_SIZE);  // First sector
+
+    m_lba = m_curhead = m_curheadreg = m_bufferoffset = 0;
+
+    m_status = IDE_STATUS_BUSY;
+    m_error = IDE_ERROR_NONE;
+
+    return true;
+}
+
+// Add the sector at the offset to the range written, for the buffer-backed image
+void CHardDrive::MarkDirty(uint32_t offset)
+{
+    if (m_pData == nullptr)
+        return;
+    if (m_dirtyend == 0 || offset < m_dirtystart)
+        m_dirtystart = offset;
+    if (m_dirtyend < offset + IDE_DISK_SECTOR_SIZE) m_dirtyend = offset + IDE_DISK_SECTOR_SIZE;
+}
+
+void CHardDrive::ReadImageData(uint32_t start, uint32_t end, uint8_t* pDest)
+{
+    for (uint32_t offset = start; offset < end; offset += IDE_DISK_SECTOR_SIZE)
+        ReadSector(offset / IDE_DISK_SECTOR_SIZE, pDest + (offset - start));
+}
+
+bool CHardDrive::TakeDirtyRange(uint32_t* pStart, uint32_t* pEnd)
+{
+    if (m_dirtyend == 0)
+        return false;
+
+    *pStart = m_dirtystart;
+    *pEnd = m_dirtyend;
+    m_dirtystart = m_dirtyend = 0;
+    return true;
+}
+
 void CHardDrive::DetachImage()
 {
-    if (m_fpFile == nullptr) return;
+    if (m_fpFile == nullptr && m_pData == nullptr) return;
 
     //FlushChanges();
 
-    ::fclose(m_fpFile);
+    if (m_fpFile != nullptr)
+        ::fclose(m_fpFile);
     m_fpFile = nullptr;
+    ::free(m_sFileName);  m_sFileName = nullptr;
+    if (m_pShared != nullptr)
+        m_pShared->Release();
+    else if (m_okOwnData)
+        ::free(m_pData);
+    m_pShared = nullptr;
+    m_pData = nullptr;
+    m_datasize = 0;
+    m_dirtystart = m_dirtyend = 0;
+    delete m_pOverlay;  m_pOverlay = nullptr;
+    if (m_pShare != nullptr)
+    {
+        if (m_pShareGeneration != nullptr)
+        {
+            m_pShare->Lock();
+            m_pShare->RemoveClone(m_pShareGeneration);
+            m_pShare->Unlock();
+        }
+        m_pShare->Release();
+    }
+    m_pShare = nullptr;
+    m_pShareGeneration = nullptr;
+}
+
+CHardDrive* CHardDrive::Clone(CMotherboard* pBoard)
+{
+    if (m_pData == nullptr && (m_fpFile == nullptr || m_sFileName == nullptr))
+        return nullptr;
+
+    // The clone reads the image through its own file pointer, unbuffered to see the writes of this device
+    FILE* fpFile = nullptr;
+    LPTSTR sFileName = nullptr;
+    if (m_pData == nullptr)
+    {
+        ::fflush(m_fpFile);
+        fpFile = ::_tfopen(m_sFileName, _T("rb"));
+        if (fpFile == nullptr)
+            return nullptr;
+        ::setvbuf(fpFile, nullptr, _IONBF, 0);
+        sFileName = static_cast<LPTSTR>(::malloc((_tcslen(m_sFileName) + 1) * sizeof(TCHAR)));
+    }
+    CDiskOverlay* pOverlay = (m_pOverlay != nullptr) ? m_pOverlay->Clone() : new CDiskOverlay();
+    if (pOverlay == nullptr || (fpFile != nullptr && sFileName == nullptr))
+    {
+        if (fpFile != nullptr)
+            ::fclose(fpFile);
+        ::free(sFileName);
+        delete pOverlay;
+        return nullptr;
+    }
+
+    CHardDrive* pClone = new CHardDrive(pBoard);
+    if (fpFile != nullptr)
+    {
+        _tcscpy(sFileName, m_sFileName);
+        pClone->m_fpFile = fpFile;
+        pClone->m_sFileName = sFileName;
+    }
+    else  // The buffer is shared the same way as the file
+    {
+        if (m_pShared == nullptr)
+            m_pShared = CSharedData::Create(m_pData, m_okOwnData);
+        m_pShared->AddRef();
+        pClone->m_pData = m_pData;
+        pClone->m_datasize = m_datasize;
+        pClone->m_pShared = m_pShared;
+    }
+    pClone->m_pOverlay = pOverlay;
+
+    if (m_pShare == nullptr)
+        m_pShare = CDiskShare::Create();
+    m_pShare->AddRef();
+    m_pShare->Lock();
+    pClone->m_pShareGeneration = m_pShare->AddClone(m_pShareGeneration);
+    m_pShare->Unlock();
+    pClone->m_pShare = m_pShare;
+
+    pClone->CopyStateFrom(this);
+    return pClone;
+}
+
+void CHardDrive::CopyStateFrom(const CHardDrive* pSource)
+{
+    m_okReadOnly = pSource->m_okReadOnly;
+    m_status = pSource->m_status;
+    m_error = pSource->m_error;
+    m_command = pSource->m_command;
+    m_lba = pSource->m_lba;
+    m_numcylinders = pSource->m_numcylinders;
+    m_numheads = pSource->m_numheads;
+    m_numsectors = pSource->m_numsectors;
+    m_curhead = pSource->m_curhead;
+    m_curheadreg = pSource->m_curheadreg;
+    m_sectorcount = pSource->m_sectorcount;
+    ::memcpy(m_buffer, pSource->m_buffer, IDE_DISK_SECTOR_SIZE);
+    m_bufferoffset = pSource->m_bufferoffset;
+    m_timeouttick = pSource->m_timeouttick;
+    m_timeoutevent = pSource->m_timeoutevent;
+}
+
+void CHardDrive::SetScratchMode(bool okScratch)
+{
+    if (okScratch == (m_pScratchSaved != nullptr))
+        return;
+
+    if (okScratch)
+    {
+        // The saved copy keeps the current overlay; the writes go over the overlay copy
+        m_pScratchSaved = new CHardDrive(m_pBoard);
+        m_pScratchSaved->CopyStateFrom(this);
+        m_scratchticks = m_pBoard->GetTicks();
+        m_pScratchSaved->m_pOverlay = m_pOverlay;
+        m_pScratchSaved->m_dirtystart = m_dirtystart;
+        m_pScratchSaved->m_dirtyend = m_dirtyend;
+        m_pOverlay = (m_pOverlay != nullptr) ? m_pOverlay->Clone() : nullptr;
+        if (m_pOverlay == nullptr)
+            m_pOverlay = new CDiskOverlay();
+    }
+    else
+    {
+        delete m_pOverlay;
+        m_pOverlay = m_pScratchSaved->m_pOverlay;
+        m_pScratchSaved->m_pOverlay = nullptr;
+        m_dirtystart = m_pScratchSaved->m_dirtystart;  // The scratch writes are gone
+        m_dirtyend = m_pScratchSaved->m_dirtyend;
+        CopyStateFrom(m_pScratchSaved);
+        delete m_pScratchSaved;
+        m_pScratchSaved = nullptr;
+        // The board ticks went on in the scratch mode, the event keeps its distance from the current tick
+        if (m_timeouttick != EMUBASE_TIMER_OFF)
+            m_timeouttick += m_pBoard->GetTicks() - m_scratchticks;
+    }
 }
 
 uint16_t CHardDrive::ReadPort(uint16_t port)
@@ -260,33 +461,34 @@ void CHardDrive::WritePort(uint16_t port, uint16_t data)
     }
 }
 
-// Called from CMotherboard::SystemFrame() every tick
-void CHardDrive::Periodic()
+// Called from CMotherboard::SystemTicks() at the tick of GetTimerTick()
+void CHardDrive::Timeout()
 {
-    if (m_timeoutcount > 0)
+    int evt = m_timeoutevent;
+    m_timeouttick = EMUBASE_TIMER_OFF;
+    m_timeoutevent = TIMEEVT_NONE;
+    switch (evt)
     {
-        m_timeoutcount--;
-        if (m_timeoutcount == 0)
-        {
-            int evt = m_timeoutevent;
-            m_timeoutevent = TIMEEVT_NONE;
-            switch (evt)
-            {
-            case TIMEEVT_RESET_DONE:
-                m_status &= ~IDE_STATUS_BUSY;
-                m_status |= IDE_STATUS_DRIVE_READY | IDE_STATUS_SEEK_COMPLETE;
-                break;
-            case TIMEEVT_READ_SECTOR_DONE:
-                ReadSectorDone();
-                break;
-            case TIMEEVT_WRITE_SECTOR_DONE:
-                WriteSectorDone();
-                break;
-            }
-        }
+    case TIMEEVT_RESET_DONE:
+        m_status &= ~IDE_STATUS_BUSY;
+        m_status |= IDE_STATUS_DRIVE_READY | IDE_STATUS_SEEK_COMPLETE;
+        break;
+    case TIMEEVT_READ_SECTOR_DONE:
+        ReadSectorDone();
+        break;
+    case TIMEEVT_WRITE_SECTOR_DONE:
+        WriteSectorDone();
+        break;
     }
 }
 
+// The device gets its timer call in the same tick after the CPU, so the event of N ticks fires N - 1 ticks later
+void CHardDrive::ArmTimeout(int ticks, int event)
+{
+    m_timeouttick = m_pBoard->GetTicks() + ticks - 1;
+    m_timeoutevent = event;
+}
+
 void CHardDrive::HandleCommand(uint8_t command)
 {
     m_command = command;
@@ -299,8 +501,7 @@ void CHardDrive::HandleCommand(uint8_t command)
         m_status |= IDE_STATUS_BUSY;
         m_status &= ~IDE_STATUS_BUFFER_READY;
 
-        m_timeoutcount = TIME_PER_SECTOR * 3;  // Timeout while seek for track
-        m_timeoutevent = TIMEEVT_READ_SECTOR_DONE;
+        ArmTimeout(TIME_PER_SECTOR * 3, TIMEEVT_READ_SECTOR_DONE);  // Timeout while seek for track
         break;
 
         //case IDE_COMMAND_SET_CONFIG:
@@ -388,8 +589,7 @@ void CHardDrive::ReadNextSector()
 {
     m_status |= IDE_STATUS_BUSY;
 
-    m_timeoutcount = TIME_PER_SECTOR * 2;  // Timeout while seek for next sector
-    m_timeoutevent = TIMEEVT_READ_SECTOR_DONE;
+    ArmTimeout(TIME_PER_SECTOR * 2, TIMEEVT_READ_SECTOR_DONE);  // Timeout while seek for next sector
 }
 
 void CHardDrive::ReadSectorDone()
@@ -400,9 +600,7 @@ void CHardDrive::ReadSectorDone()
     m_status |= IDE_STATUS_SEEK_COMPLETE;
 
     // Read sector from HDD image to the buffer
-    uint32_t fileOffset = CalculateOffset();
-    ::fseek(m_fpFile, fileOffset, SEEK_SET);
-    size_t dwBytesRead = ::fread(m_buffer, 1, IDE_DISK_SECTOR_SIZE, m_fpFile);
+    size_t dwBytesRead = ReadSector(m_lba, m_buffer);
     if (dwBytesRead != IDE_DISK_SECTOR_SIZE)
     {
         m_status |= IDE_STATUS_ERROR;
@@ -441,8 +639,26 @@ void CHardDrive::WriteSectorDone()
         return;
     }
 
-    ::fseek(m_fpFile, fileOffset, SEEK_SET);
-    size_t dwBytesWritten = ::fwrite(m_buffer, 1, IDE_DISK_SECTOR_SIZE, m_fpFile);
+    size_t dwBytesWritten = 0;
+    if (m_pOverlay != nullptr)  // The cloned machine or the scratch mode, keep the image intact
+    {
+        if ((m_pData == nullptr || fileOffset + IDE_DISK_SECTOR_SIZE <= m_datasize) && m_pOverlay->Write(m_lba, m_buffer))
+        {
+            dwBytesWritten = IDE_DISK_SECTOR_SIZE;
+            MarkDirty(fileOffset);
+        }
+    }
+    else if (m_pShare != nullptr)  // The cloned machines see the image as it was, keep the old data for them
+    {
+        uint8_t old[IDE_DISK_SECTOR_SIZE];
+        m_pShare->Lock();
+        if (!m_pShare->IsSectorNeeded(m_lba) ||
+            (ReadImageSector(m_lba, old) == IDE_DISK_SECTOR_SIZE && m_pShare->KeepSector(m_lba, old)))
+            dwBytesWritten = WriteImageSector(m_lba, m_buffer);
+        m_pShare->Unlock();
+    }
+    else
+        dwBytesWritten = WriteImageSector(m_lba, m_buffer);
     if (dwBytesWritten != IDE_DISK_SECTOR_SIZE)
     {
         m_status |= IDE_STATUS_ERROR;
@@ -462,6 +678,63 @@ void CHardDrive::WriteSectorDone()
     m_bufferoffset = 0;
 }
 
+size_t CHardDrive::ReadSector(uint32_t lba, uint8_t* pDest)
+{
+    const uint8_t* pSector = (m_pOverlay != nullptr) ? m_pOverlay->Find(lba) : nullptr;
+    if (pSector != nullptr)
+    {
+        ::memcpy(pDest, pSector, IDE_DISK_SECTOR_SIZE);
+        return IDE_DISK_SECTOR_SIZE;
+    }
+    if (m_pShareGeneration == nullptr)
+        return ReadImageSector(lba, pDest);
+
+    // The cloned machine sees the image as of the clone time
+    size_t dwBytesRead = IDE_DISK_SECTOR_SIZE;
+    m_pShare->Lock();
+    pSector = m_pShare->FindSector(m_pShareGeneration, lba);
+    if (pSector != nullptr)
+        ::memcpy(pDest, pSector, IDE_DISK_SECTOR_SIZE);
+    else
+        dwBytesRead = ReadImageSector(lba, pDest);
+    m_pShare->Unlock();
+    return dwBytesRead;
+}
+
+size_t CHardDrive::ReadImageSector(uint32_t lba, uint8_t* pDest)
+{
+    uint32_t fileOffset = lba * IDE_DISK_SECTOR_SIZE;
+    if (m_pData != nullptr)
+    {
+        if (fileOffset + IDE_DISK_SECTOR_SIZE > m_datasize)
+            return 0;
+        ::memcpy(pDest, m_pData + fileOffset, IDE_DISK_SECTOR_SIZE);
+        return IDE_DISK_SECTOR_SIZE;
+    }
+
+    ::fseek(m_fpFile, fileOffset, SEEK_SET);
+    return ::fread(pDest, 1, IDE_DISK_SECTOR_SIZE, m_fpFile);
+}
+
+size_t CHardDrive::WriteImageSector(uint32_t lba, const uint8_t* pSrc)
+{
+    uint32_t fileOffset = lba * IDE_DISK_SECTOR_SIZE;
+    if (m_pData != nullptr)
+    {
+        if (fileOffset + IDE_DISK_SECTOR_SIZE > m_datasize)
+            return 0;
+        ::memcpy(m_pData + fileOffset, pSrc, IDE_DISK_SECTOR_SIZE);
+        MarkDirty(fileOffset);
+        return IDE_DISK_SECTOR_SIZE;
+    }
+
+    ::fseek(m_fpFile, fileOffset, SEEK_SET);
+    size_t dwBytesWritten = ::fwrite(pSrc, 1, IDE_DISK_SECTOR_SIZE, m_fpFile);
+    if (m_pShare != nullptr)  // The cloned machines read the file through their own file pointers
+        ::fflush(m_fpFile);
+    return dwBytesWritten;
+}
+
 void CHardDrive::NextSector()
 {
     // Advance to the next sector, LBA-based
@@ -487,8 +760,7 @@ void CHardDrive::ContinueWrite()
     m_status &= ~IDE_STATUS_BUFFER_READY;
     m_status |= IDE_STATUS_BUSY;
 
-    m_timeoutcount = TIME_PER_SECTOR;
-    m_timeoutevent = TIMEEVT_WRITE_SECTOR_DONE;
+    ArmTimeout(TIME_PER_SECTOR, TIMEEVT_WRITE_SECTOR_DONE);
 }
 
 
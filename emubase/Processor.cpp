@@ -16,7 +16,7 @@ NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
 
 // Timings ///////////////////////////////////////////////////////////
 
-uint16_t MOV_TIMING[8][8] =
+const uint16_t MOV_TIMING[8][8] =
 {
     // RN     (RN)    (RN)+  @(RN)+  -(RN)   @-(RN)  X(RN)   @X(RN)
     {0x0007, 0x0016, 0x0017, 0x001F, 0x0017, 0x001F, 0x001E, 0x002E},   // RN
@@ -29,7 +29,7 @@ uint16_t MOV_TIMING[8][8] =
     {0x0027, 0x0037, 0x0035, 0x0040, 0x0036, 0x0040, 0x003E, 0x004D}    // @X(RN)
 };
 
-uint16_t MOVB_TIMING[8][8] =
+const uint16_t MOVB_TIMING[8][8] =
 {
     // RN     (RN)    (RN)+  @(RN)+  -(RN)   @-(RN)  X(RN)   @X(RN)
     {0x0007, 0x0016, 0x0016, 0x001E, 0x0016, 0x001F, 0x0027, 0x002D},   // RN
@@ -42,7 +42,7 @@ uint16_t MOVB_TIMING[8][8] =
     {0x0029, 0x0037, 0x003A, 0x003E, 0x0038, 0x003D, 0x0046, 0x004E}    // @X(RN)
 };
 
-uint16_t CMP_TIMING[8][8] =
+const uint16_t CMP_TIMING[8][8] =
 {
     // RN     (RN)    (RN)+  @(RN)+  -(RN)   @-(RN)  X(RN)   @X(RN)
     {0x0007, 0x0010, 0x0010, 0x0018, 0x0018, 0x0020, 0x0026, 0x0030},   // RN
@@ -55,80 +55,81 @@ uint16_t CMP_TIMING[8][8] =
     {0x0027, 0x002E, 0x002E, 0x0037, 0x002F, 0x0037, 0x0046, 0x004E}    // @X(RN)
 };
 
-uint16_t CLR_TIMING[8] =
+const uint16_t CLR_TIMING[8] =
 {
     0x0007, 0x0017, 0x0020, 0x002C, 0x0020, 0x002C, 0x0022, 0x002D
 };
 
-uint16_t CLRB_TIMING[8] =
+const uint16_t CLRB_TIMING[8] =
 {
     0x0007, 0x0017, 0x0016, 0x0020, 0x0016, 0x0020, 0x0027, 0x002E
 };
 
-uint16_t TST_TIMING[8] =
+const uint16_t TST_TIMING[8] =
 {
     0x0007, 0x0010, 0x0010, 0x0018, 0x0010, 0x0020, 0x0026, 0x0030
 };
 
-uint16_t MTPS_TIMING[8] =
+const uint16_t MTPS_TIMING[8] =
 {
     0x0014, 0x0025, 0x0025, 0x0032, 0x0026, 0x0032, 0x003E, 0x004A
 };
 
-uint16_t XOR_TIMING[8] =
+const uint16_t XOR_TIMING[8] =
 {
     0x0007, 0x0022, 0x0028, 0x0034, 0x002C, 0x0038, 0x0038, 0x0043
 };
 
-uint16_t ASH_TIMING[8] =
+const uint16_t ASH_TIMING[8] =
 {
     0x0012, 0x0028, 0x0028, 0x0030, 0x002C, 0x0034, 0x0040, 0x0048
 };
-uint16_t ASH_S_TIMING = 0x0005;
+const uint16_t ASH_S_TIMING = 0x0005;
 
-uint16_t ASHC_TIMING[8] =
+const uint16_t ASHC_TIMING[8] =
 {
     0x001E, 0x002A, 0x002A, 0x0034, 0x002E, 0x003A, 0x0043, 0x004E
 };
-uint16_t ASHC_S_TIMING = 0x0005;
+const uint16_t ASHC_S_TIMING = 0x0005;
 
-uint16_t MUL_TIMING[8] =
+const uint16_t MUL_TIMING[8] =
 {
     0x0057, 0x00BC, 0x00BC, 0x00CA, 0x00C0, 0x00CC, 0x00D6, 0x00CC
 };
 
-uint16_t DIV_TIMING[8] =
+const uint16_t DIV_TIMING[8] =
 {
     0x0065, 0x00D0, 0x00D0, 0x00DC, 0x00D3, 0x00E0, 0x00E8, 0x00F2
 };
 
-uint16_t JMP_TIMING[7] =
+const uint16_t JMP_TIMING[7] =
 {
     0x0016, 0x0016, 0x0022, 0x001B, 0x0026, 0x0020, 0x002B
 };
-uint16_t JSR_TIMING[7] =
+const uint16_t JSR_TIMING[7] =
 {
     0x0024, 0x0024, 0x0024, 0x0024, 0x002E, 0x0028, 0x002E
 };
 
-uint16_t BRANCH_TRUE_TIMING = 0x0017;
-uint16_t BRANCH_FALSE_TIMING = 0x0007;
-uint16_t BPT_TIMING = 0x004E;
-uint16_t EMT_TIMING = 0x003E;
-uint16_t RTI_TIMING = 0x0026;
-uint16_t RTS_TIMING = 0x001F;
-uint16_t NOP_TIMING = 0x0007;
-uint16_t SOB_TIMING = 0x001B;
-uint16_t SOB_LAST_TIMING = 0x000E;  // last iteration of SOB
-uint16_t BR_TIMING = 0x001C;
-uint16_t MARK_TIMING = 0x0030;
-uint16_t RESET_TIMING = 1000;
+const uint16_t BRANCH_TRUE_TIMING = 0x0017;
+const uint16_t BRANCH_FALSE_TIMING = 0x0007;
+const uint16_t BPT_TIMING = 0x004E;
+const uint16_t EMT_TIMING = 0x003E;
+const uint16_t RTI_TIMING = 0x0026;
+const uint16_t RTS_TIMING = 0x001F;
+const uint16_t NOP_TIMING = 0x0007;
+const uint16_t SOB_TIMING = 0x001B;
+const uint16_t SOB_LAST_TIMING = 0x000E;  // last iteration of SOB
+const uint16_t BR_TIMING = 0x001C;
+const uint16_t MARK_TIMING = 0x0030;
+const uint16_t RESET_TIMING = 1000;
 
 
 //////////////////////////////////////////////////////////////////////
 
 
 CProcessor::ExecuteMethodRef* CProcessor::m_pExecuteMethodMap = nullptr;
+int CProcessor::m_nInitCount = 0;
 
 #define RegisterMethodOpc(/*uint16_t*/ opcode, /*CProcessor::ExecuteMethodRef*/ methodref) \
     { m_pExecuteMethodMap[opcode] = (methodref); }
@@ -141,6 +142,9 @@ CProcessor::ExecuteMethodRef* CProcessor::m_pExecuteMethodMap = nullptr;
 
 void CProcessor::Init()
 {
+    if (m_nInitCount++ > 0)
+        return;  // Built already, the table is shared by all the processors
+
     ASSERT(m_pExecuteMethodMap == nullptr);
     m_pExecuteMethodMap = static_cast<CProcessor::ExecuteMethodRef*>(::calloc(65536, sizeof(CProcessor::ExecuteMethodRef)));
 
@@ -254,6 +258,10 @@ void CProcessor::Init()
 
 void CProcessor::Done()
 {
+    ASSERT(m_nInitCount > 0);
+    if (--m_nInitCount > 0)
+        return;
+
     ::free(m_pExecuteMethodMap);  m_pExecuteMethodMap = nullptr;
 }
 
@@ -283,6 +291,10 @@ CProcessor::CProcessor(CMotherboard* pBoard)
     m_regsrc = m_methsrc = 0;
     m_regdest = m_methdest = 0;
     m_addrsrc = m_addrdest = 0;
+
+    m_pCoverage = nullptr;
+    m_TrapCallback = nullptr;
+    m_TrapParam = nullptr;
 }
 
 void CProcessor::Execute()
@@ -413,6 +425,9 @@ bool CProcessor::InterruptProcessing()
 
     if (intrVector != 0xFFFF)
     {
+        if (m_TrapCallback != nullptr)
+            m_TrapCallback(m_TrapParam, intrVector, intrMode, m_instructionpc);
+
         m_internalTick += EMT_TIMING;  //ANYTHING UNKNOWN WILL CAUSE EXCEPTION (EMT)
 
         m_waitmode = false;
@@ -467,6 +482,8 @@ void CProcessor::CommandExecution()
     if (!m_waitmode)
     {
         m_instructionpc = m_R[7];  // Store address of the current instruction
+        if (m_pCoverage != nullptr)
+            m_pCoverage[(m_instructionpc >> 1) | ((m_psw & 0400) << 7)] = 1;
         FetchInstruction();  // Read next instruction from memory
         if (!m_RPLYrq)
         {
@@ -2027,8 +2044,69 @@ void CProcessor::ExecuteMOV()  // MOV - move
     m_internalTick = MOV_TIMING[m_methsrc][m_methdest];
 }
 
+// Fast disk mode: the loop of MOVB (Rs),(Rd)+ instructions closed by SOB, reading the port to RAM, e.g.
+//   MOVB (R0),(R1)+ / MOVB (R0),(R1)+ / SOB R3,.-4
+// runs all its iterations at once, from its first instruction; see CMotherboard::SetFastDiskMode().
+// The CPU ticks are counted the same as for the iterations one by one. Returns false if not the case.
+bool CProcessor::ExecuteFastReadLoop()
+{
+    if (m_regsrc >= 6 || m_regdest >= 6 || m_regsrc == m_regdest || (m_psw & PSW_T) != 0)
+        return false;
+
+    // The same MOVB instructions up to SOB back to the current one
+    bool okHaltMode = IsHaltMode();
+    int addrtype;
+    int body = 1;
+    uint16_t sobaddr = m_instructionpc + 2;
+    uint16_t sob = 0;
+    for (; body <= 16; body++, sobaddr += 2)
+    {
+        sob = m_pBoard->GetWordView(sobaddr, okHaltMode, true, &addrtype);
+        if ((addrtype != ADDRTYPE_RAM && addrtype != ADDRTYPE_ROM) || sob != m_instruction)
+            break;
+    }
+    int regcount = (sob >> 6) & 7;
+    if ((sob & 0177000) != 0077000 || (uint16_t)(sobaddr + 2 - (sob & 077) * 2) != m_instructionpc ||
+        regcount >= 6 || regcount == m_regsrc || regcount == m_regdest)
+        return false;
+    int count = GetReg(regcount);
+    if (count == 0)
+        return false;
+
+    // Iterations to run now: all, or as many as the ticks counter holds; the loop continues after those then
+    int iterticks = body * (MOVB_TIMING[1][2] + 1) + SOB_TIMING + 1;
+    int lastticks = body * (MOVB_TIMING[1][2] + 1) + SOB_LAST_TIMING + 1;
+    int iterations = count;
+    int ticks = (count - 1) * iterticks + lastticks;
+    if (ticks > 65536)
+    {
+        iterations = 65536 / iterticks;
+        ticks = iterations * iterticks;
+    }
+
+    uint16_t dest = GetReg(m_regdest);
+    if (dest < sobaddr + 2 && dest + iterations * body > m_instructionpc)
+        return false;  // The loop overwrites itself
+    uint8_t last;
+    if (!m_pBoard->ReadPortBlock(GetReg(m_regsrc), dest, okHaltMode, iterations * body, &last))
+        return false;
+
+    SetReg(m_regdest, GetReg(m_regdest) + iterations * body);
+    SetReg(regcount, (uint16_t)(count - iterations));
+    SetPC((iterations == count) ? sobaddr + 2 : m_instructionpc);
+    uint8_t new_psw = GetLPSW() & 0xF1;
+    if (last & 0200) new_psw |= PSW_N;
+    if (last == 0) new_psw |= PSW_Z;
+    SetLPSW(new_psw);
+    m_internalTick = (uint16_t)(ticks - 1);
+    return true;
+}
+
 void CProcessor::ExecuteMOVB()  // MOVB - move byte
 {
+    if (m_methsrc == 1 && m_methdest == 2 && m_pBoard->IsFastDiskMode() && ExecuteFastReadLoop())
+        return;
+
     uint16_t src_addr, dst_addr;
     uint8_t new_psw = GetLPSW() & 0xF1;
     uint8_t dst;
@@ -2603,6 +2681,13 @@ void CProcessor::LoadFromImage(const uint8_t* pImage)
     //                                              //   29    35   Reserved
 }
 
+CProcessor* CProcessor::Clone(CMotherboard* pBoard) const
+{
+    CProcessor* pClone = new CProcessor(*this);  // The whole state is plain data
+    pClone->m_pBoard = pBoard;
+    return pClone;
+}
+
 uint16_t CProcessor::GetWordAddr (uint8_t meth, uint8_t reg)
 {
     switch (meth)
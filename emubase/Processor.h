@@ -18,6 +18,10 @@ NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
 
 //////////////////////////////////////////////////////////////////////
 
+// Trap callback: the processor takes the interrupt or trap through the vector, in HALT or USER mode;
+// pc = address of the instruction being executed
+typedef void (CALLBACK* CPUTRAPCALLBACK)(void* param, uint16_t vector, bool okHaltMode, uint16_t pc);
+
 // KM1801VM2 processor
 class CProcessor
 {
@@ -31,11 +35,14 @@ public:  // Constructor / initialization
     void        MemoryError();
 
 public:
+    // The static tables are shared by all the processors: Init() builds them on the first call,
+    // Done() releases them on the last one; call in pairs, from one thread
     static void Init();  // Initialize static tables
     static void Done();  // Release memory used for static tables
 protected:  // Statics
     typedef void ( CProcessor::*ExecuteMethodRef )();
     static ExecuteMethodRef* m_pExecuteMethodMap;
+    static int m_nInitCount;  // Init() calls not paired with Done() yet
 
 protected:  // Processor state
     uint16_t    m_internalTick;     // How many ticks waiting to the end of current instruction
@@ -79,6 +86,15 @@ protected:  // Interrupt processing
     bool        m_EVNTreset;        // EVNT interrupt request reset
 protected:
     CMotherboard* m_pBoard;
+    uint8_t*    m_pCoverage;        // Coverage map, see SetCoverageMap()
+    CPUTRAPCALLBACK m_TrapCallback;
+    void*       m_TrapParam;
+
+public:  // Instrumentation for the test harnesses, not saved in the state image
+    // Coverage map of 64 KB: byte N is set to 1 when the instruction at address (N & 077777) * 2 is executed,
+    // the upper half of the map is for HALT mode; nullptr to turn off
+    void        SetCoverageMap(uint8_t* pMap) { m_pCoverage = pMap; }
+    void        SetTrapCallback(CPUTRAPCALLBACK callback, void* param) { m_TrapCallback = callback; m_TrapParam = param; }
 
 public:  // Register control
     uint16_t    GetPSW() const { return m_psw; }  // Get the processor status word register value
@@ -132,6 +148,7 @@ public:  // Processor control
 public:  // Saving/loading emulator status (pImage addresses up to 32 bytes)
     void        SaveToImage(uint8_t* pImage) const;
     void        LoadFromImage(const uint8_t* pImage);
+    CProcessor* Clone(CMotherboard* pBoard) const;  // Copy of the processor for the cloned board
 
 protected:  // Implementation
     void        FetchInstruction();      // Read next instruction
@@ -253,6 +270,7 @@ protected:  // Implementation - instruction execution
     // Four fields
     void        ExecuteMOV ();
     void        ExecuteMOVB ();
+    bool        ExecuteFastReadLoop ();
     void        ExecuteCMP ();
     void        ExecuteCMPB ();
     void        ExecuteBIT ();
@@ -0,0 +1,197 @@
+﻿/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// Rewind.cpp
+// Rewind buffer: keyframes and deltas of the board state
+// See defines in header file Emubase.h
+
+#include "stdafx.h"
+#include "Emubase.h"
+
+
+//////////////////////////////////////////////////////////////////////
+// The entries go in groups: keyframe (full image), then deltas, each one over the previous entry.
+// When the budget is exceeded, the older groups lose their deltas first, keeping the keyframes only;
+// then the oldest keyframes are dropped. The newest group is never thinned.
+
+CRewindBuffer::CRewindBuffer()
+{
+    memset(m_entries, 0, sizeof(m_entries));
+    m_count = 0;
+    m_used = 0;
+    m_budget = 0;
+    m_interval = 5;
+    m_keyinterval = 25;
+    m_framecount = 0;
+    m_deltacount = 0;
+    m_pScratch = nullptr;
+    m_scratchsize = 0;
+}
+
+CRewindBuffer::~CRewindBuffer()
+{
+    Clear();
+    ::free(m_pScratch);
+}
+
+void CRewindBuffer::SetParams(uint32_t budget, int interval, int keyinterval)
+{
+    Clear();
+    m_budget = budget;
+    m_interval = (interval < 1) ? 1 : interval;
+    m_keyinterval = (keyinterval < 0) ? 0 : keyinterval;
+    if (budget == 0)
+    {
+        ::free(m_pScratch);
+        m_pScratch = nullptr;
+        m_scratchsize = 0;
+    }
+}
+
+void CRewindBuffer::Clear()
+{
+    RemoveEntries(0, m_count);
+    m_framecount = 0;
+    m_deltacount = 0;
+}
+
+void CRewindBuffer::RemoveEntries(int index, int count)
+{
+    for (int i = index; i < index + count; i++)
+    {
+        ::free(m_entries[i].pData);
+        m_used -= m_entries[i].size;
+    }
+    memmove(m_entries + index, m_entries + index + count, (m_count - index - count) * sizeof(RewindEntry));
+    m_count -= count;
+}
+
+bool CRewindBuffer::Frame(CMotherboard* pBoard, uint32_t uptime)
+{
+    if (m_budget == 0)
+        return false;
+    m_framecount++;
+    if (m_framecount < m_interval)
+        return false;
+
+    m_framecount = 0;
+    return Capture(pBoard, uptime);
+}
+
+bool CRewindBuffer::Capture(CMotherboard* pBoard, uint32_t uptime)
+{
+    uint32_t maxSize = StateImage_GetMaxSize(pBoard);
+    if (m_scratchsize < maxSize)
+    {
+        ::free(m_pScratch);
+        m_pScratch = (uint8_t*) ::malloc(maxSize);
+        m_scratchsize = (m_pScratch != nullptr) ? maxSize : 0;
+        if (m_pScratch == nullptr)
+            return false;
+    }
+
+    bool okKey = (m_count == 0 || m_deltacount >= m_keyinterval);
+    uint32_t size = okKey ?
+            StateImage_Save(pBoard, uptime, m_pScratch, m_scratchsize) :
+            StateImage_SaveDelta(pBoard, uptime, m_pScratch, m_scratchsize);
+    if (size == 0)
+    {
+        Clear();  // The delta chain is broken, start over from a keyframe
+        return false;
+    }
+    pBoard->ClearRAMDirtyMap();  // Next delta goes over this entry
+
+    // Make room for the new entry
+    while (m_count > 0 && (m_count >= REWIND_MAX_ENTRIES || m_used + size > m_budget))
+    {
+        if (!Thin())
+            break;
+    }
+    uint8_t* pData = nullptr;
+    if (m_count >= REWIND_MAX_ENTRIES || m_used + size > m_budget ||
+        (pData = (uint8_t*) ::malloc(size)) == nullptr)
+    {
+        Clear();  // Out of budget even with the newest group only, start over
+        return false;
+    }
+    memcpy(pData, m_pScratch, size);
+
+    RewindEntry* pEntry = m_entries + m_count;
+    pEntry->pData = pData;
+    pEntry->size = size;
+    pEntry->uptime = uptime;
+    pEntry->okKey = okKey;
+    m_count++;
+    m_used += size;
+    m_deltacount = okKey ? 0 : m_deltacount + 1;
+
+    return true;
+}
+
+bool CRewindBuffer::Thin()
+{
+    // Find the newest keyframe; everything before it could be thinned
+    int newestKey = m_count - 1;
+    while (newestKey > 0 && !m_entries[newestKey].okKey)
+        newestKey--;
+    if (newestKey == 0)
+        return false;
+
+    // Drop deltas of the oldest group having them
+    for (int key = 0; key < newestKey; )
+    {
+        int next = key + 1;
+        while (!m_entries[next].okKey)
+            next++;
+        if (next - key > 1)
+        {
+            RemoveEntries(key + 1, next - key - 1);
+            return true;
+        }
+        key = next;
+    }
+
+    // Only keyframes left before the newest group, drop the oldest one
+    RemoveEntries(0, 1);
+    return true;
+}
+
+bool CRewindBuffer::StepBack(CMotherboard* pBoard, uint32_t* pUptime)
+{
+    if (m_count == 0)
+        return false;
+    if (m_framecount == 0)  // We are at the newest entry already, step to the one before
+    {
+        if (m_count == 1)
+            return false;
+        RemoveEntries(m_count - 1, 1);
+    }
+
+    // Keyframe, then all the deltas up to the newest entry
+    int key = m_count - 1;
+    while (key > 0 && !m_entries[key].okKey)
+        key--;
+    bool okRestored = true;
+    for (int i = key; okRestored && i < m_count; i++)
+        okRestored = StateImage_Load(pBoard, m_entries[i].pData, m_entries[i].size, pUptime, false, false);
+    if (!okRestored)
+    {
+        Clear();
+        return false;
+    }
+
+    pBoard->ClearRAMDirtyMap();  // Next delta goes over the restored entry
+    m_framecount = 0;
+    m_deltacount = m_count - 1 - key;
+    return true;
+}
+
+
+//////////////////////////////////////////////////////////////////////
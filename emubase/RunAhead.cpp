@@ -0,0 +1,144 @@
+﻿/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// RunAhead.cpp
+// Run-ahead: frames emulated ahead and rolled back
+// See defines in header file Emubase.h
+
+#include "stdafx.h"
+#include "Emubase.h"
+
+
+//////////////////////////////////////////////////////////////////////
+// The RAM copy matches the board RAM outside of the pages marked in the board shadow map, which is ours only.
+// Sync() brings the copy up to date and clears the map, so after the frames run ahead the map tells exactly
+// which pages to take back from the copy. The dirty map of the deltas is saved and restored, as if nothing happened.
+
+// Copy the pages marked in the dirty map, joining the adjacent pages
+static void RunAhead_CopyPages(uint8_t* pDest, const uint8_t* pSrc, const uint64_t* pMap, uint32_t ramSize)
+{
+    uint32_t pageCount = ramSize / NEONIMAGE_RAM_PAGE_SIZE;
+    uint32_t page = 0;
+    while (page < pageCount)
+    {
+        if ((pMap[page / 64] & (((uint64_t)1) << (page % 64))) == 0)
+        {
+            page++;
+            continue;
+        }
+        uint32_t start = page;
+        while (page < pageCount && (pMap[page / 64] & (((uint64_t)1) << (page % 64))) != 0)
+            page++;
+        uint32_t offset = start * NEONIMAGE_RAM_PAGE_SIZE;
+        ::memcpy(pDest + offset, pSrc + offset, (page - start) * NEONIMAGE_RAM_PAGE_SIZE);
+    }
+}
+
+CRunAhead::CRunAhead()
+{
+    m_frames = 0;
+    m_pState = nullptr;
+    m_pShadow = nullptr;
+    m_shadowsize = 0;
+    m_okShadowValid = false;
+    m_okAhead = false;
+    memset(m_dirtysaved, 0, sizeof(m_dirtysaved));
+    m_tickssaved = 0;
+}
+
+CRunAhead::~CRunAhead()
+{
+    ::free(m_pState);
+    ::free(m_pShadow);
+}
+
+void CRunAhead::SetFrames(int frames)
+{
+    ASSERT(!m_okAhead);
+    m_frames = (frames < 0) ? 0 : frames;
+    if (m_frames == 0)
+    {
+        ::free(m_pState);  m_pState = nullptr;
+        ::free(m_pShadow);  m_pShadow = nullptr;
+        m_shadowsize = 0;
+    }
+    m_okShadowValid = false;
+}
+
+void CRunAhead::Sync(CMotherboard* pBoard)
+{
+    if (m_frames == 0)
+        return;
+
+    uint32_t ramSize = pBoard->GetRamSizeBytes();
+    if (m_shadowsize != ramSize)
+    {
+        ::free(m_pShadow);
+        m_pShadow = static_cast<uint8_t*>(::malloc(ramSize));
+        m_shadowsize = (m_pShadow != nullptr) ? ramSize : 0;
+        m_okShadowValid = false;
+        if (m_pShadow == nullptr)
+            return;
+    }
+
+    const CMotherboard* pConstBoard = pBoard;
+    if (!m_okShadowValid)
+    {
+        ::memcpy(m_pShadow, pConstBoard->GetRAMImage(), ramSize);
+        m_okShadowValid = true;
+    }
+    else
+        RunAhead_CopyPages(m_pShadow, pConstBoard->GetRAMImage(), pBoard->GetRAMShadowMap(), ramSize);
+    pBoard->ClearRAMShadowMap();
+}
+
+bool CRunAhead::Start(CMotherboard* pBoard)
+{
+    if (m_frames == 0 || m_okAhead)
+        return false;
+    if (m_pState == nullptr)
+    {
+        m_pState = static_cast<uint8_t*>(::malloc(NEONIMAGE_RAM_OFFSET));
+        if (m_pState == nullptr)
+            return false;
+    }
+    Sync(pBoard);
+    if (!m_okShadowValid)
+        return false;
+
+    pBoard->SaveToImage(m_pState, false);
+    memcpy(m_dirtysaved, pBoard->GetRAMDirtyMap(), sizeof(m_dirtysaved));
+    m_tickssaved = pBoard->GetTicks();
+    pBoard->SetScratchMode(true);
+    m_okAhead = true;
+
+    for (int frame = 0; frame < m_frames; frame++)
+        pBoard->SystemFrame();
+
+    return true;
+}
+
+void CRunAhead::Rollback(CMotherboard* pBoard)
+{
+    if (!m_okAhead)
+        return;
+
+    // The ticks go back first, so the disk devices leaving the scratch mode find their timers as they were
+    pBoard->SetTicks(m_tickssaved);
+    pBoard->SetScratchMode(false);
+    RunAhead_CopyPages(pBoard->GetRAMImage(), m_pShadow, pBoard->GetRAMShadowMap(), m_shadowsize);
+    pBoard->LoadFromImage(m_pState, false);
+    pBoard->SetRAMDirtyMap(m_dirtysaved);
+    pBoard->ClearRAMShadowMap();  // RAM is the same as the copy again
+    m_okAhead = false;
+}
+
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,204 @@
+﻿/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// SerialLink.cpp
+// Serial link of two machines running on their own threads
+// See defines in header file Emubase.h
+
+#include "stdafx.h"
+#include "Emubase.h"
+#include <pthread.h>
+
+
+//////////////////////////////////////////////////////////////////////
+// Time sync. The byte written at link time T comes to the other side at T + byte time or later, as the wire is busy
+// with the previous bytes. So a side may run up to the other side time + byte time without missing any byte:
+// whatever the other side sends later, comes later. The side runs to the next byte arrival, gives the byte
+// to the board and goes on, so the byte comes exactly at its arrival time.
+
+#define SERIALLINK_BOARD_TICKS_PER_SECOND  (NEON_FRAME_TICKS * 25)
+#define SERIALLINK_QUEUE_SIZE  256  // Initial size of the bytes queue, it grows if needed
+
+struct SerialLinkSync
+{
+    pthread_mutex_t mutex;  // Guards the sides
+    pthread_cond_t condition;  // A side moved on
+};
+
+
+//////////////////////////////////////////////////////////////////////
+
+
+CSerialLink::CSerialLink(CMotherboard* pBoard1, CMotherboard* pBoard2, int baudRate)
+{
+    ASSERT(pBoard1 != nullptr && pBoard2 != nullptr && baudRate > 0);
+    m_bytetime = SERIALLINK_BOARD_TICKS_PER_SECOND * 10 / baudRate;  // Start bit, 8 data bits, stop bit
+    if (m_bytetime < 1)
+        m_bytetime = 1;
+
+    SerialLinkSync* pSync = new SerialLinkSync();
+    pthread_mutex_init(&pSync->mutex, nullptr);
+    pthread_cond_init(&pSync->condition, nullptr);
+    m_pSync = pSync;
+
+    for (int i = 0; i < 2; i++)
+    {
+        Side* pSide = m_sides + i;
+        pSide->pLink = this;
+        pSide->pBoard = (i == 0) ? pBoard1 : pBoard2;
+        pSide->tickbase = pSide->pBoard->GetTicks();
+        pSide->ticks = pSide->target = pSide->lastarrival = 0;
+        pSide->pQueue = static_cast<uint64_t*>(::malloc(SERIALLINK_QUEUE_SIZE * sizeof(uint64_t)));
+        pSide->queuehead = pSide->queuecount = 0;
+        pSide->queuesize = (pSide->pQueue == nullptr) ? 0 : SERIALLINK_QUEUE_SIZE;
+        pSide->okStopped = false;
+        pSide->pBoard->SetSerialOutCallback(OnSerialOutput, pSide);
+    }
+}
+
+CSerialLink::~CSerialLink()
+{
+    for (int i = 0; i < 2; i++)
+    {
+        m_sides[i].pBoard->SetSerialOutCallback(nullptr);
+        ::free(m_sides[i].pQueue);
+    }
+
+    SerialLinkSync* pSync = static_cast<SerialLinkSync*>(m_pSync);
+    pthread_cond_destroy(&pSync->condition);
+    pthread_mutex_destroy(&pSync->mutex);
+    delete pSync;
+}
+
+// Called by the board from inside SystemTicks(), on the thread running this side
+void CALLBACK CSerialLink::OnSerialOutput(void* param, uint8_t byte)
+{
+    Side* pSide = static_cast<Side*>(param);
+    SerialLinkSync* pSync = static_cast<SerialLinkSync*>(pSide->pLink->m_pSync);
+    int bytetime = pSide->pLink->m_bytetime;
+
+    pthread_mutex_lock(&pSync->mutex);
+    uint64_t arrival = pSide->pBoard->GetTicks() - pSide->tickbase + bytetime;
+    if (arrival < pSide->lastarrival + bytetime)
+        arrival = pSide->lastarrival + bytetime;
+
+    if (pSide->queuehead + pSide->queuecount == pSide->queuesize)  // No room at the end
+    {
+        if (pSide->queuehead > 0)
+        {
+            ::memmove(pSide->pQueue, pSide->pQueue + pSide->queuehead, pSide->queuecount * sizeof(uint64_t));
+            pSide->queuehead = 0;
+        }
+        else
+        {
+            int newsize = (pSide->queuesize == 0) ? SERIALLINK_QUEUE_SIZE : pSide->queuesize * 2;
+            uint64_t* pNewQueue = static_cast<uint64_t*>(::realloc(pSide->pQueue, newsize * sizeof(uint64_t)));
+            if (pNewQueue == nullptr)
+            {
+                pthread_mutex_unlock(&pSync->mutex);
+                return;  // Out of memory, the byte is lost
+            }
+            pSide->pQueue = pNewQueue;
+            pSide->queuesize = newsize;
+        }
+    }
+    pSide->pQueue[pSide->queuehead + pSide->queuecount++] = (arrival << 8) | byte;
+    pSide->lastarrival = arrival;
+    pthread_mutex_unlock(&pSync->mutex);
+}
+
+bool CSerialLink::RunSide(int side, bool okWait)
+{
+    Side* pSide = m_sides + side;
+    Side* pOther = m_sides + (1 - side);  // Its queue has the bytes for this side
+    SerialLinkSync* pSync = static_cast<SerialLinkSync*>(m_pSync);
+
+    pthread_mutex_lock(&pSync->mutex);
+    for (;;)
+    {
+        uint64_t limit = pOther->okStopped ? pSide->target : pOther->ticks + m_bytetime;
+        if (pSide->ticks >= pSide->target || pSide->okStopped)
+            break;
+        if (limit <= pSide->ticks)  // Too far ahead of the other side
+        {
+            if (!okWait)
+            {
+                pthread_mutex_unlock(&pSync->mutex);
+                return false;
+            }
+            pthread_cond_wait(&pSync->condition, &pSync->mutex);
+            continue;
+        }
+
+        // Take the bytes arrived by now
+        while (pOther->queuecount > 0 && (pOther->pQueue[pOther->queuehead] >> 8) <= pSide->ticks)
+        {
+            pSide->pBoard->SerialInput((uint8_t)(pOther->pQueue[pOther->queuehead] & 0xff));
+            pOther->queuehead++;  pOther->queuecount--;
+        }
+        uint64_t end = (limit < pSide->target) ? limit : pSide->target;
+        if (pOther->queuecount > 0 && (pOther->pQueue[pOther->queuehead] >> 8) < end)
+            end = pOther->pQueue[pOther->queuehead] >> 8;
+        uint64_t start = pSide->ticks;
+        if (end - start > NEON_FRAME_TICKS)
+            end = start + NEON_FRAME_TICKS;
+        pthread_mutex_unlock(&pSync->mutex);
+
+        bool okRun = pSide->pBoard->SystemTicks((int)(end - start));
+
+        pthread_mutex_lock(&pSync->mutex);
+        pSide->ticks = end;
+        if (!okRun)
+            pSide->okStopped = true;
+        pthread_cond_broadcast(&pSync->condition);
+    }
+    pthread_mutex_unlock(&pSync->mutex);
+    return true;
+}
+
+void* CSerialLink::ThreadProc(void* param)
+{
+    Side* pSide = static_cast<Side*>(param);
+    pSide->pLink->RunSide((int)(pSide - pSide->pLink->m_sides), true);
+    return nullptr;
+}
+
+bool CSerialLink::Run(uint64_t ticks)
+{
+    SerialLinkSync* pSync = static_cast<SerialLinkSync*>(m_pSync);
+    pthread_mutex_lock(&pSync->mutex);
+    for (int i = 0; i < 2; i++)
+    {
+        m_sides[i].okStopped = false;
+        m_sides[i].target = m_sides[i].ticks + ticks;
+    }
+    pthread_mutex_unlock(&pSync->mutex);
+
+    pthread_t thread;
+    if (pthread_create(&thread, nullptr, ThreadProc, m_sides + 1) == 0)
+    {
+        RunSide(0, true);
+        pthread_join(thread, nullptr);
+    }
+    else  // No threads in this build, or out of resources: take turns
+    {
+        bool okDone0 = false, okDone1 = false;
+        while (!okDone0 || !okDone1)
+        {
+            okDone0 = RunSide(0, false);
+            okDone1 = RunSide(1, false);
+        }
+    }
+
+    return !m_sides[0].okStopped && !m_sides[1].okStopped;
+}
+
+
+//////////////////////////////////////////////////////////////////////
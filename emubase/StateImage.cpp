@@ -0,0 +1,852 @@
+﻿/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// StateImage.cpp
+// Emulator state image (.neonst) saving and loading
+// See defines in header file Emubase.h
+
+#include "stdafx.h"
+#include "Emubase.h"
+#include <pthread.h>
+#include "../util/lz4.h"
+
+
+//////////////////////////////////////////////////////////////////////
+//
+// Emulator state image format, version 2.0
+//  Offset Length
+//       0     32 bytes  - Header, not compressed
+//      32               - Chunks, every chunk is NeonImageChunk header + data padded to 4 bytes
+//                       - Index chunk, the last one
+//
+//  Header (8 x uint32):
+//       0      8 bytes  - NEONIMAGE_HEADER1, NEONIMAGE_HEADER2
+//       8      4 bytes  - NEONIMAGE_VERSION
+//      12      4 bytes  - State size, uncompressed sum of all the chunks except the index
+//      16      4 bytes  - Uptime, seconds
+//      20      4 bytes  - Body size, everything after the header
+//      24      4 bytes  - Number of chunks, except the index
+//      28      4 bytes  - Index chunk offset
+//
+//  Chunks, sections of the version 1.0 layout (see Board.cpp) are kept as is:
+//    "BORD"   400 bytes - Board status, required
+//    "CPU "    80 bytes - CPU status, required
+//    "HDBF"  2048 bytes - HD buffers 2K
+//    "FDC "    64 bytes - Floppy controller status
+//    "ROM "   16 KB     - ROM image
+//    "ROMH"     8 bytes - Instead of the ROM image, if it is a known one: Adler-32 and FNV-1a of the ROM
+//    "RAM "   64 KB     - RAM, one chunk per NEONIMAGE_RAM_CHUNK_SIZE block, chunk number = block number
+//    "INDX"             - Index, one NeonImageIndexEntry per chunk, not compressed
+//  Every chunk is compressed independently, so the chunks could be loaded in any order, or on demand.
+//  Unknown chunks are skipped; missing optional chunks keep the current board state.
+//
+//  Delta image has the same format, but instead of ROM and RAM chunks it has:
+//    "DLTA"     4 bytes - Delta marker: RAM page size, NEONIMAGE_RAM_PAGE_SIZE
+//    "RAMP"             - RAM pages written since the previous delta, one chunk per RAM chunk having such pages,
+//                         chunk number = RAM chunk number; data is uint64 page mask, then the pages in order
+//  The delta is applied over the state it was taken from: the base image with all the deltas before.
+
+#define NEONCHUNK_BOARD   0x44524F42  // "BORD"
+#define NEONCHUNK_CPU     0x20555043  // "CPU "
+#define NEONCHUNK_HDBUFF  0x46424448  // "HDBF"
+#define NEONCHUNK_FLOPPY  0x20434446  // "FDC "
+#define NEONCHUNK_ROM     0x204D4F52  // "ROM "
+#define NEONCHUNK_RAM     0x204D4152  // "RAM "
+#define NEONCHUNK_INDEX   0x58444E49  // "INDX"
+#define NEONCHUNK_DELTA   0x41544C44  // "DLTA"
+#define NEONCHUNK_RAMPAGES 0x504D4152  // "RAMP"
+#define NEONCHUNK_ROMHASH 0x484D4F52  // "ROMH"
+
+#define NEONCHUNK_FLAG_LZ4  1  // Chunk data is LZ4 compressed
+
+// Offsets and sizes of the sections in the version 1.0 layout
+#define NEONIMAGE_BOARD_OFFSET     32
+#define NEONIMAGE_BOARD_SIZE      400
+#define NEONIMAGE_CPU_OFFSET      432
+#define NEONIMAGE_CPU_SIZE         80
+#define NEONIMAGE_HDBUFF_OFFSET   512
+#define NEONIMAGE_HDBUFF_SIZE    2048
+#define NEONIMAGE_ROM_OFFSET     3072
+#define NEONIMAGE_ROM_SIZE      16384
+
+#define NEONIMAGE_MAX_RAM_CHUNKS   64  // 4096 KB max
+#define NEONIMAGE_MAX_KNOWN_ROMS    4
+
+struct NeonImageChunk  // Chunk header, 20 bytes
+{
+    uint32_t tag;         // NEONCHUNK_XXX
+    uint16_t number;      // Chunk number for the multi-chunk sections like RAM
+    uint16_t flags;       // NEONCHUNK_FLAG_XXX
+    uint32_t size;        // Data size, uncompressed
+    uint32_t storedSize;  // Data size as stored, without the padding
+    uint32_t checksum;    // Adler-32 of the uncompressed data
+};
+
+struct NeonImageIndexEntry  // Index entry, 12 bytes
+{
+    uint32_t tag;
+    uint16_t number;
+    uint16_t reserved;
+    uint32_t offset;      // Chunk header offset from the image start
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// Chunks
+
+// Adler-32 checksum
+static uint32_t StateImage_Checksum(const uint8_t* pData, uint32_t size)
+{
+    uint32_t a = 1, b = 0;
+    while (size > 0)
+    {
+        uint32_t count = (size > 5552) ? 5552 : size;  // Max count without the 32-bit overflow
+        size -= count;
+        while (count-- > 0)
+        {
+            a += *pData++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+// ROM hash for the "ROMH" chunk: Adler-32, then FNV-1a
+static void StateImage_RomHash(const uint8_t* pRom, uint32_t* pHash)
+{
+    pHash[0] = StateImage_Checksum(pRom, NEONIMAGE_ROM_SIZE);
+    uint32_t fnv = 2166136261u;
+    for (uint32_t i = 0; i < NEONIMAGE_ROM_SIZE; i++)
+        fnv = (fnv ^ pRom[i]) * 16777619u;
+    pHash[1] = fnv;
+}
+
+// Buffer size enough for the chunk with the given data size
+static uint32_t StateImage_GetChunkMaxSize(uint32_t size)
+{
+    return sizeof(NeonImageChunk) + ((LZ4_COMPRESSBOUND(size) + 3) & ~3);
+}
+
+// Write the chunk: header, then the data, compressed if it gets smaller.
+// Returns the number of bytes written to pDest, or 0 on failure.
+static uint32_t StateImage_WriteChunk(
+    uint32_t tag, uint16_t number, const uint8_t* pSrc, uint32_t size, uint8_t* pDest, uint32_t destSize)
+{
+    if (destSize < sizeof(NeonImageChunk))
+        return 0;
+    uint8_t* pData = pDest + sizeof(NeonImageChunk);
+    uint32_t dataCapacity = destSize - sizeof(NeonImageChunk);
+
+    NeonImageChunk chunk;
+    chunk.tag = tag;
+    chunk.number = number;
+    chunk.flags = NEONCHUNK_FLAG_LZ4;
+    chunk.size = size;
+    chunk.checksum = StateImage_Checksum(pSrc, size);
+
+    int compressedSize = LZ4_compress_fast(
+            (const char*)pSrc, (char*)pData, (int)size, (int)((dataCapacity < size) ? dataCapacity : size - 1), 1);
+    if (compressedSize > 0)
+        chunk.storedSize = (uint32_t)compressedSize;
+    else  // Not compressible, store as is
+    {
+        if (dataCapacity < size)
+            return 0;
+        memcpy(pData, pSrc, size);
+        chunk.flags = 0;
+        chunk.storedSize = size;
+    }
+
+    uint32_t paddedSize = (chunk.storedSize + 3) & ~3;
+    if (paddedSize > dataCapacity)
+        return 0;
+    memset(pData + chunk.storedSize, 0, paddedSize - chunk.storedSize);
+    memcpy(pDest, &chunk, sizeof(chunk));
+    return sizeof(NeonImageChunk) + paddedSize;
+}
+
+// Read the chunk data to the buffer of exactly the chunk data size, and check the checksum.
+// The chunk must be validated with StateImage_FindChunk() before.
+static bool StateImage_ReadChunk(const NeonImageChunk* pChunk, uint8_t* pDest, uint32_t destSize)
+{
+    if (pChunk->size != destSize)
+        return false;
+    const uint8_t* pData = (const uint8_t*)pChunk + sizeof(NeonImageChunk);
+    if ((pChunk->flags & NEONCHUNK_FLAG_LZ4) != 0)
+    {
+        int decompressedSize = LZ4_decompress_safe((const char*)pData, (char*)pDest, (int)pChunk->storedSize, (int)destSize);
+        if (decompressedSize != (int)destSize)
+            return false;
+    }
+    else
+    {
+        if (pChunk->storedSize != destSize)
+            return false;
+        memcpy(pDest, pData, destSize);
+    }
+
+    return StateImage_Checksum(pDest, destSize) == pChunk->checksum;
+}
+
+// Check the chunk sizes without reading the data: the data must come to exactly the given size.
+// The data itself is checked by StateImage_ReadChunk(), against the checksum.
+static bool StateImage_CheckChunkSize(const NeonImageChunk* pChunk, uint32_t size)
+{
+    if (pChunk->size != size || (pChunk->flags & ~NEONCHUNK_FLAG_LZ4) != 0)
+        return false;
+    if ((pChunk->flags & NEONCHUNK_FLAG_LZ4) != 0)
+        return pChunk->storedSize != 0 && pChunk->storedSize <= (uint32_t)LZ4_COMPRESSBOUND(size);
+    return pChunk->storedSize == size;
+}
+
+// Get the chunk at the offset, checking that it fits the image. Returns nullptr if it does not.
+static const NeonImageChunk* StateImage_FindChunk(const uint8_t* pData, uint32_t dataSize, uint32_t offset)
+{
+    if ((offset & 3) != 0 || offset < NEONIMAGE_HEADER_SIZE || offset > dataSize - sizeof(NeonImageChunk))
+        return nullptr;
+    const NeonImageChunk* pChunk = (const NeonImageChunk*)(pData + offset);
+    if (pChunk->storedSize > dataSize - offset - sizeof(NeonImageChunk))
+        return nullptr;
+    return pChunk;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Thread pool for the RAM chunks, which are compressed and decompressed independently.
+// Every task writes to its own place only, so the result does not depend on the number of threads.
+
+typedef void (*STATEIMAGETASK)(void* param, int index);
+
+struct StateImageJob
+{
+    STATEIMAGETASK task;
+    void*    param;
+    int      count;
+    int      next;      // Next task index to take
+    int      done;      // Number of tasks finished
+};
+
+static pthread_t g_Threads[STATEIMAGE_MAX_THREADS];
+static std::atomic<int> g_nThreadCount(0);  // Worker threads, not counting the caller; changed under g_CallMutex
+static bool g_okThreadsExit = false;
+static StateImageJob* g_pJob = nullptr;
+static pthread_mutex_t g_JobMutex = PTHREAD_MUTEX_INITIALIZER;  // Guards the job and the flags above
+static pthread_cond_t g_JobCondition = PTHREAD_COND_INITIALIZER;  // New job or exit
+static pthread_cond_t g_DoneCondition = PTHREAD_COND_INITIALIZER;  // All the job tasks done
+static pthread_mutex_t g_CallMutex = PTHREAD_MUTEX_INITIALIZER;  // One pool job at a time
+
+// Take and run the job tasks until none left; called with g_JobMutex locked
+static void StateImage_RunTasks(StateImageJob* pJob)
+{
+    while (pJob->next < pJob->count)
+    {
+        int index = pJob->next++;
+        pthread_mutex_unlock(&g_JobMutex);
+        pJob->task(pJob->param, index);
+        pthread_mutex_lock(&g_JobMutex);
+        pJob->done++;
+        if (pJob->done == pJob->count)
+            pthread_cond_broadcast(&g_DoneCondition);
+    }
+}
+
+static void* StateImage_ThreadProc(void*)
+{
+    pthread_mutex_lock(&g_JobMutex);
+    for (;;)
+    {
+        while (!g_okThreadsExit && (g_pJob == nullptr || g_pJob->next >= g_pJob->count))
+            pthread_cond_wait(&g_JobCondition, &g_JobMutex);
+        if (g_okThreadsExit)
+            break;
+        StateImage_RunTasks(g_pJob);
+    }
+    pthread_mutex_unlock(&g_JobMutex);
+    return nullptr;
+}
+
+void StateImage_SetThreadCount(int count)
+{
+    pthread_mutex_lock(&g_CallMutex);
+
+    // Stop the current threads
+    pthread_mutex_lock(&g_JobMutex);
+    g_okThreadsExit = true;
+    pthread_cond_broadcast(&g_JobCondition);
+    pthread_mutex_unlock(&g_JobMutex);
+    for (int i = 0; i < g_nThreadCount; i++)
+        pthread_join(g_Threads[i], nullptr);
+    g_nThreadCount = 0;
+    g_okThreadsExit = false;
+
+    // Start the new ones; the caller thread works too
+    if (count > STATEIMAGE_MAX_THREADS)
+        count = STATEIMAGE_MAX_THREADS;
+    for (int i = 0; i < count - 1; i++)
+    {
+        if (pthread_create(&g_Threads[g_nThreadCount], nullptr, StateImage_ThreadProc, nullptr) != 0)
+            break;  // No threads in this build, or out of resources
+        g_nThreadCount++;
+    }
+
+    pthread_mutex_unlock(&g_CallMutex);
+}
+
+// Run the tasks 0..count-1 on the thread pool and wait for all of them
+static void StateImage_ParallelFor(int count, STATEIMAGETASK task, void* param)
+{
+    // No pool: the tasks run right on the caller thread, with no lock, so the calls from the other threads
+    // (the batch runner workers, for one) go side by side
+    if (g_nThreadCount == 0 || count <= 1)
+    {
+        for (int index = 0; index < count; index++)
+            task(param, index);
+        return;
+    }
+
+    pthread_mutex_lock(&g_CallMutex);  // The pool could be gone meanwhile, then the caller runs all the tasks
+    StateImageJob job;
+    job.task = task;
+    job.param = param;
+    job.count = count;
+    job.next = job.done = 0;
+    pthread_mutex_lock(&g_JobMutex);
+    g_pJob = &job;
+    pthread_cond_broadcast(&g_JobCondition);
+    StateImage_RunTasks(&job);
+    while (job.done < job.count)
+        pthread_cond_wait(&g_DoneCondition, &g_JobMutex);
+    g_pJob = nullptr;
+    pthread_mutex_unlock(&g_JobMutex);
+    pthread_mutex_unlock(&g_CallMutex);
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Known ROM images, saved by hash only
+
+static const uint8_t* g_pKnownRoms[NEONIMAGE_MAX_KNOWN_ROMS];
+static int g_nKnownRomCount = 0;
+
+void StateImage_AddKnownRom(const uint8_t* pRom)
+{
+    if (g_nKnownRomCount < NEONIMAGE_MAX_KNOWN_ROMS)
+        g_pKnownRoms[g_nKnownRomCount++] = pRom;
+}
+
+// Find the known ROM equal to the given one; returns nullptr if not found
+static const uint8_t* StateImage_FindKnownRom(const uint8_t* pRom)
+{
+    for (int i = 0; i < g_nKnownRomCount; i++)
+    {
+        if (memcmp(g_pKnownRoms[i], pRom, NEONIMAGE_ROM_SIZE) == 0)
+            return g_pKnownRoms[i];
+    }
+    return nullptr;
+}
+
+// Find the known ROM by hash; returns nullptr if not found
+static const uint8_t* StateImage_FindKnownRomByHash(const uint32_t* pHash)
+{
+    for (int i = 0; i < g_nKnownRomCount; i++)
+    {
+        uint32_t hash[2];
+        StateImage_RomHash(g_pKnownRoms[i], hash);
+        if (hash[0] == pHash[0] && hash[1] == pHash[1])
+            return g_pKnownRoms[i];
+    }
+    return nullptr;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Lazy RAM loading
+
+struct StateImageRamSource  // Source for the RAM chunks not loaded yet
+{
+    const uint8_t* pData;  // The image, the chunks are read in place
+    bool     okOwnData;    // pData is given to the source, see StateImage_Load()
+    const NeonImageChunk* chunks[NEONIMAGE_MAX_RAM_CHUNKS];
+};
+
+static bool CALLBACK StateImage_LoadRamChunk(void* param, int chunk, uint8_t* pDest)
+{
+    StateImageRamSource* pSource = (StateImageRamSource*)param;
+    if (chunk < 0)  // Release
+    {
+        if (pSource->okOwnData)
+            ::free(const_cast<uint8_t*>(pSource->pData));
+        delete pSource;
+        return true;
+    }
+
+    return StateImage_ReadChunk(pSource->chunks[chunk], pDest, NEONIMAGE_RAM_CHUNK_SIZE);
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Version 1.0 loading
+
+// Version 1.0 image size for the configuration, the first word of the board state after the header
+static uint32_t StateImage_GetVersion1Size(const uint8_t* pBoardState)
+{
+    uint16_t configuration = *((const uint16_t*)pBoardState);
+    return NEONIMAGE_RAM_OFFSET + CMotherboard::GetRamSizeForConfiguration(configuration);
+}
+
+// Version 1.0 image: the body is one LZ4 block, so we need the whole image decompressed
+static bool StateImage_LoadVersion1(CMotherboard* pBoard, const uint8_t* pData, uint32_t dataSize)
+{
+    const uint32_t* pHeader = (const uint32_t*)pData;
+    uint32_t stateSize = pHeader[3];
+    uint32_t compressedSize = pHeader[5];
+    if (stateSize <= NEONIMAGE_RAM_OFFSET || compressedSize > dataSize - NEONIMAGE_HEADER_SIZE)
+        return false;
+    const uint8_t* pSrc = pData + NEONIMAGE_HEADER_SIZE;
+
+    // The configuration comes first, it tells the image size to expect
+    uint16_t configuration = 0;
+    if (LZ4_decompress_safe_partial((const char*)pSrc, (char*)&configuration, (int)compressedSize,
+                sizeof(configuration), sizeof(configuration)) != sizeof(configuration) ||
+        stateSize != StateImage_GetVersion1Size((const uint8_t*)&configuration))
+        return false;
+    uint8_t* pImage = (uint8_t*) ::calloc(stateSize, 1);
+    if (pImage == nullptr)
+        return false;
+    int decompressedSize = LZ4_decompress_safe(
+            (const char*)pSrc, (char*)(pImage + NEONIMAGE_HEADER_SIZE), (int)compressedSize, (int)stateSize - NEONIMAGE_HEADER_SIZE);
+    memcpy(pImage, pData, NEONIMAGE_HEADER_SIZE);
+    bool okLoaded = decompressedSize == (int)stateSize - NEONIMAGE_HEADER_SIZE && pBoard->LoadFromImage(pImage);
+    ::free(pImage);
+    return okLoaded;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// Version 2.0 saving/loading
+
+uint32_t StateImage_GetMaxSize(const CMotherboard* pBoard)
+{
+    uint32_t ramChunkCount = pBoard->GetRamSizeBytes() / NEONIMAGE_RAM_CHUNK_SIZE;
+    uint32_t chunkCount = 6 + ramChunkCount;
+    return NEONIMAGE_HEADER_SIZE +
+            StateImage_GetChunkMaxSize(NEONIMAGE_BOARD_SIZE) +
+            StateImage_GetChunkMaxSize(NEONIMAGE_CPU_SIZE) +
+            StateImage_GetChunkMaxSize(NEONIMAGE_HDBUFF_SIZE) +
+            StateImage_GetChunkMaxSize(FLOPPY_IMAGE_SIZE) +
+            StateImage_GetChunkMaxSize(NEONIMAGE_ROM_SIZE) +
+            StateImage_GetChunkMaxSize(sizeof(uint32_t)) +
+            ramChunkCount * StateImage_GetChunkMaxSize(sizeof(uint64_t) + NEONIMAGE_RAM_CHUNK_SIZE) +
+            sizeof(NeonImageChunk) + chunkCount * sizeof(NeonImageIndexEntry);
+}
+
+// Number of pages in the RAM chunk page mask
+static uint32_t StateImage_CountPages(uint64_t mask)
+{
+    uint32_t count = 0;
+    for (; mask != 0; mask &= mask - 1)
+        count++;
+    return count;
+}
+
+struct StateImageSaveRamJob  // RAM chunks to compress, see StateImage_SaveRamChunk()
+{
+    const uint8_t*  chunks[NEONIMAGE_MAX_RAM_CHUNKS];  // See CMotherboard::GetRAMChunk()
+    const uint64_t* pDirtyMap;  // Changed pages, for the delta only
+    uint8_t*  pDest;            // Place for the first chunk
+    uint32_t  slotSize;         // Place for every chunk, enough for the worst case
+    uint32_t  written[NEONIMAGE_MAX_RAM_CHUNKS];  // Bytes written, 0 on failure
+};
+
+// Compress one RAM chunk to its own place in the buffer; for the delta - changed pages only
+static void StateImage_SaveRamChunk(void* param, int chunk)
+{
+    StateImageSaveRamJob* pJob = (StateImageSaveRamJob*)param;
+    const uint8_t* pSrc = pJob->chunks[chunk];
+    uint8_t* pDest = pJob->pDest + chunk * pJob->slotSize;
+    pJob->written[chunk] = 0;
+    if (pJob->pDirtyMap == nullptr)
+    {
+        pJob->written[chunk] = StateImage_WriteChunk(
+                NEONCHUNK_RAM, (uint16_t)chunk, pSrc, NEONIMAGE_RAM_CHUNK_SIZE, pDest, pJob->slotSize);
+        return;
+    }
+
+    // Changed pages only: page mask, then the pages
+    uint64_t mask = pJob->pDirtyMap[chunk];
+    if (mask == 0)
+        return;
+    uint8_t* pPages = (uint8_t*) ::malloc(sizeof(mask) + NEONIMAGE_RAM_CHUNK_SIZE);
+    if (pPages == nullptr)
+        return;
+    memcpy(pPages, &mask, sizeof(mask));
+    uint8_t* pPage = pPages + sizeof(mask);
+    for (uint32_t page = 0; page < 64; page++)
+    {
+        if ((mask & (((uint64_t)1) << page)) == 0)
+            continue;
+        memcpy(pPage, pSrc + page * NEONIMAGE_RAM_PAGE_SIZE, NEONIMAGE_RAM_PAGE_SIZE);
+        pPage += NEONIMAGE_RAM_PAGE_SIZE;
+    }
+    pJob->written[chunk] = StateImage_WriteChunk(
+            NEONCHUNK_RAMPAGES, (uint16_t)chunk, pPages, (uint32_t)(pPage - pPages), pDest, pJob->slotSize);
+    ::free(pPages);
+}
+
+// Save the chunks; for the delta image - RAM pages written since the last delta only, and no ROM
+static uint32_t StateImage_SaveChunks(CMotherboard* pBoard, uint32_t uptime, uint8_t* pBuffer, uint32_t bufferSize, bool okDelta)
+{
+    if (pBuffer == nullptr || bufferSize < StateImage_GetMaxSize(pBoard))
+        return 0;
+
+    // Everything before the RAM in the version 1.0 layout, to cut the chunks from
+    uint8_t* pImage = (uint8_t*) ::calloc(NEONIMAGE_RAM_OFFSET, 1);
+    if (pImage == nullptr)
+        return 0;
+    pBoard->SaveToImage(pImage, false);
+    uint8_t floppyImage[FLOPPY_IMAGE_SIZE];
+    pBoard->GetFloppyCtl()->SaveToImage(floppyImage);
+    uint32_t pageSize = NEONIMAGE_RAM_PAGE_SIZE;
+    uint32_t romHash[2];
+
+    uint32_t ramSize = pBoard->GetRamSizeBytes();
+    uint32_t ramChunkCount = ramSize / NEONIMAGE_RAM_CHUNK_SIZE;
+
+    const uint32_t maxChunkCount = 6 + NEONIMAGE_MAX_RAM_CHUNKS;
+    NeonImageIndexEntry index[maxChunkCount];
+    memset(index, 0, sizeof(index));
+    uint32_t chunkCount = 0;
+    uint32_t stateSize = 0;
+    uint32_t offset = NEONIMAGE_HEADER_SIZE;
+    bool okSaved = true;
+
+    struct { uint32_t tag; const uint8_t* pSrc; uint32_t size; } sections[] =
+    {
+        { NEONCHUNK_BOARD,  pImage + NEONIMAGE_BOARD_OFFSET,  NEONIMAGE_BOARD_SIZE },
+        { NEONCHUNK_CPU,    pImage + NEONIMAGE_CPU_OFFSET,    NEONIMAGE_CPU_SIZE },
+        { NEONCHUNK_HDBUFF, pImage + NEONIMAGE_HDBUFF_OFFSET, NEONIMAGE_HDBUFF_SIZE },
+        { NEONCHUNK_FLOPPY, floppyImage,                      FLOPPY_IMAGE_SIZE },
+        { NEONCHUNK_ROM,    pImage + NEONIMAGE_ROM_OFFSET,    NEONIMAGE_ROM_SIZE },
+    };
+    if (okDelta)  // Delta marker instead of ROM
+    {
+        sections[4].tag = NEONCHUNK_DELTA;
+        sections[4].pSrc = (const uint8_t*)&pageSize;
+        sections[4].size = sizeof(pageSize);
+    }
+    else if (StateImage_FindKnownRom(pImage + NEONIMAGE_ROM_OFFSET) != nullptr)  // ROM hash instead of ROM
+    {
+        StateImage_RomHash(pImage + NEONIMAGE_ROM_OFFSET, romHash);
+        sections[4].tag = NEONCHUNK_ROMHASH;
+        sections[4].pSrc = (const uint8_t*)romHash;
+        sections[4].size = sizeof(romHash);
+    }
+    for (uint32_t i = 0; okSaved && i < 5; i++)
+    {
+        uint32_t written = StateImage_WriteChunk(
+                sections[i].tag, 0, sections[i].pSrc, sections[i].size, pBuffer + offset, bufferSize - offset);
+        okSaved = written != 0;
+        index[chunkCount].tag = sections[i].tag;
+        index[chunkCount].offset = offset;
+        chunkCount++;
+        stateSize += sections[i].size;
+        offset += written;
+    }
+    ::free(pImage);
+    if (!okSaved)
+        return 0;
+
+    // RAM chunks in parallel, each one to its worst case sized place in the buffer;
+    // the buffer has room for that, see StateImage_GetMaxSize(). Then move them together, in order.
+    // The chunks shared with the cloned boards are read in place, see CMotherboard::GetRAMChunk().
+    StateImageSaveRamJob* pJob = new StateImageSaveRamJob();
+    for (uint32_t chunk = 0; chunk < ramChunkCount; chunk++)
+        pJob->chunks[chunk] = pBoard->GetRAMChunk(chunk);
+    pJob->pDirtyMap = okDelta ? pBoard->GetRAMDirtyMap() : nullptr;
+    pJob->pDest = pBuffer + offset;
+    pJob->slotSize = StateImage_GetChunkMaxSize(sizeof(uint64_t) + NEONIMAGE_RAM_CHUNK_SIZE);
+    StateImage_ParallelFor(ramChunkCount, StateImage_SaveRamChunk, pJob);
+    for (uint32_t chunk = 0; okSaved && chunk < ramChunkCount; chunk++)
+    {
+        if (okDelta && pJob->pDirtyMap[chunk] == 0)  // No changes
+            continue;
+        uint32_t written = pJob->written[chunk];
+        okSaved = written != 0;
+        const NeonImageChunk* pChunk = (const NeonImageChunk*)(pJob->pDest + chunk * pJob->slotSize);
+        index[chunkCount].tag = pChunk->tag;
+        index[chunkCount].number = (uint16_t)chunk;
+        index[chunkCount].offset = offset;
+        chunkCount++;
+        stateSize += pChunk->size;
+        memmove(pBuffer + offset, pChunk, written);
+        offset += written;
+    }
+    delete pJob;
+    if (!okSaved)
+        return 0;
+
+    // Index chunk, not compressed so it could be used right from the image
+    uint32_t indexOffset = offset;
+    uint32_t indexSize = chunkCount * sizeof(NeonImageIndexEntry);
+    if (bufferSize - offset < sizeof(NeonImageChunk) + indexSize)
+        return 0;
+    NeonImageChunk indexChunk;
+    indexChunk.tag = NEONCHUNK_INDEX;
+    indexChunk.number = 0;
+    indexChunk.flags = 0;
+    indexChunk.size = indexChunk.storedSize = indexSize;
+    indexChunk.checksum = StateImage_Checksum((const uint8_t*)index, indexSize);
+    memcpy(pBuffer + offset, &indexChunk, sizeof(indexChunk));
+    memcpy(pBuffer + offset + sizeof(indexChunk), index, indexSize);
+    offset += sizeof(NeonImageChunk) + indexSize;
+
+    // Header
+    uint32_t* pHeader = (uint32_t*)pBuffer;
+    pHeader[0] = NEONIMAGE_HEADER1;
+    pHeader[1] = NEONIMAGE_HEADER2;
+    pHeader[2] = NEONIMAGE_VERSION;
+    pHeader[3] = stateSize;
+    pHeader[4] = uptime;
+    pHeader[5] = offset - NEONIMAGE_HEADER_SIZE;
+    pHeader[6] = chunkCount;
+    pHeader[7] = indexOffset;
+
+    return offset;
+}
+
+uint32_t StateImage_Save(CMotherboard* pBoard, uint32_t uptime, uint8_t* pBuffer, uint32_t bufferSize)
+{
+    return StateImage_SaveChunks(pBoard, uptime, pBuffer, bufferSize, false);
+}
+
+uint32_t StateImage_SaveDelta(CMotherboard* pBoard, uint32_t uptime, uint8_t* pBuffer, uint32_t bufferSize)
+{
+    return StateImage_SaveChunks(pBoard, uptime, pBuffer, bufferSize, true);
+}
+
+struct StateImageLoadRamJob  // RAM chunks to decompress, see StateImage_LoadRamChunkTask()
+{
+    uint8_t*  pRam;
+    const NeonImageChunk* chunks[NEONIMAGE_MAX_RAM_CHUNKS];  // RAM chunks, or RAM page chunks of the delta
+    bool      failed[NEONIMAGE_MAX_RAM_CHUNKS];
+};
+
+// Decompress one RAM chunk right into the board RAM, or apply the delta RAM pages
+static void StateImage_LoadRamChunkTask(void* param, int chunk)
+{
+    StateImageLoadRamJob* pJob = (StateImageLoadRamJob*)param;
+    const NeonImageChunk* pChunk = pJob->chunks[chunk];
+    uint8_t* pDest = pJob->pRam + chunk * NEONIMAGE_RAM_CHUNK_SIZE;
+    pJob->failed[chunk] = false;
+    if (pChunk == nullptr)  // No changes in this RAM chunk
+        return;
+    if (pChunk->tag == NEONCHUNK_RAM)
+    {
+        pJob->failed[chunk] = !StateImage_ReadChunk(pChunk, pDest, NEONIMAGE_RAM_CHUNK_SIZE);
+        return;
+    }
+
+    uint8_t* pPages = (uint8_t*) ::malloc(sizeof(uint64_t) + NEONIMAGE_RAM_CHUNK_SIZE);
+    uint64_t mask;
+    bool okLoaded = pPages != nullptr &&
+            pChunk->size >= sizeof(mask) && StateImage_ReadChunk(pChunk, pPages, pChunk->size);
+    if (okLoaded)
+    {
+        memcpy(&mask, pPages, sizeof(mask));
+        okLoaded = pChunk->size == sizeof(mask) + StateImage_CountPages(mask) * NEONIMAGE_RAM_PAGE_SIZE;
+    }
+    const uint8_t* pPage = pPages + sizeof(mask);
+    for (uint32_t page = 0; okLoaded && page < 64; page++)
+    {
+        if ((mask & (((uint64_t)1) << page)) == 0)
+            continue;
+        memcpy(pDest + page * NEONIMAGE_RAM_PAGE_SIZE, pPage, NEONIMAGE_RAM_PAGE_SIZE);
+        pPage += NEONIMAGE_RAM_PAGE_SIZE;
+    }
+    ::free(pPages);
+    pJob->failed[chunk] = !okLoaded;
+}
+
+// Decompress all the RAM chunks, or apply all the RAM page chunks of the delta, in parallel
+static bool StateImage_LoadRamChunks(CMotherboard* pBoard, const NeonImageChunk** ramChunks, uint32_t ramChunkCount)
+{
+    StateImageLoadRamJob* pJob = new StateImageLoadRamJob();
+    pJob->pRam = pBoard->GetRAMImage();
+    memcpy(pJob->chunks, ramChunks, sizeof(pJob->chunks));
+    StateImage_ParallelFor(ramChunkCount, StateImage_LoadRamChunkTask, pJob);
+    bool okLoaded = true;
+    for (uint32_t chunk = 0; chunk < ramChunkCount; chunk++)
+        okLoaded = okLoaded && !pJob->failed[chunk];
+    delete pJob;
+
+    if (!okLoaded)
+        pBoard->Reset();  // RAM is partially overwritten, the board state is not usable
+    return okLoaded;
+}
+
+// Version 2.0 image, the header is checked already. With okLazy, *pOkGiven tells that the RAM chunks source
+// took the image data, see StateImage_Load().
+static bool StateImage_LoadVersion2(
+    CMotherboard* pBoard, const uint8_t* pData, uint32_t dataSize, bool okLazy, bool okTakeOwnership, bool* pOkGiven)
+{
+    const uint32_t* pHeader = (const uint32_t*)pData;
+    if (pHeader[5] > dataSize - NEONIMAGE_HEADER_SIZE)
+        return false;
+    dataSize = NEONIMAGE_HEADER_SIZE + pHeader[5];
+
+    // Index
+    const NeonImageChunk* pIndexChunk = StateImage_FindChunk(pData, dataSize, pHeader[7]);
+    if (pIndexChunk == nullptr || pIndexChunk->tag != NEONCHUNK_INDEX || pIndexChunk->flags != 0 ||
+        pIndexChunk->storedSize != pIndexChunk->size ||
+        pIndexChunk->size != pHeader[6] * sizeof(NeonImageIndexEntry))
+        return false;
+    const NeonImageIndexEntry* pIndex = (const NeonImageIndexEntry*)((const uint8_t*)pIndexChunk + sizeof(NeonImageChunk));
+    if (StateImage_Checksum((const uint8_t*)pIndex, pIndexChunk->size) != pIndexChunk->checksum)
+        return false;
+
+    const NeonImageChunk* pBoardChunk = nullptr;
+    const NeonImageChunk* pCpuChunk = nullptr;
+    const NeonImageChunk* pHdBuffChunk = nullptr;
+    const NeonImageChunk* pFloppyChunk = nullptr;
+    const NeonImageChunk* pRomChunk = nullptr;
+    const NeonImageChunk* pRomHashChunk = nullptr;
+    const NeonImageChunk* pDeltaChunk = nullptr;
+    const NeonImageChunk* ramChunks[NEONIMAGE_MAX_RAM_CHUNKS];  // RAM chunks, or RAM page chunks for the delta
+    memset(ramChunks, 0, sizeof(ramChunks));
+    for (uint32_t i = 0; i < pHeader[6]; i++)
+    {
+        const NeonImageChunk* pChunk = StateImage_FindChunk(pData, dataSize, pIndex[i].offset);
+        if (pChunk == nullptr || pChunk->tag != pIndex[i].tag || pChunk->number != pIndex[i].number)
+            return false;
+        switch (pChunk->tag)
+        {
+        case NEONCHUNK_BOARD:   pBoardChunk = pChunk;  break;
+        case NEONCHUNK_CPU:     pCpuChunk = pChunk;  break;
+        case NEONCHUNK_HDBUFF:  pHdBuffChunk = pChunk;  break;
+        case NEONCHUNK_FLOPPY:  pFloppyChunk = pChunk;  break;
+        case NEONCHUNK_ROM:     pRomChunk = pChunk;  break;
+        case NEONCHUNK_ROMHASH: pRomHashChunk = pChunk;  break;
+        case NEONCHUNK_DELTA:   pDeltaChunk = pChunk;  break;
+        case NEONCHUNK_RAM:
+        case NEONCHUNK_RAMPAGES:
+            if (pChunk->number >= NEONIMAGE_MAX_RAM_CHUNKS || pChunk->size > sizeof(uint64_t) + NEONIMAGE_RAM_CHUNK_SIZE)
+                return false;
+            ramChunks[pChunk->number] = pChunk;
+            break;
+        default:  // Unknown chunk, skip it
+            break;
+        }
+    }
+    if (pBoardChunk == nullptr || pCpuChunk == nullptr)
+        return false;
+
+    // Put the sections to the version 1.0 layout, over the current state for the chunks missing
+    uint8_t* pImage = (uint8_t*) ::calloc(NEONIMAGE_RAM_OFFSET, 1);
+    if (pImage == nullptr)
+        return false;
+    pBoard->SaveToImage(pImage, false);
+    uint8_t floppyImage[FLOPPY_IMAGE_SIZE];
+    bool okLoaded =
+        StateImage_ReadChunk(pBoardChunk, pImage + NEONIMAGE_BOARD_OFFSET, NEONIMAGE_BOARD_SIZE) &&
+        StateImage_ReadChunk(pCpuChunk, pImage + NEONIMAGE_CPU_OFFSET, NEONIMAGE_CPU_SIZE) &&
+        (pHdBuffChunk == nullptr || StateImage_ReadChunk(pHdBuffChunk, pImage + NEONIMAGE_HDBUFF_OFFSET, NEONIMAGE_HDBUFF_SIZE)) &&
+        (pRomChunk == nullptr || StateImage_ReadChunk(pRomChunk, pImage + NEONIMAGE_ROM_OFFSET, NEONIMAGE_ROM_SIZE)) &&
+        (pFloppyChunk == nullptr || StateImage_ReadChunk(pFloppyChunk, floppyImage, FLOPPY_IMAGE_SIZE));
+    if (okLoaded && pRomChunk == nullptr && pRomHashChunk != nullptr)  // ROM saved by hash, we must know the ROM
+    {
+        uint32_t romHash[2];
+        const uint8_t* pKnownRom = nullptr;
+        okLoaded = StateImage_ReadChunk(pRomHashChunk, (uint8_t*)romHash, sizeof(romHash)) &&
+                (pKnownRom = StateImage_FindKnownRomByHash(romHash)) != nullptr;
+        if (okLoaded)
+            memcpy(pImage + NEONIMAGE_ROM_OFFSET, pKnownRom, NEONIMAGE_ROM_SIZE);
+    }
+
+    // All the RAM chunks must be present; the delta must have the same RAM size and page size
+    uint32_t ramSize;
+    memcpy(&ramSize, pImage + NEONIMAGE_BOARD_OFFSET + 2, sizeof(ramSize));
+    uint32_t ramChunkCount = ramSize / NEONIMAGE_RAM_CHUNK_SIZE;
+    uint32_t pageSize = 0;
+    bool okDelta = pDeltaChunk != nullptr;
+    if (okDelta)
+    {
+        okLoaded = okLoaded && ramSize == pBoard->GetRamSizeBytes() &&
+                StateImage_ReadChunk(pDeltaChunk, (uint8_t*)&pageSize, sizeof(pageSize)) &&
+                pageSize == NEONIMAGE_RAM_PAGE_SIZE;
+    }
+    for (uint32_t chunk = 0; okLoaded && chunk < ramChunkCount; chunk++)
+    {
+        const NeonImageChunk* pChunk = (chunk < NEONIMAGE_MAX_RAM_CHUNKS) ? ramChunks[chunk] : nullptr;
+        if (okDelta)
+            okLoaded = pChunk == nullptr || pChunk->tag == NEONCHUNK_RAMPAGES;
+        else  // The data is checked on decompression; for the lazy load, the failure stops the run then
+            okLoaded = pChunk != nullptr && pChunk->tag == NEONCHUNK_RAM &&
+                    StateImage_CheckChunkSize(pChunk, NEONIMAGE_RAM_CHUNK_SIZE);
+    }
+
+    // Now change the board state; LoadFromImage() re-allocates RAM if needed
+    okLoaded = okLoaded && pBoard->LoadFromImage(pImage, false);
+    ::free(pImage);
+    if (!okLoaded)
+        return false;
+    if (pFloppyChunk != nullptr)
+        pBoard->GetFloppyCtl()->LoadFromImage(floppyImage);
+
+    // RAM pages of the delta, over the current RAM
+    if (okDelta)
+        return StateImage_LoadRamChunks(pBoard, ramChunks, ramChunkCount);
+
+    // RAM
+    if (okLazy)
+    {
+        StateImageRamSource* pSource = new StateImageRamSource();
+        pSource->pData = pData;
+        pSource->okOwnData = okTakeOwnership;
+        uint64_t pendingMask = 0;
+        for (uint32_t chunk = 0; chunk < ramChunkCount; chunk++)
+        {
+            pSource->chunks[chunk] = ramChunks[chunk];
+            pendingMask |= ((uint64_t)1) << chunk;
+        }
+        *pOkGiven = true;
+        pBoard->SetRAMChunkSource(pendingMask, StateImage_LoadRamChunk, pSource);
+        return true;
+    }
+
+    pBoard->SetRAMChunkSource(0, nullptr, nullptr);  // RAM is replaced
+    return StateImage_LoadRamChunks(pBoard, ramChunks, ramChunkCount);
+}
+
+bool StateImage_Load(CMotherboard* pBoard, const uint8_t* pData, uint32_t dataSize, uint32_t* pUptime,
+        bool okLazy, bool okTakeOwnership)
+{
+    bool okLoaded = false;
+    bool okGiven = false;
+    const uint32_t* pHeader = (const uint32_t*)pData;
+    if (pData != nullptr && dataSize >= NEONIMAGE_HEADER_SIZE &&
+        pHeader[0] == NEONIMAGE_HEADER1 && pHeader[1] == NEONIMAGE_HEADER2)
+    {
+        if (pUptime != nullptr)
+            *pUptime = pHeader[4];
+        if (pHeader[2] == NEONIMAGE_VERSION_1_0)
+            okLoaded = StateImage_LoadVersion1(pBoard, pData, dataSize);
+        else if (pHeader[2] == NEONIMAGE_VERSION)
+            okLoaded = StateImage_LoadVersion2(pBoard, pData, dataSize, okLazy, okTakeOwnership, &okGiven);
+    }
+
+    if (okTakeOwnership && !okGiven)
+        ::free(const_cast<uint8_t*>(pData));
+    return okLoaded;
+}
+
+
+//////////////////////////////////////////////////////////////////////
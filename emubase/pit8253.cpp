@@ -23,6 +23,7 @@ PIT8253_chan::PIT8253_chan()
     value = count = 0;
     gate = true;
     writehi = readhi = false;
+    output = false;
 }
 
 PIT8253::PIT8253()
@@ -0,0 +1,299 @@
+// emul-worker.js
+// NeonBTL emulator core running in the Web Worker, for the worker=1 mode of index.html.
+// The screen and the status are in SharedArrayBuffer; the commands come as messages:
+//   init { screen, status, state }  -- shared arrays, and the state image to start from or null
+//   key { scan, pressed, time }  -- time is performance.timeOrigin + performance.now() when the key came
+//   start, stop, reset, draw, rewind, runAhead { frames }, setRewind { budget, interval } -- MB, frames; 0 MB = off,
+//   setStateThreads { count } -- threads for the state image RAM chunks, the threaded build only,
+//   attach { slot, data, filename }, detach { slot },
+//   stream { slot, url, filename } -- attach the image while it is downloaded from the URL,
+//   loadState { data }, saveState -- replies with savedState { data }, data is null on failure,
+//   takeDiskChanges { disk } -- replies with diskChanges { disk, changes }: { offset, data } written since the last time, or null,
+//   visibility { hidden } -- no frames while the page is hidden
+// The worker posts: ready, print { text }, savedState { data }, diskChanges { disk, changes }.
+
+var LINE_SIZE = 832 * 4;  // Screen line, bytes
+var STATUS_SEQUENCE = 0;  // Screen sequence: odd while the screen is being written, even when it's ready
+var STATUS_UPTIME = 1;    // Machine uptime, ms
+var STATUS_WANTED = 2;    // Set by the page on every animation frame: render the screen after the next frames
+var FRAME_TIME = 40;      // Two frames every 40 ms, same as the main thread loop
+var TICKS_PER_MS = 2 * 20000 / FRAME_TIME;  // NEON_FRAME_TICKS board ticks per frame
+
+// Emulator_RunFrames() flags, and the EmulatorStatus words it returns, see Emulator.cpp
+var RUNFRAMES_RENDER = 1;
+var EMULATOR_STATUS_FRAMEBUFFER = 0, EMULATOR_STATUS_UPTIME = 2, EMULATOR_STATUS_RENDERED = 4,
+    EMULATOR_STATUS_DIRTY_Y = 6, EMULATOR_STATUS_DIRTY_HEIGHT = 8;
+
+var shared = null;
+var emulator = 0;  // Emulator context
+var runFrames = null;  // Emulator_RunFrames
+var emulatorStatus = 0;  // EmulatorStatus word index in HEAPU32
+var running = false;
+var hidden = false;
+var frameTimer = 0;
+var nextFrameTime = 0;
+
+// Run the frames and render the screen if asked, all in one call; then publish the changed lines and the uptime
+function runAndPresent(frames, render) {
+    runFrames(emulator, frames, render ? RUNFRAMES_RENDER : 0);
+    var status = Module.HEAPU32;
+    var dirtyHeight = status[emulatorStatus + EMULATOR_STATUS_DIRTY_HEIGHT];
+    if (status[emulatorStatus + EMULATOR_STATUS_RENDERED] && dirtyHeight > 0) {
+        var offset = status[emulatorStatus + EMULATOR_STATUS_DIRTY_Y] * LINE_SIZE;
+        var ptrLines = status[emulatorStatus + EMULATOR_STATUS_FRAMEBUFFER] + offset;
+        Atomics.add(shared.status, STATUS_SEQUENCE, 1);
+        shared.screen.set(Module.HEAPU8.subarray(ptrLines, ptrLines + dirtyHeight * LINE_SIZE), offset);
+        Atomics.add(shared.status, STATUS_SEQUENCE, 1);
+    }
+    Atomics.store(shared.status, STATUS_UPTIME, status[emulatorStatus + EMULATOR_STATUS_UPTIME]);
+}
+
+function presentFrame() {
+    runAndPresent(0, true);
+}
+
+// Queue the key at the tick of the next frames matching the time it came: the frames run by the next
+// nextFrame() call stand for the FRAME_TIME before nextFrameTime
+function queueKey(scan, pressed, time) {
+    var offset = 0;
+    if (running) {
+        offset = time - performance.timeOrigin - (nextFrameTime - FRAME_TIME);
+        offset = Math.min(Math.max(offset, 0), FRAME_TIME);
+    }
+    Module.ccall('Emulator_QueueKeyEvent', null, ['number', 'number', 'number', 'number'],
+        [emulator, scan, pressed, Math.floor(offset * TICKS_PER_MS)]);
+}
+
+function nextFrame() {
+    frameTimer = 0;
+    if (!running || hidden)
+        return;
+
+    runAndPresent(2, Atomics.exchange(shared.status, STATUS_WANTED, 0) != 0);
+
+    // Keep the pace on average; do not try to catch up after a long stall
+    var now = performance.now();
+    nextFrameTime = Math.max(nextFrameTime + FRAME_TIME, now);
+    frameTimer = setTimeout(nextFrame, nextFrameTime - now);
+}
+
+function resumeFrames() {
+    if (frameTimer)
+        clearTimeout(frameTimer);
+    nextFrameTime = performance.now();
+    nextFrame();
+}
+
+var STREAM_CHUNK_SIZE = 65536;  // Emulator_GetStreamChunkSize()
+var floppyStreams = [null, null];  // Current stream per slot; the chunks of a replaced stream are dropped
+
+// Floppy image streaming in, see Emulator_BeginFloppyStream(); returns the stream, or null on failure
+function beginFloppyStream(slot, filename) {
+    var stream = { slot: slot };
+    floppyStreams[slot] = stream;
+    var okZip = !!filename && filename.toLowerCase().endsWith('.zip');
+    if (!Module.ccall('Emulator_BeginFloppyStream', 'number', ['number', 'number', 'number'], [emulator, slot, okZip]))
+        return null;
+    return stream;
+}
+
+function feedFloppyStream(stream, data) {
+    if (floppyStreams[stream.slot] !== stream)
+        return false;
+    var ptrChunk = Module.ccall('Emulator_GetStreamChunkBuffer', 'number', ['number'], [emulator]);
+    for (var offset = 0; offset < data.length; offset += STREAM_CHUNK_SIZE) {
+        var chunk = data.subarray(offset, offset + STREAM_CHUNK_SIZE);
+        Module.HEAPU8.set(chunk, ptrChunk);
+        if (!Module.ccall('Emulator_FeedFloppyStream', 'number', ['number', 'number', 'number'], [emulator, stream.slot, chunk.length]))
+            return false;
+    }
+    return true;
+}
+
+function endFloppyStream(stream) {
+    if (floppyStreams[stream.slot] !== stream)
+        return false;
+    floppyStreams[stream.slot] = null;
+    return Module.ccall('Emulator_EndFloppyStream', 'number', ['number', 'number'], [emulator, stream.slot]);
+}
+
+function detachFloppy(slot) {
+    floppyStreams[slot] = null;
+    Module.ccall('Emulator_DetachFloppyImage', null, ['number', 'number'], [emulator, slot]);
+}
+
+function attachFloppy(slot, data, filename) {
+    if (!!filename && filename.toLowerCase().endsWith('.zip')) {
+        var stream = beginFloppyStream(slot, filename);
+        if (stream && feedFloppyStream(stream, data))
+            endFloppyStream(stream);
+        return;
+    }
+    // The drive takes the buffer and works on it in place, see Emulator_AttachFloppyBuffer()
+    floppyStreams[slot] = null;
+    var ptrBuffer = Module._malloc(data.length);
+    Module.HEAPU8.set(data, ptrBuffer);
+    Module.ccall('Emulator_AttachFloppyBuffer', 'number', ['number', 'number', 'number', 'number', 'number'],
+        [emulator, slot, ptrBuffer, data.length, true]);
+}
+
+// Attach the image downloaded from the URL, handing the chunks to the drive as they come
+function streamFloppy(slot, url, filename) {
+    var stream = beginFloppyStream(slot, filename);
+    if (!stream)
+        return;
+    function fail(error) {
+        self.postMessage({ cmd: 'print', text: 'Failed to download the disk image from ' + url + ': ' + error });
+        if (floppyStreams[slot] === stream)
+            detachFloppy(slot);
+    }
+    fetch(url).then(function (response) {
+        if (!response.ok)
+            throw new Error('HTTP status ' + response.status);
+        var reader = response.body.getReader();
+        function pump() {
+            return reader.read().then(function (result) {
+                if (floppyStreams[slot] !== stream) {  // Replaced or detached
+                    reader.cancel();
+                    return;
+                }
+                if (result.done) {
+                    if (!endFloppyStream(stream))
+                        fail('bad image');
+                    return;
+                }
+                if (!feedFloppyStream(stream, result.value)) {
+                    reader.cancel();
+                    fail('bad image');
+                    return;
+                }
+                return pump();
+            });
+        }
+        return pump();
+    }).catch(fail);
+}
+
+function saveState() {
+    var maxSize = Module.ccall('Emulator_GetImageMaxSize', 'number', ['number'], [emulator]);
+    var ptrBuffer = Module._malloc(maxSize);
+    var size = Module.ccall('Emulator_SaveImage', 'number', ['number', 'number', 'number'], [emulator, ptrBuffer, maxSize]);
+    var data = (size > 0) ? Module.HEAPU8.slice(ptrBuffer, ptrBuffer + size) : null;
+    Module._free(ptrBuffer);
+    return data;
+}
+
+// The part of the disk image written since the previous call: { offset, data }, or null; disk: 0..1 floppy, 2 hard disk
+function takeDiskChanges(disk) {
+    var ptrRange = Module._malloc(8);
+    var ptrData = Module.ccall('Emulator_TakeDiskDirtyRange', 'number', ['number', 'number', 'number'],
+        [emulator, disk, ptrRange]);
+    var offset = Module.HEAPU32[ptrRange >> 2], length = Module.HEAPU32[(ptrRange >> 2) + 1];
+    Module._free(ptrRange);
+    return ptrData ? { offset: offset, data: Module.HEAPU8.slice(ptrData, ptrData + length) } : null;
+}
+
+function loadState(data) {
+    var ptrBuffer = Module._malloc(data.length);
+    Module.HEAPU8.set(data, ptrBuffer);
+    // The buffer is the emulator's now, see Emulator_LoadImageBuffer()
+    Module.ccall('Emulator_LoadImageBuffer', 'number', ['number', 'number', 'number'], [emulator, ptrBuffer, data.length]);
+}
+
+function init(msg) {
+    shared = { screen: msg.screen, status: msg.status };
+    self.Module = {
+        preRun: [
+            function () {
+                // Saved state if given: side-load it for Emulator_Create to restore instead of the boot image
+                if (msg.state)
+                    Module['FS_createDataFile']('/', 'boot.neonst', msg.state, true, true, true);
+            }
+        ],
+        postRun: [
+            function () {
+                emulator = Module.ccall('Emulator_Create', 'number', null, null);
+                runFrames = Module.cwrap('Emulator_RunFrames', 'number', ['number', 'number', 'number']);
+                emulatorStatus = runFrames(emulator, 0, 0) >> 2;
+                presentFrame();
+                self.postMessage({ cmd: 'ready' });
+            }
+        ],
+        print: function (text) {
+            self.postMessage({ cmd: 'print', text: text });
+        },
+        printErr: function (text) {
+            self.postMessage({ cmd: 'print', text: text });
+        }
+    };
+    importScripts('emul.js');
+}
+
+self.onmessage = function (event) {
+    var msg = event.data;
+    if (msg.cmd == 'init') {
+        init(msg);
+        return;
+    }
+    if (!emulator)
+        return;  // Not ready yet
+
+    switch (msg.cmd) {
+        case 'key':
+            queueKey(msg.scan, msg.pressed, msg.time);
+            break;
+        case 'start':
+            Module.ccall('Emulator_Start', null, ['number'], [emulator]);
+            running = true;
+            resumeFrames();
+            break;
+        case 'stop':
+            Module.ccall('Emulator_Stop', null, ['number'], [emulator]);
+            running = false;
+            break;
+        case 'reset':
+            Module.ccall('Emulator_Reset', null, ['number'], [emulator]);
+            break;
+        case 'draw':
+            presentFrame();
+            break;
+        case 'rewind':
+            if (Module.ccall('Emulator_RewindStep', 'number', ['number'], [emulator]))
+                presentFrame();
+            break;
+        case 'runAhead':
+            Module.ccall('Emulator_SetRunAhead', null, ['number', 'number'], [emulator, msg.frames]);
+            break;
+        case 'setRewind':
+            Module.ccall('Emulator_SetRewind', null, ['number', 'number', 'number'], [emulator, msg.budget, msg.interval]);
+            break;
+        case 'setStateThreads':
+            Module.ccall('Emulator_SetStateThreads', null, ['number'], [msg.count]);
+            break;
+        case 'attach':
+            attachFloppy(msg.slot, msg.data, msg.filename);
+            break;
+        case 'detach':
+            detachFloppy(msg.slot);
+            break;
+        case 'stream':
+            streamFloppy(msg.slot, msg.url, msg.filename);
+            break;
+        case 'loadState':
+            running = false;
+            loadState(msg.data);
+            presentFrame();
+            break;
+        case 'saveState':
+            self.postMessage({ cmd: 'savedState', data: saveState() });
+            break;
+        case 'takeDiskChanges':
+            self.postMessage({ cmd: 'diskChanges', disk: msg.disk, changes: takeDiskChanges(msg.disk) });
+            break;
+        case 'visibility':
+            hidden = msg.hidden;
+            if (!hidden && running)
+                resumeFrames();
+            break;
+    }
+};
@@ -5,13 +5,7 @@
 #include <stdio.h>
 #include <cstdio>
 #include <cstdlib>
-
-   typedef unsigned char       uint8_t;
-   typedef unsigned short int  uint16_t;
-   typedef signed short int    int16_t;
-   typedef unsigned int        uint32_t;
-   typedef signed int          int32_t;
-   typedef unsigned long long  uint64_t;
+#include <stdint.h>
 
 
 #define MAKELONG(a, b)      ((uint16_t)(((uint16_t)(((uint32_t)(a)) & 0xffff)) | ((uint32_t)((uint16_t)(((uint32_t)(b)) & 0xffff))) << 16))
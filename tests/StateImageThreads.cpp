@@ -0,0 +1,131 @@
+/*  This file is part of NEONBTL.
+    NEONBTL is free software: you can redistribute it and/or modify it under the terms
+of the GNU Lesser General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+    NEONBTL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License along with
+NEONBTL. If not, see <http://www.gnu.org/licenses/>. */
+
+// StateImageThreads.cpp
+// Test: the state images do not depend on the number of threads, see StateImage_SetThreadCount().
+// The machines are saved on one thread and on N threads, the full image and the delta, and the images are compared
+// byte for byte; then the image is loaded on N threads and saved again, it must come out the same.
+//
+// Build, from the repository root:
+//   g++ -O2 -pthread tests/StateImageThreads.cpp emubase/Board.cpp emubase/Processor.cpp emubase/Floppy.cpp
+//       emubase/Hard.cpp emubase/pit8253.cpp emubase/Disasm.cpp emubase/StateImage.cpp emubase/Rewind.cpp
+//       emubase/DiskOverlay.cpp emubase/RunAhead.cpp util/lz4.cpp -o statethreads
+// Usage:
+//   statethreads [threads]   -- 4 threads by default; exit code 0 if all the images are the same
+
+#include "../stdafx.h"
+#include "../emubase/Emubase.h"
+
+// DebugPrint and DebugLog
+void DebugPrint(LPCTSTR) {}
+void DebugPrintFormat(LPCTSTR, ...) {}
+void DebugLogClear() {}
+void DebugLogCloseFile() {}
+void DebugLog(LPCTSTR) {}
+void DebugLogFormat(LPCTSTR, ...) {}
+
+#include "../pk11_rom.h"
+#include "../boot_image.h"
+
+#define TEST_RTC_TIME  946684800  // 2000-01-01, the clock is saved in the image
+
+
+//////////////////////////////////////////////////////////////////////
+
+// Save the image on the given number of threads; returns the image size, 0 on failure
+static uint32_t Test_Save(CMotherboard* pBoard, int threads, bool okDelta, uint8_t* pBuffer, uint32_t bufferSize)
+{
+    StateImage_SetThreadCount(threads);
+    return okDelta ?
+            StateImage_SaveDelta(pBoard, 0, pBuffer, bufferSize) :
+            StateImage_Save(pBoard, 0, pBuffer, bufferSize);
+}
+
+// Save on one thread and on N threads, and compare; then load the image on N threads and save it again
+static bool Test_Machine(const char* sName, CMotherboard* pBoard, int threads)
+{
+    uint32_t bufferSize = StateImage_GetMaxSize(pBoard);
+    uint8_t* pSingle = (uint8_t*) ::malloc(bufferSize);
+    uint8_t* pMulti = (uint8_t*) ::malloc(bufferSize);
+    bool okPassed = pSingle != nullptr && pMulti != nullptr;
+
+    for (int delta = 0; okPassed && delta < 2; delta++)
+    {
+        uint32_t singleSize = Test_Save(pBoard, 1, delta != 0, pSingle, bufferSize);
+        uint32_t multiSize = Test_Save(pBoard, threads, delta != 0, pMulti, bufferSize);
+        okPassed = singleSize != 0 && singleSize == multiSize && memcmp(pSingle, pMulti, singleSize) == 0;
+        printf("%s, %s image: %u bytes on 1 thread, %u bytes on %d threads: %s\n", sName, delta ? "delta" : "full",
+                singleSize, multiSize, threads, okPassed ? "same" : "DIFFERENT");
+    }
+
+    if (okPassed)
+    {
+        uint32_t imageSize = Test_Save(pBoard, 1, false, pSingle, bufferSize);
+        CMotherboard* pLoaded = new CMotherboard();
+        StateImage_SetThreadCount(threads);
+        okPassed = StateImage_Load(pLoaded, pSingle, imageSize, nullptr, false, false);
+        pLoaded->SetRtcFixedTime(TEST_RTC_TIME);
+        uint32_t loadedSize = okPassed ? Test_Save(pLoaded, threads, false, pMulti, bufferSize) : 0;
+        okPassed = okPassed && loadedSize == imageSize && memcmp(pSingle, pMulti, imageSize) == 0;
+        printf("%s, loaded on %d threads and saved again: %s\n", sName, threads, okPassed ? "same" : "DIFFERENT");
+        delete pLoaded;
+    }
+
+    ::free(pSingle);
+    ::free(pMulti);
+    return okPassed;
+}
+
+int main(int argc, char* argv[])
+{
+    int threads = (argc > 1) ? atoi(argv[1]) : 4;
+    if (threads < 2) threads = 2;
+
+    CProcessor::Init();
+    StateImage_AddKnownRom((const uint8_t*)pk11_rom);
+    bool okPassed = true;
+
+    // The boot image machine, with the RAM written by the frames since the load for the delta
+    CMotherboard* pBoard = new CMotherboard();
+    pBoard->SetRtcFixedTime(TEST_RTC_TIME);
+    if (!StateImage_Load(pBoard, boot_image, boot_image_length, nullptr, false, false))
+    {
+        printf("Failed to load the boot image\n");
+        return 1;
+    }
+    pBoard->ClearRAMDirtyMap();
+    for (int frame = 0; frame < 50; frame++)
+        pBoard->SystemFrame();
+    okPassed = Test_Machine("Boot image", pBoard, threads) && okPassed;
+    delete pBoard;
+
+    // The largest RAM, 64 chunks, going through the ROM self-test
+    pBoard = new CMotherboard();
+    pBoard->SetConfiguration(4096);
+    pBoard->SetSharedROM((const uint8_t*)pk11_rom);
+    pBoard->SetRtcFixedTime(TEST_RTC_TIME);
+    pBoard->Reset();
+    for (int frame = 0; frame < 100; frame++)
+    {
+        if (frame == 50)
+            pBoard->ClearRAMDirtyMap();
+        pBoard->SystemFrame();
+    }
+    okPassed = Test_Machine("Cold boot, 4096 KB", pBoard, threads) && okPassed;
+    delete pBoard;
+
+    StateImage_SetThreadCount(1);
+    CProcessor::Done();
+    printf(okPassed ? "PASSED\n" : "FAILED\n");
+    return okPassed ? 0 : 1;
+}
+
+
+//////////////////////////////////////////////////////////////////////